@@ -10,9 +10,11 @@
 
 #include <adobe/config.hpp>
 
+#include <filesystem>
 #include <functional>
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <adobe/array.hpp>
@@ -174,6 +176,19 @@ struct adam_callback_suite_t {
 void parse(std::istream& stream, const line_position_t& position,
            const adam_callback_suite_t& callbacks);
 
+/*
+    Parses source directly from memory, which is considerably faster than parsing from a stream.
+    source must remain valid for the duration of the call.
+*/
+void parse(std::string_view source, const line_position_t& position,
+           const adam_callback_suite_t& callbacks);
+
+/*
+    Memory-maps the file at path and parses it in place. The file name is used as the stream name
+    for error reporting.
+*/
+void parse_file(const std::filesystem::path& path, const adam_callback_suite_t& callbacks);
+
 /**************************************************************************************************/
 
 array_t parse_adam_expression(const std::string& expression);
@@ -0,0 +1,93 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_ALGORITHM_EXECUTION_HPP
+#define ADOBE_ALGORITHM_EXECUTION_HPP
+
+#include <adobe/config.hpp>
+
+#include <adobe/future.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+/*!
+\defgroup execution execution policies
+\ingroup algorithm
+
+Execution policies select between the serial algorithms and their parallel overloads, much as
+the \c std::execution policies do, but the parallel overloads take the same projections as the
+serial ones and run on the \c adobe::async() pool, with the calling thread taking part.
+
+The parallel overloads split the range into chunks of at least \c grain_size_k elements, so that
+small ranges are processed serially on the calling thread. Functions passed to them are called
+concurrently and must be safe to call so. If one throws, chunks not yet started are skipped and
+the first exception is rethrown once every chunk started has finished.
+*/
+/**************************************************************************************************/
+
+namespace execution {
+
+/*!
+    \ingroup execution
+
+    \brief The type of the execution policies \c seq and \c par.
+*/
+template <bool Parallel>
+struct basic_policy_t {
+    static constexpr bool parallel_k = Parallel;
+};
+
+typedef basic_policy_t<false> sequenced_policy_t;
+typedef basic_policy_t<true> parallel_policy_t;
+
+/// \ingroup execution
+inline constexpr sequenced_policy_t seq{};
+/// \ingroup execution
+inline constexpr parallel_policy_t par{};
+
+/// \ingroup execution
+constexpr std::size_t grain_size_k = 1 << 14;
+
+/**************************************************************************************************/
+
+namespace detail {
+
+/// The number of threads the parallel algorithms use, the pool's and the calling thread.
+std::size_t concurrency();
+
+/// The number of chunks to split n elements into, a few for each thread to balance the load.
+inline std::size_t chunk_count(std::size_t n) {
+    return std::max<std::size_t>(1, std::min(n / grain_size_k, concurrency() * 4));
+}
+
+/// Calls f(first, last) for each of count nearly equal chunks [first, last) of [0, n).
+template <typename F>
+void for_each_chunk(std::size_t n, std::size_t count, F f) {
+    adobe::for_each_async(count, [&](std::size_t i) { f(n * i / count, n * (i + 1) / count); });
+}
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+} // namespace execution
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
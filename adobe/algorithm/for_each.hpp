@@ -12,7 +12,11 @@
 #include <adobe/config.hpp>
 #include <functional>
 
+#include <adobe/algorithm/execution.hpp>
+
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -63,6 +67,53 @@ inline void for_each(const InputRange& range, UnaryFunction f) {
     adobe::for_each(boost::begin(range), boost::end(range), f);
 }
 
+/**************************************************************************************************/
+/*!
+    \ingroup for_each
+
+    \brief for_each implementation, with an execution policy
+
+    Under the parallel policy \c f is called concurrently, for elements in no particular order.
+*/
+template <bool Parallel, class RandomAccessIterator, class UnaryFunction>
+inline void for_each(const execution::basic_policy_t<Parallel>&, RandomAccessIterator first,
+                     RandomAccessIterator last, UnaryFunction f) {
+    if constexpr (Parallel) {
+        const std::size_t n(std::distance(first, last));
+
+        execution::detail::for_each_chunk(
+            n, execution::detail::chunk_count(n), [&](std::size_t l, std::size_t r) {
+                for (RandomAccessIterator i(first + l), e(first + r); i != e; ++i)
+                    std::invoke(f, *i);
+            });
+    } else {
+        for (; first != last; ++first)
+            std::invoke(f, *first);
+    }
+}
+
+/*!
+    \ingroup for_each
+
+    \brief for_each implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange, class UnaryFunction>
+inline void for_each(const execution::basic_policy_t<Parallel>& policy, RandomAccessRange& range,
+                     UnaryFunction f) {
+    adobe::for_each(policy, boost::begin(range), boost::end(range), f);
+}
+
+/*!
+    \ingroup for_each
+
+    \brief for_each implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange, class UnaryFunction>
+inline void for_each(const execution::basic_policy_t<Parallel>& policy,
+                     const RandomAccessRange& range, UnaryFunction f) {
+    adobe::for_each(policy, boost::begin(range), boost::end(range), f);
+}
+
 /**************************************************************************************************/
 
 } // namespace adobe
@@ -10,13 +10,20 @@
 
 #include <adobe/config.hpp>
 
+#include <adobe/algorithm/execution.hpp>
+#include <adobe/algorithm/find.hpp>
 #include <adobe/algorithm/identity_element.hpp>
 #include <adobe/algorithm/other_of.hpp>
 #include <adobe/functional.hpp>
 #include <adobe/iterator/type_functions.hpp>
 
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 /**************************************************************************************************/
@@ -116,6 +123,92 @@ reduce_balanced(I f, I l, Op op, ADOBE_VALUE_TYPE(I) z = adobe::identity_element
     return reduce_nonzeros(v.begin(), v.end(), transpose(op), z);
 }
 
+/**************************************************************************************************/
+/*!
+    \ingroup reduce
+
+    \brief Reduces the projections of the elements of [f, l) with op, from z.
+
+    \c op must be associative, with \c z as its identity element. Under the parallel policy each
+    chunk of the range is reduced from \c z concurrently and their results are combined in order,
+    so \c op need not be commutative.
+*/
+template <bool Parallel,
+          typename I,  // I models RandomAccessIterator
+          typename Op, // Op models BinaryOperation(T, T) -> T
+          typename P,  // P models UnaryFunction(value_type(I)) -> T
+          typename T>
+T reduce(const execution::basic_policy_t<Parallel>&, I f, I l, Op op, P p, T z) {
+    const auto fold = [&](I first, I last) {
+        T result(z);
+
+        for (; first != last; ++first)
+            result = op(std::move(result), std::invoke(p, *first));
+
+        return result;
+    };
+
+    const std::size_t n(std::distance(f, l));
+    const std::size_t count(Parallel ? execution::detail::chunk_count(n) : 1);
+
+    if (count == 1)
+        return fold(f, l);
+
+    std::vector<T> partial(count, z);
+
+    adobe::for_each_async(count, [&](std::size_t i) {
+        partial[i] = fold(f + n * i / count, f + n * (i + 1) / count);
+    });
+
+    T result(std::move(partial[0]));
+
+    for (std::size_t i(1); i != count; ++i)
+        result = op(std::move(result), std::move(partial[i]));
+
+    return result;
+}
+
+/*!
+    \ingroup reduce
+
+    \brief Reduces the elements of [f, l) with op, from the identity element of op.
+*/
+template <bool Parallel,
+          typename I,  // I models RandomAccessIterator
+          typename Op> // Op models BinaryOperation
+ADOBE_VALUE_TYPE(I)
+reduce(const execution::basic_policy_t<Parallel>& policy, I f, I l, Op op) {
+    return adobe::reduce(
+        policy, f, l, op, [](const auto& x) -> const auto& { return x; },
+        ADOBE_VALUE_TYPE(I)(adobe::identity_element<Op>()()));
+}
+
+/*!
+    \ingroup reduce
+
+    \brief Reduces the elements of r with op, from the identity element of op.
+*/
+template <bool Parallel,
+          typename R,  // R models RandomAccessRange
+          typename Op> // Op models BinaryOperation
+inline auto reduce(const execution::basic_policy_t<Parallel>& policy, const R& r, Op op) {
+    return adobe::reduce(policy, boost::begin(r), boost::end(r), op);
+}
+
+/*!
+    \ingroup reduce
+
+    \brief Reduces the projections of the elements of r with op, from the identity element of op.
+*/
+template <bool Parallel,
+          typename R,  // R models RandomAccessRange
+          typename Op, // Op models BinaryOperation(T, T) -> T
+          typename P>  // P models UnaryFunction(value_type(R)) -> T
+inline auto reduce(const execution::basic_policy_t<Parallel>& policy, const R& r, Op op, P p) {
+    return adobe::reduce(policy, boost::begin(r), boost::end(r), op, p,
+                         adobe::identity_element<Op>()());
+}
+
 /**************************************************************************************************/
 
 } // namespace adobe
@@ -10,10 +10,14 @@
 
 #include <adobe/config.hpp>
 
+#include <adobe/algorithm/execution.hpp>
+#include <adobe/implementation/bit.hpp>
+
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 
 /**************************************************************************************************/
@@ -188,6 +192,174 @@ inline void partial_sort_copy(const InputRange& range, RandomAccessRange& result
 
 /**************************************************************************************************/
 
+namespace execution {
+namespace detail {
+
+/*
+    Sorts a power of two chunks of [f, l), one for each thread, concurrently, then merges pairs of
+    adjacent runs, concurrently, until a single run is left.
+*/
+template <typename I, // I models RandomAccessIterator
+          typename C> // C models StrictWeakOrdering(value_type(I), value_type(I))
+void sort(I f, I l, C comp, bool stable) {
+    const std::size_t n(l - f);
+    const std::size_t count(implementation::bit_floor(std::min(n / grain_size_k, concurrency())));
+
+    if (count < 2) {
+        if (stable)
+            std::stable_sort(f, l, comp);
+        else
+            std::sort(f, l, comp);
+        return;
+    }
+
+    const auto bound = [&](std::size_t i) { return f + n * i / count; };
+
+    adobe::for_each_async(count, [&](std::size_t i) {
+        if (stable)
+            std::stable_sort(bound(i), bound(i + 1), comp);
+        else
+            std::sort(bound(i), bound(i + 1), comp);
+    });
+
+    for (std::size_t width(1); width != count; width *= 2) {
+        adobe::for_each_async(count / (width * 2), [&](std::size_t i) {
+            std::inplace_merge(bound(i * width * 2), bound(i * width * 2 + width),
+                               bound((i + 1) * width * 2), comp);
+        });
+    }
+}
+
+} // namespace detail
+} // namespace execution
+
+/**************************************************************************************************/
+/*!
+    \ingroup sort
+
+    \brief sort implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessIterator, class Compare>
+inline void sort(const execution::basic_policy_t<Parallel>&, RandomAccessIterator first,
+                 RandomAccessIterator last, Compare comp) {
+    if constexpr (Parallel) {
+        execution::detail::sort(
+            first, last, [&comp](const auto& a, const auto& b) { return std::invoke(comp, a, b); },
+            false);
+    } else {
+        adobe::sort(first, last, comp);
+    }
+}
+
+/*!
+    \ingroup sort
+
+    \brief sort implementation, with an execution policy
+*/
+template <bool Parallel,
+          typename I, // I models RandomAccessIterator
+          typename C, // C models StrictWeakOrdering(T, T)
+          typename P>
+// P models UnaryFunction(value_type(I)) -> T
+inline void sort(const execution::basic_policy_t<Parallel>& policy, I f, I l, C c, P p) {
+    return adobe::sort(policy, f, l, [&p, &c](const auto& a, const auto& b) {
+        return std::invoke(c, std::invoke(p, a), std::invoke(p, b));
+    });
+}
+
+/*!
+    \ingroup sort
+
+    \brief sort implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange>
+inline void sort(const execution::basic_policy_t<Parallel>& policy, RandomAccessRange& range) {
+    return adobe::sort(policy, boost::begin(range), boost::end(range), std::less<>());
+}
+
+/*!
+    \ingroup sort
+
+    \brief sort implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange, class Compare>
+inline void sort(const execution::basic_policy_t<Parallel>& policy, RandomAccessRange& range,
+                 Compare comp) {
+    return adobe::sort(policy, boost::begin(range), boost::end(range), comp);
+}
+
+/*!
+    \ingroup sort
+
+    \brief sort implementation, with an execution policy
+*/
+template <bool Parallel,
+          typename R, // R models RandomAccessRange
+          typename C, // C models StrictWeakOrdering(T, T)
+          typename P>
+// P models UnaryFunction(value_type(R)) -> T
+inline void sort(const execution::basic_policy_t<Parallel>& policy, R& r, C c, P p) {
+    return adobe::sort(policy, boost::begin(r), boost::end(r), c, p);
+}
+
+/*!
+    \ingroup sort
+
+    \brief stable_sort implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessIterator, class Compare>
+inline void stable_sort(const execution::basic_policy_t<Parallel>&, RandomAccessIterator first,
+                        RandomAccessIterator last, Compare comp) {
+    if constexpr (Parallel) {
+        execution::detail::sort(
+            first, last, [&comp](const auto& a, const auto& b) { return std::invoke(comp, a, b); },
+            true);
+    } else {
+        adobe::stable_sort(first, last, comp);
+    }
+}
+
+/*!
+    \ingroup sort
+
+    \brief stable_sort implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange>
+inline void stable_sort(const execution::basic_policy_t<Parallel>& policy,
+                        RandomAccessRange& range) {
+    return adobe::stable_sort(policy, boost::begin(range), boost::end(range), std::less<>());
+}
+
+/*!
+    \ingroup sort
+
+    \brief stable_sort implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange, class Compare>
+inline void stable_sort(const execution::basic_policy_t<Parallel>& policy,
+                        RandomAccessRange& range, Compare comp) {
+    return adobe::stable_sort(policy, boost::begin(range), boost::end(range), comp);
+}
+
+/*!
+    \ingroup sort
+
+    \brief stable_sort implementation, with an execution policy
+*/
+template <bool Parallel,
+          typename R, // R models RandomAccessRange
+          typename C, // C models StrictWeakOrdering(T, T)
+          typename P>
+// P models UnaryFunction(value_type(R)) -> T
+inline void stable_sort(const execution::basic_policy_t<Parallel>& policy, R& r, C c, P p) {
+    return adobe::stable_sort(policy, boost::begin(r), boost::end(r),
+                              [&p, &c](const auto& a, const auto& b) {
+                                  return std::invoke(c, std::invoke(p, a), std::invoke(p, b));
+                              });
+}
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
@@ -10,11 +10,15 @@
 
 #include <adobe/config.hpp>
 
+#include <adobe/algorithm/execution.hpp>
+
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 
 /**************************************************************************************************/
 
@@ -96,6 +100,58 @@ inline OutputIterator transform(const InputRange1& range1, InputIterator2 first2
     return adobe::transform(boost::begin(range1), boost::end(range1), first2, result, binary_op);
 }
 
+/**************************************************************************************************/
+/*!
+    \ingroup transform
+
+    \brief transform implementation, with an execution policy
+
+    Under the parallel policy \c op is called concurrently, and \c result must be a random access
+    iterator.
+*/
+template <bool Parallel, class RandomAccessIterator, class OutputIterator, class UnaryOperation>
+inline OutputIterator transform(const execution::basic_policy_t<Parallel>&,
+                                RandomAccessIterator first, RandomAccessIterator last,
+                                OutputIterator result, UnaryOperation op) {
+    if constexpr (Parallel) {
+        const std::size_t n(std::distance(first, last));
+
+        execution::detail::for_each_chunk(
+            n, execution::detail::chunk_count(n), [&](std::size_t f, std::size_t l) {
+                std::transform(first + f, first + l, result + f,
+                               [&op](auto&& x) { return std::invoke(op, x); });
+            });
+
+        return result + n;
+    } else {
+        return std::transform(first, last, result, [&op](auto&& x) { return std::invoke(op, x); });
+    }
+}
+
+/*!
+    \ingroup transform
+
+    \brief transform implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange, class OutputIterator, class UnaryOperation>
+inline OutputIterator transform(const execution::basic_policy_t<Parallel>& policy,
+                                RandomAccessRange& range, OutputIterator result,
+                                UnaryOperation op) {
+    return adobe::transform(policy, boost::begin(range), boost::end(range), result, op);
+}
+
+/*!
+    \ingroup transform
+
+    \brief transform implementation, with an execution policy
+*/
+template <bool Parallel, class RandomAccessRange, class OutputIterator, class UnaryOperation>
+inline OutputIterator transform(const execution::basic_policy_t<Parallel>& policy,
+                                const RandomAccessRange& range, OutputIterator result,
+                                UnaryOperation op) {
+    return adobe::transform(policy, boost::begin(range), boost::end(range), result, op);
+}
+
 /**************************************************************************************************/
 
 } // namespace adobe
@@ -13,11 +13,17 @@
 #include <adobe/config.hpp>
 
 #include <adobe/algorithm/equal.hpp>
+#include <adobe/enum_ops.hpp>
+#include <adobe/implementation/bit.hpp>
 #include <adobe/iterator.hpp>
 
 #include <boost/operators.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /**************************************************************************************************/
@@ -60,12 +66,18 @@ Equivalent to std::size_t.
 */
 
 /*!
-\fn adobe::circular_queue::circular_queue(std::size_t capacity = 0)
+\fn adobe::circular_queue::circular_queue(std::size_t capacity = 0, circular_queue_options_t
+options = circular_queue_options_t::none)
 
 Creates a circular_queue.
 
 \param capacity
     Capacity for this queue.
+\param options
+    With \c power_of_two the capacity is rounded up to a power of two, and kept one as the queue
+grows. With \c growable pushing onto a full queue doubles its capacity rather than losing the front
+of the queue. Whatever the options, positions are wrapped by masking when the capacity is a power of
+two.
 */
 /*!
 \fn adobe::circular_queue::size_type adobe::circular_queue::size() const
@@ -141,7 +153,53 @@ inserted.
 
 \post
     If \c full(), the front item of the queue will be lost and the queue will remain full.
-Otherwise, \c size() will be incremented by \c 1.
+Otherwise, \c size() will be incremented by \c 1. A \c growable queue is never full when an
+element is pushed: its capacity is doubled first, losing the elements which could be put back.
+*/
+
+/*!
+\fn void adobe::circular_queue::push_back(value_type&& x)
+
+\param x
+    Moves \c x to the back of the queue, as \c push_back(const value_type&) copies it.
+*/
+
+/*!
+\fn adobe::circular_queue::reference adobe::circular_queue::emplace_back(Args&&... args)
+
+Assigns a \c T constructed from \c args to the back of the queue, as \c push_back() does. When
+a \c growable queue is full the \c T is constructed before the elements are moved to the larger
+queue, so \c args may refer to an element of the queue.
+
+\return
+    A reference to the element at the back of the queue.
+*/
+
+/*!
+\fn I adobe::circular_queue::push_n(I first, size_type n)
+
+Copies the \c n elements starting at \c first to the back of the queue, in at most two contiguous
+runs, as if by \c n calls to \c push_back(). If the queue is not \c growable and the elements
+do not fit, those at the front of the queue, and then those first in the sequence, are lost.
+
+\template_parameters
+    - \c I A model of \ref stldoc_ForwardIterator whose value type is assignable to \c T.
+
+\return
+    \c first advanced by \c n.
+*/
+
+/*!
+\fn O adobe::circular_queue::pop_n(O out, size_type n)
+
+Moves the \c n elements at the front of the queue to \c out, in at most two contiguous runs, and
+removes them. The elements are left moved from, so they should not be returned with \c putback().
+
+\pre
+    <code>n <= size()</code>.
+
+\return
+    \c out advanced by \c n.
 */
 
 /*!
@@ -218,6 +276,21 @@ without throwing. See the requirements for \ref stldoc_Assignable.
 
 /**************************************************************************************************/
 
+/*!
+\ingroup other_container
+
+\brief Options for the capacity of a circular_queue. Combine them with \c |.
+*/
+enum class circular_queue_options_t : unsigned {
+    none = 0,              ///< A fixed capacity, as given.
+    power_of_two = 1 << 0, ///< Round the capacity up to a power of two.
+    growable = 1 << 1      ///< Double the capacity, rather than lose the front, when full.
+};
+
+auto stlab_enable_bitmask_enum(circular_queue_options_t) -> std::true_type;
+
+/**************************************************************************************************/
+
 template <typename T>
 class circular_queue;
 
@@ -233,7 +306,8 @@ void swap(circular_queue<T>&, circular_queue<T>&);
 \ingroup other_container
 
 \brief A queue with a fixed capacity which supports putting back elements. Pushing more elements
-than there is capacity will pop the least recently pushed elements.
+than there is capacity will pop the least recently pushed elements, unless the queue was made
+\c growable.
 
 \template_parameters
     - \c T The queue's value type: the type of object that is stored in the queue.
@@ -256,69 +330,92 @@ public:
     typedef const T& const_reference;
     typedef std::size_t size_type;
 
-    circular_queue(std::size_t capacity = 0);
+    circular_queue(std::size_t capacity = 0,
+                   circular_queue_options_t options = circular_queue_options_t::none);
 
 #if !defined(ADOBE_NO_DOCUMENTATION)
-    circular_queue(const circular_queue& rhs);
+    circular_queue(const circular_queue& rhs) = default;
+    circular_queue(circular_queue&& rhs) noexcept;
 
     circular_queue& operator=(circular_queue rhs);
 #endif // !defined(ADOBE_NO_DOCUMENTATION)
 
-    size_type size() const ADOBE_NOTHROW;
+    size_type size() const ADOBE_NOTHROW { return size_m; }
     size_type max_size() const ADOBE_NOTHROW { return container_m.size(); }
     size_type capacity() const ADOBE_NOTHROW { return container_m.size(); }
 
-    bool empty() const ADOBE_NOTHROW { return is_empty_m; }
-    bool full() const ADOBE_NOTHROW { return !is_empty_m && begin_m == end_m; }
+    bool empty() const ADOBE_NOTHROW { return size_m == 0; }
+    bool full() const ADOBE_NOTHROW { return !empty() && size_m == capacity(); }
 
     void clear() ADOBE_NOTHROW {
-        begin_m = end_m;
-        is_empty_m = true;
+        begin_m = wrap(begin_m + size_m);
+        size_m = 0;
     }
 
     reference front() ADOBE_NOTHROW;
     const_reference front() const ADOBE_NOTHROW;
 
-    void push_back(T x);
+    void push_back(const T& x) { emplace_back(x); }
+    void push_back(T&& x) { emplace_back(std::move(x)); }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+
+    template <typename I>
+    I push_n(I first, size_type n);
 
     void pop_front() ADOBE_NOTHROW;
 
+    template <typename O>
+    O pop_n(O out, size_type n);
+
     void putback() ADOBE_NOTHROW;
 
 #if !defined(ADOBE_NO_DOCUMENTATION)
 private:
     friend inline void swap(circular_queue& x, circular_queue& y) {
+        using std::swap;
+
         swap(x.container_m, y.container_m);
-        std::swap(x.begin_m, y.begin_m);
-        std::swap(x.end_m, y.end_m);
-        swap(x.is_empty_m, y.is_empty_m);
+        swap(x.begin_m, y.begin_m);
+        swap(x.size_m, y.size_m);
+        swap(x.masked_m, y.masked_m);
+        swap(x.options_m, y.options_m);
     }
 
     friend bool operator==<>(const circular_queue& x, const circular_queue& y);
 
     typedef typename std::vector<value_type> container_t;
-    typedef typename container_t::iterator iterator;
     typedef typename container_t::const_iterator const_iterator;
 
-    /* WARNING (sparent) : Order of members is important to initialization */
     container_t container_m;
-    iterator begin_m;
-    iterator end_m;
-    bool is_empty_m;
-    /* WARNING (sparent) : Order of members is important to initialization */
+    size_type begin_m; // the position of the front
+    size_type size_m;
+    bool masked_m; // whether the capacity is a power of two, so positions wrap with a mask
+    circular_queue_options_t options_m;
+
+    bool has(circular_queue_options_t x) const { return (options_m & x) == x; }
+
+    /// The position n, less than twice the capacity, wrapped into the container.
+    size_type wrap(size_type n) const ADOBE_NOTHROW {
+        if (masked_m)
+            return n & (capacity() - 1);
+        return n < capacity() ? n : n - capacity();
+    }
 
-    // Note that these ranges assume non-empty.
+    /// Grows the capacity to at least n, keeping the elements in the queue, then back if any.
+    void reserve(size_type n, T* back = nullptr);
 
     typedef std::pair<const_iterator, const_iterator> const_range;
 
     const_range first_range() const {
-        return const_range(begin_m,
-                           begin_m < end_m ? const_iterator(end_m) : boost::end(container_m));
+        const const_iterator first(container_m.begin() + begin_m);
+        return const_range(first, first + std::min(size_m, capacity() - begin_m));
     }
 
     const_range second_range() const {
-        return const_range(begin_m < end_m ? const_iterator(end_m) : boost::begin(container_m),
-                           end_m);
+        const size_type n(std::min(size_m, capacity() - begin_m));
+        return const_range(container_m.begin(), container_m.begin() + (size_m - n));
     }
 
 #endif // !defined(ADOBE_NO_DOCUMENTATION)
@@ -327,23 +424,26 @@ private:
 /**************************************************************************************************/
 
 template <typename T>
-circular_queue<T>::circular_queue(std::size_t capacity)
-    : container_m(capacity), begin_m(boost::begin(container_m)), end_m(boost::begin(container_m)),
-      is_empty_m(true) {}
+circular_queue<T>::circular_queue(std::size_t capacity, circular_queue_options_t options)
+    : begin_m(0), size_m(0), options_m(options) {
+    if (has(circular_queue_options_t::power_of_two) && capacity)
+        capacity = implementation::bit_ceil(capacity);
+
+    container_m.resize(capacity);
+    masked_m = implementation::has_single_bit(capacity);
+}
 
 #if !defined(ADOBE_NO_DOCUMENTATION)
 
 /**************************************************************************************************/
 
 template <typename T>
-circular_queue<T>::circular_queue(const circular_queue& rhs)
-    : container_m(rhs.capacity()), begin_m(boost::begin(container_m)),
-      end_m(boost::begin(container_m)), is_empty_m(rhs.is_empty_m) {
-    if (is_empty_m)
-        return;
-
-    end_m = copy(rhs.first_range(), end_m);
-    end_m = copy(rhs.second_range(), end_m);
+circular_queue<T>::circular_queue(circular_queue&& rhs) noexcept
+    : container_m(std::move(rhs.container_m)), begin_m(rhs.begin_m), size_m(rhs.size_m),
+      masked_m(rhs.masked_m), options_m(rhs.options_m) {
+    rhs.begin_m = 0;
+    rhs.size_m = 0;
+    rhs.masked_m = false;
 }
 
 /**************************************************************************************************/
@@ -354,13 +454,42 @@ inline circular_queue<T>& circular_queue<T>::operator=(circular_queue rhs) {
     return *this;
 }
 
+/**************************************************************************************************/
+
+template <typename T>
+void circular_queue<T>::reserve(size_type n, T* back) {
+    if (n <= capacity())
+        return;
+
+    size_type capacity(std::max(n, this->capacity() * 2));
+
+    if (has(circular_queue_options_t::power_of_two))
+        capacity = implementation::bit_ceil(capacity);
+
+    container_t container;
+
+    container.reserve(capacity);
+
+    for (size_type i(0); i != size_m; ++i)
+        container.push_back(std::move(container_m[wrap(begin_m + i)]));
+
+    if (back)
+        container.push_back(std::move(*back));
+
+    container.resize(capacity);
+    container_m.swap(container);
+    begin_m = 0;
+    size_m += back ? 1 : 0;
+    masked_m = implementation::has_single_bit(capacity);
+}
+
 #endif // !defined(ADOBE_NO_DOCUMENTATION)
 /**************************************************************************************************/
 
 template <typename T>
 typename circular_queue<T>::reference circular_queue<T>::front() ADOBE_NOTHROW {
     assert(!empty());
-    return *begin_m;
+    return container_m[begin_m];
 }
 
 /**************************************************************************************************/
@@ -368,23 +497,65 @@ typename circular_queue<T>::reference circular_queue<T>::front() ADOBE_NOTHROW {
 template <typename T>
 typename circular_queue<T>::const_reference circular_queue<T>::front() const ADOBE_NOTHROW {
     assert(!empty());
-    return *begin_m;
+    return container_m[begin_m];
 }
 
 /**************************************************************************************************/
 
 template <typename T>
-void circular_queue<T>::push_back(T x) {
-    *end_m = std::move(x);
+template <typename... Args>
+typename circular_queue<T>::reference circular_queue<T>::emplace_back(Args&&... args) {
+    if (size_m == capacity() && has(circular_queue_options_t::growable)) {
+        // args may refer to an element, which reserve() moves, so x is constructed first.
+        T x(std::forward<Args>(args)...);
+
+        reserve(size_m + 1, &x);
+
+        return container_m[size_m - 1];
+    }
+
+    assert(capacity() != 0);
 
-    bool was_full(full());
+    reference result(container_m[wrap(begin_m + size_m)]);
 
-    if (++end_m == boost::end(container_m))
-        end_m = boost::begin(container_m);
-    if (was_full)
-        begin_m = end_m;
+    result = T(std::forward<Args>(args)...);
 
-    is_empty_m = false;
+    if (size_m == capacity())
+        begin_m = wrap(begin_m + 1);
+    else
+        ++size_m;
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+template <typename T>
+template <typename I>
+I circular_queue<T>::push_n(I first, size_type n) {
+    if (has(circular_queue_options_t::growable))
+        reserve(size_m + n);
+
+    if (n > capacity()) {
+        // Only the last capacity() elements of the sequence remain.
+        std::advance(first, n - capacity());
+        n = capacity();
+        size_m = 0;
+    }
+
+    const size_type lost(size_m + n > capacity() ? size_m + n - capacity() : 0);
+    const size_type back(wrap(begin_m + size_m));
+    const size_type run(std::min(n, capacity() - back));
+
+    std::copy_n(first, run, container_m.begin() + back);
+    std::advance(first, run);
+    std::copy_n(first, n - run, container_m.begin());
+    std::advance(first, n - run);
+
+    begin_m = wrap(begin_m + lost);
+    size_m += n - lost;
+
+    return first;
 }
 
 /**************************************************************************************************/
@@ -392,30 +563,35 @@ void circular_queue<T>::push_back(T x) {
 template <typename T>
 void circular_queue<T>::pop_front() ADOBE_NOTHROW {
     assert(!empty());
-    if (++begin_m == boost::end(container_m))
-        begin_m = boost::begin(container_m);
-    is_empty_m = begin_m == end_m;
+    begin_m = wrap(begin_m + 1);
+    --size_m;
 }
 
 /**************************************************************************************************/
 
 template <typename T>
-void circular_queue<T>::putback() ADOBE_NOTHROW {
-    assert(!full());
-    if (begin_m == boost::begin(container_m))
-        begin_m = boost::end(container_m);
-    --begin_m;
-    is_empty_m = false;
+template <typename O>
+O circular_queue<T>::pop_n(O out, size_type n) {
+    assert(n <= size());
+
+    const size_type run(std::min(n, capacity() - begin_m));
+
+    out = std::move(container_m.begin() + begin_m, container_m.begin() + begin_m + run, out);
+    out = std::move(container_m.begin(), container_m.begin() + (n - run), out);
+
+    begin_m = wrap(begin_m + n);
+    size_m -= n;
+
+    return out;
 }
 
 /**************************************************************************************************/
 
 template <typename T>
-typename circular_queue<T>::size_type circular_queue<T>::size() const ADOBE_NOTHROW {
-    if (begin_m < end_m)
-        return std::distance(begin_m, end_m);
-
-    return is_empty_m ? 0 : capacity() - std::distance(end_m, begin_m);
+void circular_queue<T>::putback() ADOBE_NOTHROW {
+    assert(!full());
+    begin_m = wrap(begin_m + capacity() - 1);
+    ++size_m;
 }
 
 /**************************************************************************************************/
@@ -435,7 +611,7 @@ bool operator==(const circular_queue<T>& x, const circular_queue<T>& y) {
     const_range sequence1[] = {x.first_range(), x.second_range()};
     const_range sequence2[] = {y.first_range(), y.second_range()};
 
-    return equal(make_segmented_range(sequence1), make_segmented_iterator(sequence2));
+    return adobe::equal(make_segmented_range(sequence1), make_segmented_iterator(sequence2));
 }
 
 /**************************************************************************************************/
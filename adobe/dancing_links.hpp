@@ -12,6 +12,14 @@
 
 #include <adobe/config.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #if ADOBE_STD_SERIALIZATION
@@ -20,6 +28,7 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <adobe/future.hpp>
 #include <adobe/implementation/toroid.hpp>
 
 #define ADOBE_DLX_VERBOSE 0
@@ -49,23 +58,25 @@ struct do_nothing_callback_t {
 /**************************************************************************************************/
 
 struct select_right_heuristic_t {
-    inline toroid_header_t* operator()(byte_toroid_t& toroid) const {
-        return toroid.right_of(&toroid.header_m);
+    template <typename Toroid>
+    inline typename Toroid::header_pointer_t operator()(Toroid& toroid) const {
+        return toroid.right_of(toroid.header());
     }
 };
 
 /**************************************************************************************************/
 
 struct select_most_constrained_heuristic_t {
-    inline toroid_header_t* operator()(byte_toroid_t& toroid) const {
-        toroid_header_t* c(toroid.right_of(&toroid.header_m));
-        std::size_t sz(c->size_m);
+    template <typename Toroid>
+    inline typename Toroid::header_pointer_t operator()(Toroid& toroid) const {
+        typename Toroid::header_pointer_t c(toroid.right_of(toroid.header()));
+        std::size_t sz(toroid.size_of(c));
 
-        for (toroid_header_t* p(toroid.right_of(c)); p != &toroid.header_m;
+        for (typename Toroid::header_pointer_t p(toroid.right_of(c)); p != toroid.header();
              p = toroid.right_of(p)) {
-            if (p->size_m < sz) {
+            if (toroid.size_of(p) < sz) {
                 c = p;
-                sz = p->size_m;
+                sz = toroid.size_of(p);
             }
 
             if (sz == 1)
@@ -86,11 +97,24 @@ struct select_most_constrained_heuristic_t {
 
 /**************************************************************************************************/
 
-class dancing_links_t : boost::noncopyable {
+/*!
+    \brief Knuth's Algorithm X, an exact cover search, on a toroid of dancing links.
+
+    The toroid is byte_toroid_t, linked by pointer, or compact_toroid_t, linked by 32-bit index.
+    The compact toroid is usually faster and is copyable, which parallel_search() requires.
+*/
+
+template <typename Toroid>
+class basic_dancing_links_t : boost::noncopyable {
 public:
 #ifndef ADOBE_NO_DOCUMENTATION
-    dancing_links_t(std::size_t row_count, std::size_t column_count)
-        : toroid_m(row_count, column_count), output_m(column_count, 0), solutions_m(0)
+    typedef Toroid toroid_t;
+    typedef typename toroid_t::node_pointer_t node_pointer_t;
+    typedef typename toroid_t::header_pointer_t header_pointer_t;
+
+    basic_dancing_links_t(std::size_t row_count, std::size_t column_count)
+        : toroid_m(row_count, column_count), output_m(column_count, node_pointer_t()),
+          solutions_m(0)
 #if ADOBE_DLX_VERBOSE
           ,
           tab_count_m(0)
@@ -112,7 +136,9 @@ public:
 
         toroid_m.finalize();
 
-        do_search(0, callback, heuristic);
+        serial_context_t<ResultCallback> context{*this, callback};
+
+        do_search(toroid_m, output_m, 0, context, heuristic);
 
         return solutions_m;
     }
@@ -122,113 +148,312 @@ public:
                       implementation::select_most_constrained_heuristic_t());
     }
 
+    /*!
+        Searches as search() does, on the adobe::async() pool and this thread. The search tree is
+        split a few levels down into independent subproblems which are taken, in order, by each
+        thread in turn and searched on its own copy of the toroid. Once max_solutions are found
+        the threads stop.
+
+        The callback is called for one solution at a time, under a lock, and the solutions found
+        when max_solutions is reached are not necessarily those search() would find. Each thread
+        has its own copy of the heuristic. If the callback or heuristic throws, the search stops
+        and the exception is rethrown.
+
+        Requires a copyable toroid, such as compact_toroid_t.
+    */
+
+    template <typename ResultCallback, typename SearchHeuristic>
+    std::size_t parallel_search(std::size_t max_solutions, ResultCallback callback,
+                                SearchHeuristic heuristic) {
+        static_assert(std::is_copy_constructible<toroid_t>::value,
+                      "parallel_search() requires a copyable toroid such as compact_toroid_t");
+
+        max_solutions_m = max_solutions;
+
+        toroid_m.finalize();
+
+        typedef parallel_job_t<ResultCallback, SearchHeuristic> job_t;
+
+        job_t job(*this, split(heuristic), std::move(callback), std::move(heuristic));
+
+        /*
+            A worker for each thread, the first searching on toroid_m and the others on copies.
+            for_each_async() leaves this thread to call whichever workers the pool does not start,
+            and those then find every subproblem taken.
+        */
+        const std::size_t workers(std::min<std::size_t>(
+            job.subproblems_m.size(), std::max(1u, std::thread::hardware_concurrency())));
+
+        adobe::for_each_async(workers,
+                              [&](std::size_t i) { job.run(i == 0 ? &toroid_m : nullptr); });
+
+        if (job.error_m)
+            std::rethrow_exception(job.error_m);
+
+        solutions_m = job.solutions_m;
+
+        return solutions_m;
+    }
+
+    inline std::size_t parallel_search(std::size_t max_solutions) {
+        return parallel_search(max_solutions, implementation::do_nothing_callback_t(),
+                               implementation::select_most_constrained_heuristic_t());
+    }
+
 #if ADOBE_STD_SERIALIZATION
-    friend std::ostream& operator<<(std::ostream& s, const dancing_links_t& dancing_links_t) {
+    friend std::ostream& operator<<(std::ostream& s, const basic_dancing_links_t& dancing_links_t) {
         return s << dancing_links_t.toroid_m;
     }
 #endif
 
 private:
+    typedef std::vector<node_pointer_t> prefix_t;
+
+    /*
+        The search tree is split until there are this many subproblems for each thread, so that
+        the threads stay busy when the subtrees differ in size, or until this depth.
+    */
+    enum { subproblems_per_thread_k = 8, split_depth_k = 6 };
+
+    template <typename ResultCallback>
+    struct serial_context_t {
+        basic_dancing_links_t& links_m;
+        ResultCallback& callback_m;
+
+        void solved(toroid_t& toroid, const std::vector<node_pointer_t>& output, std::size_t k) {
+            ++links_m.solutions_m;
+
+            for (std::size_t i(0); i < k; ++i)
+                callback_m(toroid.row_index_of(output[i]), i + 1 == k);
+        }
+
+        bool done() const { return links_m.solutions_m >= links_m.max_solutions_m; }
+    };
+
     template <typename ResultCallback, typename SearchHeuristic>
-    void do_search(std::size_t k, ResultCallback callback, SearchHeuristic heuristic) {
-        if (toroid_m.right_of(&toroid_m.header_m) == &toroid_m.header_m) {
-            ++solutions_m;
+    struct parallel_job_t {
+        parallel_job_t(basic_dancing_links_t& links, std::vector<prefix_t> subproblems,
+                       ResultCallback callback, SearchHeuristic heuristic)
+            : links_m(links), toroid_m(links.toroid_m), subproblems_m(std::move(subproblems)),
+              callback_m(std::move(callback)), heuristic_m(std::move(heuristic)) {}
+
+        /*
+            Searches the subproblems not yet taken until none are left or it is done, on toroid
+            or, if it is null, on a copy of the finalized toroid made once one has been taken.
+        */
+        void run(toroid_t* toroid) {
+            try {
+                std::size_t n(next_m++);
+
+                if (n >= subproblems_m.size() || done())
+                    return;
+
+                std::unique_ptr<toroid_t> copy;
+
+                if (!toroid) {
+                    copy.reset(new toroid_t(toroid_m));
+                    toroid = copy.get();
+                }
+
+                SearchHeuristic heuristic(heuristic_m);
+                std::vector<node_pointer_t> output(links_m.output_m.size(), node_pointer_t());
+
+                for (; n < subproblems_m.size() && !done(); n = next_m++) {
+                    const prefix_t& prefix(subproblems_m[n]);
+
+                    std::copy(prefix.begin(), prefix.end(), output.begin());
+
+                    cover_prefix(*toroid, prefix);
+                    links_m.do_search(*toroid, output, prefix.size(), *this, heuristic);
 
+                    if (done())
+                        break;
+
+                    uncover_prefix(*toroid, prefix);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_m);
+                if (!error_m)
+                    error_m = std::current_exception();
+                stopped_m = true;
+            }
+        }
+
+        void solved(toroid_t& toroid, const std::vector<node_pointer_t>& output, std::size_t k) {
+            std::lock_guard<std::mutex> lock(mutex_m);
+
+            if (done())
+                return;
+
+            for (std::size_t i(0); i < k; ++i)
+                callback_m(toroid.row_index_of(output[i]), i + 1 == k);
+
+            solutions_m.store(solutions_m + 1, std::memory_order_relaxed);
+        }
+
+        bool done() const {
+            return stopped_m.load(std::memory_order_relaxed) ||
+                   solutions_m.load(std::memory_order_relaxed) >= links_m.max_solutions_m;
+        }
+
+        basic_dancing_links_t& links_m;
+        const toroid_t toroid_m; // as finalized, for the helper threads to copy
+        const std::vector<prefix_t> subproblems_m;
+        ResultCallback callback_m;
+        const SearchHeuristic heuristic_m;
+
+        std::atomic<std::size_t> next_m{0};
+        std::atomic<std::size_t> solutions_m{0};
+        std::atomic<bool> stopped_m{false};
+        std::exception_ptr error_m;
+        std::mutex mutex_m;
+    };
+
+    /*
+        Returns the subproblems of the search, as the rows chosen to reach each, in the order
+        search() would visit them. A subproblem which is already solved is kept as it is; one with
+        a column no row can cover is dropped.
+    */
+
+    template <typename SearchHeuristic>
+    std::vector<prefix_t> split(SearchHeuristic& heuristic) {
+        const std::size_t count(subproblems_per_thread_k *
+                                std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<prefix_t> result(1);
+        std::vector<prefix_t> next;
+
+        for (std::size_t depth(0); depth != split_depth_k && result.size() < count; ++depth) {
+            bool branched(false);
+
+            next.clear();
+
+            for (prefix_t& prefix : result) {
+                cover_prefix(toroid_m, prefix);
+
+                if (toroid_m.right_of(toroid_m.header()) == toroid_m.header()) {
+                    next.push_back(prefix);
+                } else {
+                    const header_pointer_t c(heuristic(toroid_m));
+
+                    for (node_pointer_t r(toroid_m.down_of(c)); r != c; r = toroid_m.down_of(r)) {
+                        next.push_back(prefix);
+                        next.back().push_back(r);
+                    }
+
+                    branched = true;
+                }
+
+                uncover_prefix(toroid_m, prefix);
+            }
+
+            result.swap(next);
+
+            if (!branched)
+                break;
+        }
+
+        return result;
+    }
+
+    /// Chooses the rows of prefix in turn, as do_search() does.
+    static void cover_prefix(toroid_t& toroid, const prefix_t& prefix) {
+        for (node_pointer_t r : prefix) {
+            toroid.cover_column(toroid.column_of(r));
+            cover_row(toroid, r);
+        }
+    }
+
+    static void uncover_prefix(toroid_t& toroid, const prefix_t& prefix) {
+        for (auto first(prefix.rbegin()), last(prefix.rend()); first != last; ++first) {
+            uncover_row(toroid, *first);
+            toroid.uncover_column(toroid.column_of(*first));
+        }
+    }
+
+    /// Covers or purifies each node on the same row as r, the node being branched on.
+    static void cover_row(toroid_t& toroid, node_pointer_t r) {
+        for (node_pointer_t j(toroid.right_of(r)); j != r; j = toroid.right_of(j)) {
+            if (toroid.color_of(j) == 0)
+                toroid.cover_column(toroid.column_of(j));
+            else if (toroid.color_of(j) > 0)
+                toroid.purify(j);
+        }
+    }
+
+    static void uncover_row(toroid_t& toroid, node_pointer_t r) {
+        for (node_pointer_t j(toroid.left_of(r)); j != r; j = toroid.left_of(j)) {
+            if (toroid.color_of(j) == 0)
+                toroid.uncover_column(toroid.column_of(j));
+            else if (toroid.color_of(j) > 0)
+                toroid.unpurify(j);
+        }
+    }
+
+    template <typename Context, typename SearchHeuristic>
+    void do_search(toroid_t& toroid, std::vector<node_pointer_t>& output, std::size_t k,
+                   Context& context, SearchHeuristic& heuristic) {
+        if (toroid.right_of(toroid.header()) == toroid.header()) {
 #if ADOBE_DLX_VERBOSE
             std::cout << adobe::indents(tab_count_m) << "<solved/>" << std::endl;
 #endif
 
-            for (std::size_t i(0); i < k; ++i)
-                callback(toroid_m.row_index_of(output_m[i]), i + 1 == k);
+            context.solved(toroid, output, k);
 
             return;
         }
 
         std::size_t next_k(k + 1);
 
-        toroid_header_t* c(heuristic(toroid_m));
+        header_pointer_t c(heuristic(toroid));
 
 #if ADOBE_DLX_VERBOSE
         ++tab_count_m;
         std::cout << adobe::indents(tab_count_m) << "<c"
-                  << toroid_m.column_index_of(toroid_m.down_of(c)) << ">" << std::endl;
+                  << toroid.column_index_of(toroid.down_of(c)) << ">" << std::endl;
 #endif
 
-        toroid_m.cover_column(c);
+        toroid.cover_column(c);
 
         // branch on each node in this column
-        for (toroid_node_t* r(toroid_m.down_of(c)); r != c; r = toroid_m.down_of(r)) {
+        for (node_pointer_t r(toroid.down_of(c)); r != c; r = toroid.down_of(r)) {
 #if ADOBE_DLX_VERBOSE
-            std::cout << adobe::indents(tab_count_m) << "<r" << toroid_m.row_index_of(r) << ">"
+            std::cout << adobe::indents(tab_count_m) << "<r" << toroid.row_index_of(r) << ">"
                       << std::endl;
 #endif
 
-            output_m[k] = r;
+            output[k] = r;
 
-            // cover or purify each node on the same row as the node we're branching on
-            for (toroid_node_t* j(toroid_m.right_of(r)); j != r; j = toroid_m.right_of(j)) {
-                if (j->color_m == 0) {
-#if ADOBE_DLX_VERBOSE
-                    std::cout << adobe::indents(tab_count_m) << "<c" << toroid_m.column_index_of(j)
-                              << ">" << std::endl;
-#endif
-                    toroid_m.cover_column(toroid_m.column_of(j));
-                } else if (j->color_m > 0) {
-#if ADOBE_DLX_VERBOSE
-                    std::cout << adobe::indents(tab_count_m) << "<p" << toroid_m.column_index_of(j)
-                              << ">" << std::endl;
-#endif
-                    toroid_m.purify(j);
-                }
-            }
+            cover_row(toroid, r);
 
-#if ADOBE_DLX_VERBOSE
-// std::cout << *this << std::endl;
-#endif
-
-            do_search(next_k, callback, heuristic);
+            do_search(toroid, output, next_k, context, heuristic);
 
-            if (solutions_m >= max_solutions_m)
+            if (context.done())
                 return;
 
-            r = output_m[k];
+            r = output[k];
 
-            c = toroid_m.column_of(r);
+            c = toroid.column_of(r);
 
             // undo the cover/purify
-            for (toroid_node_t* j(toroid_m.left_of(r)); j != r; j = toroid_m.left_of(j)) {
-                if (j->color_m == 0) {
-#if ADOBE_DLX_VERBOSE
-                    std::cout << adobe::indents(tab_count_m) << "</c" << toroid_m.column_index_of(j)
-                              << ">" << std::endl;
-#endif
-                    toroid_m.uncover_column(toroid_m.column_of(j));
-                } else if (j->color_m > 0) {
-#if ADOBE_DLX_VERBOSE
-                    std::cout << adobe::indents(tab_count_m) << "</p" << toroid_m.column_index_of(j)
-                              << ">" << std::endl;
-#endif
-                    toroid_m.unpurify(j);
-                }
-            }
+            uncover_row(toroid, r);
 
 #if ADOBE_DLX_VERBOSE
-            std::cout << adobe::indents(tab_count_m) << "</r" << toroid_m.row_index_of(r) << ">"
+            std::cout << adobe::indents(tab_count_m) << "</r" << toroid.row_index_of(r) << ">"
                       << std::endl;
 #endif
         }
 
-        toroid_m.uncover_column(c);
+        toroid.uncover_column(c);
 
 #if ADOBE_DLX_VERBOSE
         std::cout << adobe::indents(tab_count_m) << "</c"
-                  << toroid_m.column_index_of(toroid_m.down_of(c)) << ">" << std::endl;
+                  << toroid.column_index_of(toroid.down_of(c)) << ">" << std::endl;
         --tab_count_m;
 #endif
     };
 
-    byte_toroid_t toroid_m;
-    std::vector<toroid_node_t*> output_m;
+    toroid_t toroid_m;
+    std::vector<node_pointer_t> output_m;
     std::size_t solutions_m;
     std::size_t max_solutions_m;
 #if ADOBE_DLX_VERBOSE
@@ -238,6 +463,11 @@ private:
 
 /**************************************************************************************************/
 
+typedef basic_dancing_links_t<byte_toroid_t> dancing_links_t;
+typedef basic_dancing_links_t<compact_toroid_t> compact_dancing_links_t;
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
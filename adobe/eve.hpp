@@ -10,6 +10,9 @@
 
 #include <adobe/config.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <memory>
 #include <utility>
 
 #include <boost/noncopyable.hpp>
@@ -193,6 +196,61 @@ public:
 
     void set_layout_attributes(iterator, const layout_attributes_t&);
 
+    /*!
+    \brief Marks the view as changed, so that the next call to \c evaluate_incremental() measures
+    it again and places it whether or not its place_data_t changes. Call this when the content of
+    a view, such as its text, changes its extents. \c set_visible() and \c set_layout_attributes()
+    mark the view themselves.
+    */
+
+    void invalidate(iterator);
+
+    /*!
+    \brief Selects whether \c evaluate() measures views concurrently. When set, the views whose
+    placeables report \ref adobe::measure_is_thread_safe() are measured in parallel, on the \c
+    adobe::async() pool, before the rest are measured in order; the layout is the same either way.
+    Off by default.
+    */
+
+    void set_concurrent_measure(bool);
+
+    /*!
+    \brief A bounded cache of solved layouts, discarding the least recently used when full.
+
+    A layout is keyed on the structure of the visible views, their measurements and layout
+    attributes, and the options and size requested, and holds the place_data_t of each view. The
+    cache may be shared by several eve_t, so that a dialog which is opened again is not solved
+    again, and by several threads.
+    */
+
+    class layout_cache_t : boost::noncopyable {
+    public:
+        explicit layout_cache_t(std::size_t capacity);
+        ~layout_cache_t();
+
+        std::size_t capacity() const;
+        std::size_t size() const;
+        void clear();
+
+    private:
+        friend class eve_t;
+
+        struct implementation_t;
+        implementation_t* object_m;
+    };
+
+    /*!
+    \brief Selects a cache, or none, for \c evaluate() and \c adjust() to look a layout up in
+    before solving it. When the views, their measurements and attributes, and the arguments
+    match a cached layout, its placements are replayed; otherwise the solved layout is added to
+    the cache. No cache is used by default.
+
+    A two pass placeable is assumed to give the same \c measure_vertical() result whenever its
+    measurement and horizontal placement are the same; a replayed layout does not call it.
+    */
+
+    void set_layout_cache(std::shared_ptr<layout_cache_t>);
+
     /*!
     \brief This call performs the layout, it will call each element to get its dimentions, solve the
     layout, and place each item. Specifying a width and height less than the solved width and height
@@ -211,6 +269,20 @@ public:
 
     std::pair<int, int> evaluate(evaluate_options_t options, int width = 0, int height = 0);
 
+    /*!
+    \brief Performs the layout as \c evaluate() does, but measures only the views marked by \c
+    invalidate(), \c set_visible(), or \c set_layout_attributes() since the last evaluation, calls
+    \c measure_vertical() only on those and the views whose horizontal placement changed, and
+    calls \c place() only on those and the views whose place_data_t changed. If nothing is marked
+    and the arguments match the last evaluation the previous result is returned at once.
+
+    The result is identical to that of \c evaluate() provided every view whose measurements
+    changed has been marked.
+    */
+
+    std::pair<int, int> evaluate_incremental(evaluate_options_t options, int width = 0,
+                                             int height = 0);
+
 
     /*!
 
@@ -239,6 +311,27 @@ public:
     */
     void print_debug(std::ostream& os);
 
+    /*!
+    \brief Counts of the work done by the layouts performed so far, and the time spent in each
+    phase of them.
+    */
+    struct statistics_t {
+        typedef std::chrono::steady_clock::duration duration_t;
+
+        std::size_t solve_passes_m{0}; ///< passes of the guide solver, over either slice
+        std::size_t solve_visits_m{0}; ///< containers solved up or down by the guide solver
+        std::size_t layout_cache_hits_m{0};   ///< layouts replayed from the layout cache
+        std::size_t layout_cache_misses_m{0}; ///< layouts solved and added to the layout cache
+
+        duration_t calculate_time_m{0}; ///< measuring views and totalling their extents
+        duration_t solve_time_m{0};     ///< aligning guides
+        duration_t layout_time_m{0};    ///< distributing space and adjusting outsets
+        duration_t flatten_time_m{0};   ///< converting positions to the coordinate system
+        duration_t place_time_m{0};     ///< placing views, and looking them up in the layout cache
+    };
+
+    const statistics_t& statistics() const;
+
 private:
     friend struct implementation::view_proxy_t;
 
@@ -11,8 +11,10 @@
 #include <adobe/config.hpp>
 
 #include <any>
+#include <filesystem>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <adobe/array.hpp>
@@ -194,6 +196,20 @@ struct eve_callback_suite_t {
 line_position_t parse(std::istream& in, const line_position_t&,
                       const eve_callback_suite_t::position_t&, const eve_callback_suite_t&);
 
+/*
+    Parses source directly from memory, which is considerably faster than parsing from a stream.
+    source must remain valid for the duration of the call.
+*/
+line_position_t parse(std::string_view source, const line_position_t&,
+                      const eve_callback_suite_t::position_t&, const eve_callback_suite_t&);
+
+/*
+    Memory-maps the file at path and parses it in place. The file name is used as the stream name
+    for error reporting.
+*/
+line_position_t parse_file(const std::filesystem::path& path,
+                           const eve_callback_suite_t::position_t&, const eve_callback_suite_t&);
+
 /**************************************************************************************************/
 
 } // namespace adobe
@@ -0,0 +1,180 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_EXACT_COVER_HPP
+#define ADOBE_EXACT_COVER_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include <adobe/dancing_links.hpp>
+#include <adobe/implementation/bit.hpp>
+#include <adobe/implementation/bitset_matrix.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*!
+    \brief An exact cover search with the interface of dancing_links_t over a bitset matrix.
+
+    Choosing a row is an OR and an AND-NOT over a few words for each of its columns rather than the
+    unlinking of every row it conflicts with, but the state of the search is copied at each depth.
+    For problems of up to a few hundred rows and columns, such as n-queens on boards up to 20 by
+    20, it is faster than compact_dancing_links_t; for larger ones, such as sudoku with its 729
+    rows, it is slower. exact_cover_t chooses between the two by the size of the problem.
+
+    Solutions are found in the same order as dancing_links_t finds them, given the same heuristic.
+    A heuristic is called with the bitset_matrix_t, which presents the uncovered primary columns
+    through header(), right_of() and size_of() as byte_toroid_t does.
+*/
+
+class bitset_exact_cover_t : boost::noncopyable {
+public:
+    typedef bitset_matrix_t matrix_t;
+
+    bitset_exact_cover_t(std::size_t row_count, std::size_t column_count)
+        : matrix_m(row_count, column_count), output_m(column_count + 1, 0), solutions_m(0) {}
+
+    inline void set(std::size_t row, std::size_t col, char color = 0) {
+        matrix_m.set(row, col, color);
+    }
+
+    inline void set_secondary_column(std::size_t col) { matrix_m.set_secondary_column(col); }
+
+    template <typename ResultCallback, typename SearchHeuristic>
+    inline std::size_t search(std::size_t max_solutions, ResultCallback callback,
+                              SearchHeuristic heuristic) {
+        max_solutions_m = max_solutions;
+
+        matrix_m.finalize();
+
+        do_search(0, callback, heuristic);
+
+        return solutions_m;
+    }
+
+    inline std::size_t search(std::size_t max_solutions) {
+        return search(max_solutions, implementation::do_nothing_callback_t(),
+                      implementation::select_most_constrained_heuristic_t());
+    }
+
+private:
+    template <typename ResultCallback, typename SearchHeuristic>
+    void do_search(std::size_t k, ResultCallback& callback, SearchHeuristic& heuristic) {
+        if (matrix_m.solved()) {
+            ++solutions_m;
+
+            for (std::size_t i(0); i < k; ++i)
+                callback(output_m[i], i + 1 == k);
+
+            return;
+        }
+
+        matrix_t::header_pointer_t c;
+
+        if constexpr (std::is_same<SearchHeuristic,
+                                   implementation::select_most_constrained_heuristic_t>::value)
+            c = matrix_m.most_constrained();
+        else
+            c = heuristic(matrix_m);
+
+        // branch on each live row in this column, in order
+        for (std::size_t w(0), last(matrix_m.row_word_size()); w != last; ++w) {
+            for (std::uint64_t rows(matrix_m.rows_of(c, w)); rows; rows &= rows - 1) {
+                output_m[k] = w * 64 + implementation::countr_zero(rows);
+
+                matrix_m.choose(output_m[k]);
+                do_search(k + 1, callback, heuristic);
+                matrix_m.unchoose();
+
+                if (solutions_m >= max_solutions_m)
+                    return;
+            }
+        }
+    }
+
+    matrix_t matrix_m;
+    std::vector<std::size_t> output_m;
+    std::size_t solutions_m;
+    std::size_t max_solutions_m;
+};
+
+/**************************************************************************************************/
+
+/*!
+    \brief An exact cover search with the interface of dancing_links_t which uses
+    bitset_exact_cover_t for problems small enough for it and compact_dancing_links_t otherwise.
+
+    A heuristic must accept either the bitset_matrix_t or the compact_toroid_t, as the heuristics
+    in adobe::implementation do.
+*/
+
+class exact_cover_t : boost::noncopyable {
+public:
+    /// The largest problem for which bitset_exact_cover_t is used.
+    enum { bitset_column_limit_k = 256, bitset_row_limit_k = 512 };
+
+    exact_cover_t(std::size_t row_count, std::size_t column_count) {
+        if (column_count <= bitset_column_limit_k && row_count <= bitset_row_limit_k)
+            bitset_m.reset(new bitset_exact_cover_t(row_count, column_count));
+        else
+            links_m.reset(new compact_dancing_links_t(row_count, column_count));
+    }
+
+    /// Whether the problem is searched with bitset_exact_cover_t.
+    bool uses_bitset() const { return bitset_m != nullptr; }
+
+    inline void set(std::size_t row, std::size_t col, char color = 0) {
+        apply([&](auto& x) { x.set(row, col, color); });
+    }
+
+    inline void set_secondary_column(std::size_t col) {
+        apply([&](auto& x) { x.set_secondary_column(col); });
+    }
+
+    template <typename ResultCallback, typename SearchHeuristic>
+    inline std::size_t search(std::size_t max_solutions, ResultCallback callback,
+                              SearchHeuristic heuristic) {
+        return apply([&](auto& x) { return x.search(max_solutions, callback, heuristic); });
+    }
+
+    inline std::size_t search(std::size_t max_solutions) {
+        return apply([&](auto& x) { return x.search(max_solutions); });
+    }
+
+private:
+    template <typename F>
+    auto apply(F f) -> decltype(f(std::declval<bitset_exact_cover_t&>())) {
+        return bitset_m ? f(*bitset_m) : f(*links_m);
+    }
+
+    std::unique_ptr<bitset_exact_cover_t> bitset_m;
+    std::unique_ptr<compact_dancing_links_t> links_m;
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
@@ -17,6 +17,8 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <string_view>
+
 /**************************************************************************************************/
 
 namespace adobe {
@@ -75,6 +77,9 @@ class expression_parser : public boost::noncopyable {
 public:
     expression_parser(std::istream& in, const line_position_t& position);
 
+    // source is parsed in place and must outlive the parser.
+    expression_parser(std::string_view source, const line_position_t& position);
+
     ~expression_parser();
 
     const line_position_t& next_position();
@@ -10,6 +10,7 @@
 
 #include <adobe/config.hpp>
 
+#include <boost/container/small_vector.hpp>
 #include <boost/operators.hpp>
 
 #include <array>
@@ -42,7 +43,12 @@ struct point_2d : boost::equality_comparable<point_2d<T>> {
 
 typedef std::pair<int, int> pair_long_t;
 typedef point_2d<int> point_2d_t;
-typedef std::vector<int> guide_set_t;
+
+/*
+    Nearly every guide set holds no more than two guides, a baseline or a label edge, so they are
+    kept inline and copying one during layout does not allocate.
+*/
+typedef boost::container::small_vector<int, 2> guide_set_t;
 
 // REVISIT (sparent) : points of interest need to be named entities. This will become:
 
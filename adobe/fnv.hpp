@@ -13,12 +13,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 
 #ifndef ADOBE_FNV_NO_BIGINTS
 #include <boost/multiprecision/cpp_int.hpp>
 #endif
 
 #include <adobe/functional/operator.hpp>
+#include <adobe/implementation/bit.hpp>
 
 /**************************************************************************************************/
 /**
@@ -203,7 +205,7 @@ struct fnv_base_traits<1024> {
 template <std::size_t FromBits, std::size_t ToBits>
 struct bitmask {
     template <typename T>
-    inline static T mask(T value) {
+    constexpr static T mask(T value) {
         return value & ((T(1) << ToBits) - 1);
     }
 };
@@ -211,7 +213,7 @@ struct bitmask {
 template <std::size_t SameBits>
 struct bitmask<SameBits, SameBits> {
     template <typename T>
-    inline static T mask(T value) {
+    constexpr static T mask(T value) {
         return value;
     }
 };
@@ -255,7 +257,7 @@ using fnvtype = typename fnv_traits<Bits>::value_type;
     implementation of the algorithm in this header.
 */
 template <std::size_t Bits, typename Iterator, typename Predicate>
-fnvtype<Bits> fnv1a(Iterator first, Predicate p) {
+constexpr fnvtype<Bits> fnv1a(Iterator first, Predicate p) {
     static_assert(sizeof(typename std::iterator_traits<Iterator>::value_type) == 1,
                   "Iterator value_type must be 1 byte.");
 
@@ -279,7 +281,7 @@ fnvtype<Bits> fnv1a(Iterator first, Predicate p) {
     implementation of the algorithm in this header.
 */
 template <std::size_t Bits, typename Iterator>
-inline fnvtype<Bits> fnv1a(Iterator first, Iterator last) {
+constexpr fnvtype<Bits> fnv1a(Iterator first, Iterator last) {
     static_assert(sizeof(typename std::iterator_traits<Iterator>::value_type) == 1,
                   "Iterator value_type must be 1 byte.");
 
@@ -300,12 +302,95 @@ inline fnvtype<Bits> fnv1a(Iterator first, Iterator last) {
     Performs the FNV-1a hash over the specified container.
 */
 template <std::size_t Bits, typename Container>
-inline fnvtype<Bits> fnv1a(Container c) {
+constexpr fnvtype<Bits> fnv1a(Container c) {
     return fnv1a<Bits>(begin(c), end(c));
 }
 
 /**************************************************************************************************/
 
+namespace detail {
+
+/**************************************************************************************************/
+
+/// The n < sizeof(T) bytes at p packed into a T, injectively for a given n.
+template <typename T>
+constexpr T fnv_load_tail(const char* p, std::size_t n) {
+    if constexpr (sizeof(T) == 8) {
+        if (n >= 4)
+            return implementation::load_little_endian<std::uint32_t>(p) |
+                   static_cast<T>(implementation::load_little_endian<std::uint32_t>(p + n - 4))
+                       << 32;
+    }
+
+    if (n == 0)
+        return 0;
+
+    return static_cast<T>(static_cast<unsigned char>(p[0])) |
+           static_cast<T>(static_cast<unsigned char>(p[n >> 1])) << 8 |
+           static_cast<T>(static_cast<unsigned char>(p[n - 1])) << 16;
+}
+
+/// The MurmurHash3 finalizer, so every bit of x reaches every bit of the result.
+constexpr std::uint64_t fnv_finalize(std::uint64_t x) {
+    x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdULL;
+    x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+    return x ^ (x >> 33);
+}
+
+constexpr std::uint32_t fnv_finalize(std::uint32_t x) {
+    x = (x ^ (x >> 16)) * 0x85ebca6bU;
+    x = (x ^ (x >> 13)) * 0xc2b2ae35U;
+    return x ^ (x >> 16);
+}
+
+/**************************************************************************************************/
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+/**
+    \ingroup fnv
+
+    A word at a time variant of FNV-1a for results of up to 64 bits. Where fnv1a folds one byte
+    into the state per multiply, fnv1a_words folds a whole little-endian word the size of the
+    result, rotating the state after each multiply so the high bits of a word are carried into the
+    next. The last partial word and the length are folded in, and the state is finished with the
+    MurmurHash3 finalizer so every input bit reaches the low bits of the result.
+
+    The hash is the same on every platform and folds at compile time for constant keys.
+
+    \note
+    The results are not FNV-1a values; use fnv1a where those are required.
+*/
+template <std::size_t Bits>
+constexpr fnvtype<Bits> fnv1a_words(const char* first, std::size_t n) {
+    static_assert(detail::rollup(Bits) <= 64, "fnv1a_words supports up to 64 bits.");
+
+    typedef fnvtype<Bits> result_type;
+
+    constexpr std::size_t word_size_k = sizeof(result_type);
+    constexpr int rotate_k = static_cast<int>(4 * word_size_k - 1);
+    constexpr result_type prime_k = fnv_traits<Bits>::prime();
+
+    const std::size_t size(n);
+    result_type result(fnv_traits<Bits>::offset_basis());
+
+    for (; n >= word_size_k; n -= word_size_k, first += word_size_k) {
+        const result_type word(implementation::load_little_endian<result_type>(first));
+
+        result = implementation::rotl((result ^ word) * prime_k, rotate_k);
+    }
+
+    result = implementation::rotl(
+        (result ^ detail::fnv_load_tail<result_type>(first, n)) * prime_k, rotate_k);
+    result = detail::fnv_finalize(static_cast<result_type>(result ^ size));
+
+    return detail::bitmask<fnv_traits<Bits>::size(), Bits>::mask(result);
+}
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
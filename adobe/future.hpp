@@ -8,6 +8,8 @@
 #ifndef ADOBE_FUTURE_HPP
 #define ADOBE_FUTURE_HPP
 
+#include <cstddef>
+#include <functional>
 #include <future>
 #include <list>
 #include <memory>
@@ -98,6 +100,19 @@ auto async(const std::chrono::time_point<std::chrono::steady_clock, Duration>& w
 
 /**************************************************************************************************/
 
+/*
+    Calls f(i) for each i in [0, count) on the async() pool and the calling thread, and returns
+    once every call has finished. Calls are claimed in order by whichever thread is free, so the
+    calling thread finishes the work itself if the pool is busy or empty. It is safe to call from
+    a task on the pool.
+
+    f is called concurrently. If a call throws, the calls not yet started are skipped and the
+    first exception is rethrown once the calls started have finished.
+*/
+void for_each_async(std::size_t count, const std::function<void(std::size_t)>& f);
+
+/**************************************************************************************************/
+
 // REVISIT (sparent) : This probably is not the correct place for a concurrent queue
 
 template <typename T>
@@ -27,6 +27,9 @@ public:
 
     adam_parser(std::istream& in, const line_position_t& position);
 
+    adam_parser(std::string_view source, const line_position_t& position,
+                const adam_callback_suite_t& callbacks);
+
     using expression_parser::require_expression; // Export is_expression for client
 
     //  translation_unit = { sheet_specifier }.
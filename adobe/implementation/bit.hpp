@@ -0,0 +1,170 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_IMPLEMENTATION_BIT_HPP
+#define ADOBE_IMPLEMENTATION_BIT_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**************************************************************************************************/
+
+// ADOBE_LITTLE_ENDIAN is 1 where the byte order is known to be little-endian at compile time.
+
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_WIN32)
+#define ADOBE_LITTLE_ENDIAN 1
+#else
+#define ADOBE_LITTLE_ENDIAN 0
+#endif
+
+/**************************************************************************************************/
+
+namespace adobe {
+namespace implementation {
+
+/**************************************************************************************************/
+
+/*
+    C++17 stand-ins for the <bit> functions of C++20, for unsigned integers only. The constexpr
+    functions loop and are meant for constants; countr_zero() uses the compiler's intrinsics.
+*/
+
+/**************************************************************************************************/
+
+/// The number of bits needed to represent x, 0 if x is 0.
+template <typename T>
+constexpr int bit_width(T x) noexcept {
+    static_assert(std::is_unsigned<T>::value, "bit_width requires an unsigned type");
+
+    int result(0);
+    for (; x; x >>= 1)
+        ++result;
+    return result;
+}
+
+/// The smallest power of two not less than x, 1 if x is 0. The result must be representable.
+template <typename T>
+constexpr T bit_ceil(T x) noexcept {
+    static_assert(std::is_unsigned<T>::value, "bit_ceil requires an unsigned type");
+
+    T result(1);
+    while (result < x)
+        result <<= 1;
+    return result;
+}
+
+/// The largest power of two not greater than x, 0 if x is 0.
+template <typename T>
+constexpr T bit_floor(T x) noexcept {
+    static_assert(std::is_unsigned<T>::value, "bit_floor requires an unsigned type");
+
+    return x ? static_cast<T>(T(1) << (bit_width(x) - 1)) : T(0);
+}
+
+/// Whether x is a power of two.
+template <typename T>
+constexpr bool has_single_bit(T x) noexcept {
+    static_assert(std::is_unsigned<T>::value, "has_single_bit requires an unsigned type");
+
+    return x && !(x & (x - 1));
+}
+
+/// x rotated left by s bits, 0 < s < the width of T.
+template <typename T>
+constexpr T rotl(T x, int s) noexcept {
+    static_assert(std::is_unsigned<T>::value, "rotl requires an unsigned type");
+
+    return static_cast<T>(x << s | x >> (std::numeric_limits<T>::digits - s));
+}
+
+/**************************************************************************************************/
+
+/*
+    True during constant evaluation. Where the compiler cannot tell, it is always true, so that
+    callers take their portable path.
+*/
+constexpr bool is_constant_evaluated() noexcept {
+#if (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) ||        \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/// The little-endian T at p, a single load at runtime where the byte order allows it.
+template <typename T>
+constexpr T load_little_endian(const char* p) noexcept {
+    static_assert(std::is_unsigned<T>::value, "load_little_endian requires an unsigned type");
+
+    T result(0);
+
+    if (ADOBE_LITTLE_ENDIAN && !is_constant_evaluated()) {
+        std::memcpy(&result, p, sizeof(T));
+        return result;
+    }
+
+    for (std::size_t i(0); i != sizeof(T); ++i)
+        result |= static_cast<T>(static_cast<unsigned char>(p[i])) << (8 * i);
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+/// The number of trailing zero bits in x, which must not be 0. Compiles to a single instruction.
+template <typename T>
+inline int countr_zero(T x) noexcept {
+    static_assert(std::is_unsigned<T>::value && sizeof(T) <= 8,
+                  "countr_zero requires an unsigned type of at most 64 bits");
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long result;
+
+    if constexpr (sizeof(T) <= 4) {
+        _BitScanForward(&result, static_cast<unsigned long>(x));
+    } else {
+#if defined(_M_X64) || defined(_M_ARM64)
+        _BitScanForward64(&result, x);
+#else
+        if (!_BitScanForward(&result, static_cast<unsigned long>(x))) {
+            _BitScanForward(&result, static_cast<unsigned long>(x >> 32));
+            result += 32;
+        }
+#endif
+    }
+
+    return static_cast<int>(result);
+#else
+    if constexpr (sizeof(T) <= sizeof(unsigned)) {
+        return __builtin_ctz(x);
+    } else {
+        return __builtin_ctzll(x);
+    }
+#endif
+}
+
+/**************************************************************************************************/
+
+} // namespace implementation
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
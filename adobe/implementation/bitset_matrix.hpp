@@ -0,0 +1,332 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_IMPLEMENTATION_BITSET_MATRIX_HPP
+#define ADOBE_IMPLEMENTATION_BITSET_MATRIX_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <adobe/implementation/bit.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*
+    The matrix of an exact cover problem held as bitsets, for bitset_exact_cover_t. Each column
+    has the set of its rows, so that choosing a row removes the rows it conflicts with, those
+    which share one of its columns, with an OR and an AND-NOT over a few words for each of its
+    columns. For the heuristics, the number of live rows in each column is kept up to date by
+    visiting the rows removed.
+
+    The live rows, their counts and the uncovered primary columns are copied for each depth of the
+    search, so that a choice is undone by returning to the depth before it. The copies grow with
+    the number of rows and columns, which is why the matrix suits small problems.
+
+    For the search heuristics it presents the uncovered primary columns as byte_toroid_t does,
+    through header(), right_of() and size_of(), in the same order.
+*/
+
+class bitset_matrix_t {
+public:
+    typedef std::size_t header_pointer_t;
+
+    bitset_matrix_t(std::size_t row_count, std::size_t column_count)
+        : row_count_m(row_count), column_count_m(column_count),
+          row_words_m(word_count(row_count)), column_words_m(word_count(column_count)),
+          rows_of_m(column_count * row_words_m, 0), secondary_m(column_count, false), depth_m(0),
+          finalized_m(false) {}
+
+    void set(std::size_t row, std::size_t col, char color = 0) {
+        assert(row < row_size() && col < column_size());
+        assert(!finalized_m);
+
+        rows_of_m[col * row_words_m + row / 64] |= bit(row);
+        entries_m.push_back(entry_t{static_cast<std::uint32_t>(row),
+                                    static_cast<std::uint32_t>(col),
+                                    static_cast<signed char>(color), no_color_set_k});
+    }
+
+    void set_secondary_column(std::size_t col) {
+        assert(col < column_size());
+        secondary_m[col] = true;
+    }
+
+    void finalize() {
+        assert(!finalized_m);
+
+        // Sort the entries by row, keeping the order they were set in within each row.
+
+        if (!std::is_sorted(entries_m.begin(), entries_m.end(), less_row))
+            std::stable_sort(entries_m.begin(), entries_m.end(), less_row);
+
+        row_begin_m.assign(row_count_m + 1, 0);
+
+        for (const entry_t& e : entries_m)
+            ++row_begin_m[e.row_m + 1];
+
+        for (std::size_t r(0); r != row_count_m; ++r)
+            row_begin_m[r + 1] += row_begin_m[r];
+
+        set_colors();
+
+        // The stacks grow with the search, from the live rows and uncovered columns at depth 0.
+
+        live_m.assign(row_words_m, 0);
+        counts_m.assign(column_count_m, 0);
+        uncovered_m.assign(column_words_m, 0);
+        conflicts_m.resize(row_words_m);
+
+        for (std::size_t r(0); r != row_count_m; ++r)
+            live_m[r / 64] |= bit(r);
+
+        for (const entry_t& e : entries_m)
+            ++counts_m[e.column_m];
+
+        for (std::size_t c(0); c != column_count_m; ++c) {
+            if (!secondary_m[c])
+                uncovered_m[c / 64] |= bit(c);
+        }
+
+        finalized_m = true;
+    }
+
+    /// Whether every primary column is covered at the current depth.
+    bool solved() const {
+        const std::uint64_t* uncovered(uncovered_at(depth_m));
+
+        for (std::size_t w(0); w != column_words_m; ++w) {
+            if (uncovered[w])
+                return false;
+        }
+
+        return true;
+    }
+
+    /// The live rows of column c, at the current depth, numbered from 64 * w.
+    std::uint64_t rows_of(header_pointer_t c, std::size_t w) const {
+        return rows_of_m[c * row_words_m + w] & live_at(depth_m)[w];
+    }
+
+    /// Chooses row r, covering its columns and removing the rows it conflicts with, one deeper.
+    void choose(std::size_t r) {
+        assert(finalized_m);
+
+        if (live_m.size() == (depth_m + 1) * row_words_m) {
+            live_m.resize(live_m.size() + row_words_m);
+            counts_m.resize(counts_m.size() + column_count_m);
+            uncovered_m.resize(uncovered_m.size() + column_words_m);
+        }
+
+        const entry_t* first(&entries_m[0] + row_begin_m[r]);
+        const entry_t* last(&entries_m[0] + row_begin_m[r + 1]);
+
+        std::uint64_t* conflicts(&conflicts_m[0]);
+        std::uint64_t* next_uncovered(uncovered_at(depth_m + 1));
+
+        std::fill_n(conflicts, row_words_m, 0);
+        std::copy_n(uncovered_at(depth_m), column_words_m, next_uncovered);
+
+        for (const entry_t* e(first); e != last; ++e) {
+            const std::uint64_t* rows(&rows_of_m[e->column_m * row_words_m]);
+
+            if (!secondary_m[e->column_m]) {
+                next_uncovered[e->column_m / 64] &= ~bit(e->column_m);
+                or_rows(conflicts, rows);
+            } else if (e->color_m == 0) {
+                or_rows(conflicts, rows);
+            } else if (e->color_m > 0) {
+                // Rows which give the column a different color, or none, conflict.
+                const std::uint64_t* same(&color_sets_m[e->color_set_m * row_words_m]);
+
+                for (std::size_t w(0); w != row_words_m; ++w)
+                    conflicts[w] |= rows[w] & ~same[w];
+            }
+        }
+
+        const std::uint64_t* live(live_at(depth_m));
+        std::uint64_t* next_live(live_at(depth_m + 1));
+        std::uint32_t* next_counts(counts_at(depth_m + 1));
+
+        std::copy_n(counts_at(depth_m), column_count_m, next_counts);
+
+        for (std::size_t w(0); w != row_words_m; ++w) {
+            const std::uint64_t removed(live[w] & conflicts[w]);
+
+            next_live[w] = live[w] ^ removed;
+
+            for (std::uint64_t bits(removed); bits; bits &= bits - 1) {
+                const std::size_t x(w * 64 + implementation::countr_zero(bits));
+
+                for (std::size_t i(row_begin_m[x]), end(row_begin_m[x + 1]); i != end; ++i)
+                    --next_counts[entries_m[i].column_m];
+            }
+        }
+
+        ++depth_m;
+    }
+
+    /// Undoes the last choose().
+    void unchoose() {
+        assert(depth_m != 0);
+        --depth_m;
+    }
+
+    header_pointer_t header() const { return column_count_m; }
+
+    /// The next uncovered primary column after c, or the header after the last.
+    header_pointer_t right_of(header_pointer_t c) const {
+        const std::uint64_t* uncovered(uncovered_at(depth_m));
+        const std::size_t first(c == header() ? 0 : c + 1);
+
+        if (first == column_count_m)
+            return header();
+
+        std::size_t w(first / 64);
+        std::uint64_t bits(uncovered[w] & (~std::uint64_t(0) << (first % 64)));
+
+        while (!bits) {
+            if (++w == column_words_m)
+                return header();
+            bits = uncovered[w];
+        }
+
+        return w * 64 + implementation::countr_zero(bits);
+    }
+
+    /*
+        The first of the uncovered primary columns with the fewest live rows, as
+        select_most_constrained_heuristic_t would choose through right_of() and size_of(), in a
+        single pass over the uncovered columns.
+    */
+    header_pointer_t most_constrained() const {
+        const std::uint64_t* uncovered(uncovered_at(depth_m));
+        const std::uint32_t* counts(counts_at(depth_m));
+        header_pointer_t result(header());
+        std::uint32_t least(~std::uint32_t(0));
+
+        for (std::size_t w(0); w != column_words_m; ++w) {
+            for (std::uint64_t bits(uncovered[w]); bits; bits &= bits - 1) {
+                const std::size_t c(w * 64 + implementation::countr_zero(bits));
+
+                if (counts[c] < least) {
+                    result = c;
+                    least = counts[c];
+
+                    if (least == 0)
+                        return result;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /// The number of live rows in column c.
+    std::size_t size_of(header_pointer_t c) const { return counts_at(depth_m)[c]; }
+
+    std::size_t column_size() const { return column_count_m; }
+    std::size_t row_size() const { return row_count_m; }
+    std::size_t row_word_size() const { return row_words_m; }
+
+private:
+    static constexpr std::uint32_t no_color_set_k = ~std::uint32_t(0);
+
+    struct entry_t {
+        std::uint32_t row_m;
+        std::uint32_t column_m;
+        signed char color_m;
+        std::uint32_t color_set_m; // the rows giving the column the same color, if it has one
+    };
+
+    static bool less_row(const entry_t& x, const entry_t& y) { return x.row_m < y.row_m; }
+
+    static std::size_t word_count(std::size_t bits) { return (bits + 63) / 64; }
+    static std::uint64_t bit(std::size_t n) { return std::uint64_t(1) << (n % 64); }
+
+    void or_rows(std::uint64_t* x, const std::uint64_t* rows) const {
+        for (std::size_t w(0); w != row_words_m; ++w)
+            x[w] |= rows[w];
+    }
+
+    /// Gathers the rows giving each secondary column each color into a set in color_sets_m.
+    void set_colors() {
+        std::vector<entry_t*> colored;
+
+        for (entry_t& e : entries_m) {
+            if (secondary_m[e.column_m] && e.color_m > 0)
+                colored.push_back(&e);
+        }
+
+        std::sort(colored.begin(), colored.end(), [](const entry_t* x, const entry_t* y) {
+            return x->column_m != y->column_m ? x->column_m < y->column_m : x->color_m < y->color_m;
+        });
+
+        for (std::size_t i(0); i != colored.size(); ++i) {
+            if (i == 0 || colored[i]->column_m != colored[i - 1]->column_m ||
+                colored[i]->color_m != colored[i - 1]->color_m)
+                color_sets_m.resize(color_sets_m.size() + row_words_m, 0);
+
+            const std::size_t n(color_sets_m.size() / row_words_m - 1);
+
+            colored[i]->color_set_m = static_cast<std::uint32_t>(n);
+            color_sets_m[n * row_words_m + colored[i]->row_m / 64] |= bit(colored[i]->row_m);
+        }
+    }
+
+    const std::uint64_t* live_at(std::size_t depth) const { return &live_m[depth * row_words_m]; }
+    std::uint64_t* live_at(std::size_t depth) { return &live_m[depth * row_words_m]; }
+
+    const std::uint32_t* counts_at(std::size_t depth) const {
+        return &counts_m[depth * column_count_m];
+    }
+    std::uint32_t* counts_at(std::size_t depth) { return &counts_m[depth * column_count_m]; }
+
+    const std::uint64_t* uncovered_at(std::size_t depth) const {
+        return &uncovered_m[depth * column_words_m];
+    }
+    std::uint64_t* uncovered_at(std::size_t depth) { return &uncovered_m[depth * column_words_m]; }
+
+    std::size_t row_count_m;
+    std::size_t column_count_m;
+    std::size_t row_words_m;
+    std::size_t column_words_m;
+
+    std::vector<std::uint64_t> rows_of_m;    // the rows of each column
+    std::vector<entry_t> entries_m;          // the entries, by row once finalized
+    std::vector<std::size_t> row_begin_m;    // the first entry of each row
+    std::vector<bool> secondary_m;
+    std::vector<std::uint64_t> color_sets_m; // the rows giving a secondary column a color
+
+    std::vector<std::uint64_t> conflicts_m;  // the rows conflicting with the row being chosen
+    std::vector<std::uint32_t> counts_m;     // the live rows in each column, at each depth
+    std::vector<std::uint64_t> live_m;       // the live rows, at each depth
+    std::vector<std::uint64_t> uncovered_m;  // the uncovered primary columns, at each depth
+
+    std::size_t depth_m;
+    bool finalized_m;
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
@@ -0,0 +1,125 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_IMPLEMENTATION_BYTE_SCAN_HPP
+#define ADOBE_IMPLEMENTATION_BYTE_SCAN_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <adobe/implementation/bit.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ADOBE_BYTE_SCAN_SSE2 1
+#include <emmintrin.h>
+#else
+#define ADOBE_BYTE_SCAN_SSE2 0
+#endif
+
+/**************************************************************************************************/
+
+namespace adobe {
+namespace implementation {
+
+/**************************************************************************************************/
+
+/*
+    Scanning helpers for the parsers and filters that look for a few delimiter bytes in long runs
+    of ordinary text. Where SSE2 is available sixteen bytes are tested per step; otherwise each
+    byte is tested in turn.
+*/
+
+/**************************************************************************************************/
+
+#if ADOBE_BYTE_SCAN_SSE2
+
+template <char C, char... Cs>
+inline __m128i byte_scan_match(__m128i block) {
+    const __m128i result(_mm_cmpeq_epi8(block, _mm_set1_epi8(C)));
+
+    if constexpr (sizeof...(Cs) == 0)
+        return result;
+    else
+        return _mm_or_si128(result, byte_scan_match<Cs...>(block));
+}
+
+template <char... Cs>
+inline int byte_scan_mask(const char* p) {
+    return _mm_movemask_epi8(
+        byte_scan_match<Cs...>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+}
+
+#endif
+
+/**************************************************************************************************/
+
+/*!
+    Returns the first position in [first, last) holding one of the bytes Cs, or last.
+*/
+template <char... Cs>
+inline const char* find_first_of_bytes(const char* first, const char* last) {
+    static_assert(sizeof...(Cs) != 0, "find_first_of_bytes requires at least one byte");
+
+#if ADOBE_BYTE_SCAN_SSE2
+    for (; last - first >= 16; first += 16) {
+        if (const int mask = byte_scan_mask<Cs...>(first))
+            return first + countr_zero(static_cast<unsigned>(mask));
+    }
+#endif
+
+    for (; first != last; ++first) {
+        if (((*first == Cs) || ...))
+            return first;
+    }
+
+    return last;
+}
+
+/**************************************************************************************************/
+
+/*!
+    Returns the first position in [first, last) holding a byte with the high bit set, or last.
+*/
+inline const char* find_first_non_ascii(const char* first, const char* last) {
+#if ADOBE_BYTE_SCAN_SSE2
+    for (; last - first >= 16; first += 16) {
+        const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+        if (const int mask = _mm_movemask_epi8(block))
+            return first + countr_zero(static_cast<unsigned>(mask));
+    }
+#else
+    // Eight bytes at a time, the high bits of a word are tested together.
+    for (; last - first >= 8; first += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, first, sizeof(word));
+        if (word & 0x8080808080808080ULL)
+            break;
+    }
+#endif
+
+    for (; first != last; ++first) {
+        if (static_cast<unsigned char>(*first) & 0x80)
+            return first;
+    }
+
+    return last;
+}
+
+/**************************************************************************************************/
+
+} // namespace implementation
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_IMPLEMENTATION_BYTE_SCAN_HPP
+
+/**************************************************************************************************/
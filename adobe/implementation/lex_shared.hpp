@@ -20,9 +20,11 @@
 #include <adobe/string.hpp>
 
 #include <array>
+#include <cassert>
 #include <cstdio>
 #include <functional>
 #include <iostream>
+#include <type_traits>
 
 /**************************************************************************************************/
 
@@ -287,7 +289,12 @@ struct lex_fragment_t {
 
 } // namespace implementation
 
-template <std::size_t S, typename I> // I models InputIterator
+/*
+    D, when not void, is the derived lexer; its parse_token(char) member is called directly for each
+    token instead of going through the parse_token_proc_t set with set_parse_token_proc().
+*/
+
+template <std::size_t S, typename I, typename D = void> // I models InputIterator
 struct stream_lex_base_t {
 public:
     using pos_type = std::istream::pos_type;
@@ -306,6 +313,17 @@ public:
     int peek_char();
     void ignore_char();
 
+    /*
+        When I is a pointer the input is contiguous and may be scanned in bulk. input_first() is
+        the next unread character (any put back characters are already restored to the input) and
+        advance_input() consumes everything up to p, which must be in [input_first(), input_last()].
+    */
+    static constexpr bool is_contiguous_k = std::is_pointer_v<I>;
+
+    I input_first() const { return first_m; }
+    I input_last() const { return last_m; }
+    void advance_input(I p);
+
     void throw_exception(const name_t& expected, const name_t& found);
     void throw_parser_exception(const char* error_string);
     void throw_parser_exception(std::string&& error_string);
@@ -341,20 +359,31 @@ private:
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-stream_lex_base_t<S, I>::stream_lex_base_t(I first, I last, const line_position_t& position)
+template <std::size_t S, typename I, typename D>
+stream_lex_base_t<S, I, D>::stream_lex_base_t(I first, I last, const line_position_t& position)
     : identifier_buffer_m(128), first_m(first), last_m(last), current_position_m(position),
       skip_white_m(true), index_m(0), last_token_m(S) {}
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-stream_lex_base_t<S, I>::~stream_lex_base_t() {}
+template <std::size_t S, typename I, typename D>
+stream_lex_base_t<S, I, D>::~stream_lex_base_t() {}
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-bool stream_lex_base_t<S, I>::get_char(char& c) {
+template <std::size_t S, typename I, typename D>
+bool stream_lex_base_t<S, I, D>::get_char(char& c) {
+    if constexpr (is_contiguous_k) {
+        if (first_m == last_m)
+            return false;
+
+        c = static_cast<char>(*first_m++);
+
+        current_position_m.position_m += 1;
+
+        return true;
+    }
+
     if (index_m) {
         c = static_cast<char>(putback_m[index_m]);
 
@@ -379,17 +408,26 @@ bool stream_lex_base_t<S, I>::get_char(char& c) {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::putback_char(char c) {
-    putback_m[++index_m] = c;
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::putback_char(char c) {
+    if constexpr (is_contiguous_k) {
+        // Only the most recently read character is ever put back, so just step over it again.
+        --first_m;
+        assert(*first_m == c);
+    } else {
+        putback_m[++index_m] = c;
+    }
 
     current_position_m.position_m -= 1;
 }
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-int stream_lex_base_t<S, I>::peek_char() {
+template <std::size_t S, typename I, typename D>
+int stream_lex_base_t<S, I, D>::peek_char() {
+    if constexpr (is_contiguous_k)
+        return first_m == last_m ? EOF : static_cast<unsigned char>(*first_m);
+
     if (index_m)
         return putback_m[index_m];
     else if (first_m == last_m)
@@ -400,9 +438,13 @@ int stream_lex_base_t<S, I>::peek_char() {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::ignore_char() {
-    if (index_m)
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::ignore_char() {
+    if constexpr (is_contiguous_k) {
+        if (first_m == last_m)
+            return;
+        ++first_m;
+    } else if (index_m)
         --index_m;
     else if (first_m == last_m)
         return;
@@ -414,9 +456,20 @@ void stream_lex_base_t<S, I>::ignore_char() {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-const stream_lex_token_t& stream_lex_base_t<S, I>::get_token() {
-    assert(parse_proc_m);
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::advance_input(I p) {
+    static_assert(is_contiguous_k, "advance_input() requires contiguous input.");
+    assert(first_m <= p && p <= last_m);
+
+    current_position_m.position_m += static_cast<std::streamoff>(p - first_m);
+    first_m = p;
+}
+
+/**************************************************************************************************/
+
+template <std::size_t S, typename I, typename D>
+const stream_lex_token_t& stream_lex_base_t<S, I, D>::get_token() {
+    assert(!std::is_void_v<D> || parse_proc_m);
 
     while (last_token_m.empty()) {
         char c;
@@ -440,8 +493,10 @@ const stream_lex_token_t& stream_lex_base_t<S, I>::get_token() {
 
         if (!get_char(c)) // eof
             put_token(stream_lex_token_t(eof_k, any_regular_t()));
-        else
+        else if constexpr (std::is_void_v<D>)
             parse_proc_m(c);
+        else
+            static_cast<D&>(*this).parse_token(c);
     }
 
     stream_lex_token_t& result(last_token_m.front().token_value_m);
@@ -453,23 +508,23 @@ const stream_lex_token_t& stream_lex_base_t<S, I>::get_token() {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::put_token(stream_lex_token_t token) {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::put_token(stream_lex_token_t token) {
     last_token_m.push_back(
         implementation::lex_fragment_t(std::move(token), start_token_position_m));
 }
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::putback_token() {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::putback_token() {
     last_token_m.putback(); // REVISIT (sparent) : Check for overflow
 }
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-const line_position_t& stream_lex_base_t<S, I>::next_position() {
+template <std::size_t S, typename I, typename D>
+const line_position_t& stream_lex_base_t<S, I, D>::next_position() {
     /*
         REVISIT (sparent) : Clean this up - this primes the ring buffer so we can get the next
        position
@@ -482,8 +537,8 @@ const line_position_t& stream_lex_base_t<S, I>::next_position() {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-bool stream_lex_base_t<S, I>::is_line_end(char c) {
+template <std::size_t S, typename I, typename D>
+bool stream_lex_base_t<S, I, D>::is_line_end(char c) {
     using adobe::is_line_end;
 
     std::size_t num_chars_eaten(is_line_end(first_m, last_m, c));
@@ -502,8 +557,8 @@ bool stream_lex_base_t<S, I>::is_line_end(char c) {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::throw_parser_exception(const char* error_string) {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::throw_parser_exception(const char* error_string) {
     using adobe::throw_parser_exception;
 
     throw_parser_exception(error_string, start_token_position_m);
@@ -511,8 +566,8 @@ void stream_lex_base_t<S, I>::throw_parser_exception(const char* error_string) {
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::throw_parser_exception(std::string&& error_string) {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::throw_parser_exception(std::string&& error_string) {
     using adobe::throw_parser_exception;
 
     throw_parser_exception(std::move(error_string), start_token_position_m);
@@ -520,24 +575,41 @@ void stream_lex_base_t<S, I>::throw_parser_exception(std::string&& error_string)
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::set_parse_token_proc(parse_token_proc_t proc) {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::set_parse_token_proc(parse_token_proc_t proc) {
     parse_proc_m = proc;
 }
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::set_skip_white_space(bool skip) {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::set_skip_white_space(bool skip) {
     skip_white_m = skip;
 }
 
 /**************************************************************************************************/
 
-template <std::size_t S, typename I>
-void stream_lex_base_t<S, I>::skip_white_space() {
+template <std::size_t S, typename I, typename D>
+void stream_lex_base_t<S, I, D>::skip_white_space() {
     char c;
 
+    if constexpr (is_contiguous_k) {
+        while (first_m != last_m) {
+            c = *first_m;
+
+            if (c == '\n' || c == '\r') {
+                (void)get_char(c);
+                (void)is_line_end(c);
+            } else if (std::isspace(static_cast<unsigned char>(c))) {
+                ++first_m;
+                current_position_m.position_m += 1;
+            } else {
+                break;
+            }
+        }
+        return;
+    }
+
     while (get_char(c)) {
         // Handle any type of line ending.
         if (!is_line_end(c) && !std::isspace(c)) {
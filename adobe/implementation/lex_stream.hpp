@@ -16,6 +16,7 @@
 #include <adobe/istream.hpp>
 
 #include <iosfwd>
+#include <string_view>
 
 /**************************************************************************************************/
 
@@ -31,6 +32,12 @@ class lex_stream_t {
 public:
     lex_stream_t(std::istream& in, const line_position_t& position);
 
+    /*
+        Lexes source in place, without going through a stream. The characters referenced by source
+        must outlive the lex_stream_t.
+    */
+    lex_stream_t(std::string_view source, const line_position_t& position);
+
 #if !defined(ADOBE_NO_DOCUMENTATION)
     lex_stream_t(const lex_stream_t& rhs);
 
@@ -0,0 +1,465 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_IMPLEMENTATION_SHA_X86_HPP
+#define ADOBE_IMPLEMENTATION_SHA_X86_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ADOBE_SHA_X86 1
+#define ADOBE_SHA_X86_TARGET(features) __attribute__((target(features)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define ADOBE_SHA_X86 1
+#define ADOBE_SHA_X86_TARGET(features)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#define ADOBE_SHA_X86 0
+#endif
+
+/**************************************************************************************************/
+
+#if ADOBE_SHA_X86
+
+/**************************************************************************************************/
+
+namespace adobe {
+namespace implementation {
+
+/**************************************************************************************************/
+
+/*
+    Block kernels for the SHA-1 and SHA-256 compression functions using the x86 SHA extensions,
+    and eight lane kernels using AVX2 which digest one block of eight independent messages at
+    once. The kernels are compiled for their instruction sets with target attributes so the
+    header does not require any compiler flags; callers must check sha_x86_features() first.
+*/
+
+struct sha_x86_features_t {
+    bool sha_m{false};  // SHA extensions and SSE4.1
+    bool avx2_m{false}; // AVX2, with the YMM state enabled by the OS
+};
+
+inline sha_x86_features_t detect_sha_x86_features() {
+    unsigned int leaf_1[4] = {0, 0, 0, 0};
+    unsigned int leaf_7[4] = {0, 0, 0, 0};
+    unsigned int xcr0(0);
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const unsigned int max_leaf(info[0]);
+    __cpuidex(info, 1, 0);
+    for (int i(0); i != 4; ++i)
+        leaf_1[i] = info[i];
+    if (max_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        for (int i(0); i != 4; ++i)
+            leaf_7[i] = info[i];
+    }
+    if (leaf_1[2] & (1u << 27))
+        xcr0 = static_cast<unsigned int>(_xgetbv(0));
+#else
+    const unsigned int max_leaf(__get_cpuid_max(0, nullptr));
+    if (max_leaf >= 1)
+        __cpuid_count(1, 0, leaf_1[0], leaf_1[1], leaf_1[2], leaf_1[3]);
+    if (max_leaf >= 7)
+        __cpuid_count(7, 0, leaf_7[0], leaf_7[1], leaf_7[2], leaf_7[3]);
+    if (leaf_1[2] & (1u << 27)) {
+        unsigned int edx;
+        __asm__("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+    }
+#endif
+
+    sha_x86_features_t result;
+
+    result.sha_m = (leaf_7[1] & (1u << 29)) && (leaf_1[2] & (1u << 19));
+    result.avx2_m = (leaf_7[1] & (1u << 5)) && (xcr0 & 0x6) == 0x6;
+
+    return result;
+}
+
+inline const sha_x86_features_t& sha_x86_features() {
+    static const sha_x86_features_t result(detect_sha_x86_features());
+    return result;
+}
+
+/**************************************************************************************************/
+
+ADOBE_SHA_X86_TARGET("sha,sse4.1")
+inline __m128i sha1_ni_schedule(__m128i w0, __m128i w1, __m128i w2, __m128i w3) {
+    return _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(w0, w1), w2), w3);
+}
+
+// Four rounds; e holds the value of abcd four rounds earlier.
+template <int F>
+ADOBE_SHA_X86_TARGET("sha,sse4.1")
+inline void sha1_ni_rounds(__m128i& abcd, __m128i& e, __m128i w) {
+    const __m128i e_w(_mm_sha1nexte_epu32(e, w));
+    e = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e_w, F);
+}
+
+/*
+    Digests the n 64 byte blocks at p into the five word SHA-1 state.
+*/
+ADOBE_SHA_X86_TARGET("sha,sse4.1")
+inline void sha1_ni_digest_blocks(std::uint32_t* state, const std::uint8_t* p, std::size_t n) {
+    const __m128i byte_swap(_mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL));
+
+    __m128i abcd(_mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1b));
+    __m128i e0(_mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0));
+
+    for (; n != 0; --n, p += 64) {
+        const __m128i abcd_save(abcd);
+        const __m128i e0_save(e0);
+
+        __m128i w0(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0)), byte_swap));
+        __m128i w1(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), byte_swap));
+        __m128i w2(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)), byte_swap));
+        __m128i w3(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48)), byte_swap));
+
+        __m128i e(abcd);
+        abcd = _mm_sha1rnds4_epu32(abcd, _mm_add_epi32(e0, w0), 0);
+        sha1_ni_rounds<0>(abcd, e, w1);
+        sha1_ni_rounds<0>(abcd, e, w2);
+        sha1_ni_rounds<0>(abcd, e, w3);
+
+        w0 = sha1_ni_schedule(w0, w1, w2, w3);
+        sha1_ni_rounds<0>(abcd, e, w0);
+        w1 = sha1_ni_schedule(w1, w2, w3, w0);
+        sha1_ni_rounds<1>(abcd, e, w1);
+        w2 = sha1_ni_schedule(w2, w3, w0, w1);
+        sha1_ni_rounds<1>(abcd, e, w2);
+        w3 = sha1_ni_schedule(w3, w0, w1, w2);
+        sha1_ni_rounds<1>(abcd, e, w3);
+
+        w0 = sha1_ni_schedule(w0, w1, w2, w3);
+        sha1_ni_rounds<1>(abcd, e, w0);
+        w1 = sha1_ni_schedule(w1, w2, w3, w0);
+        sha1_ni_rounds<1>(abcd, e, w1);
+        w2 = sha1_ni_schedule(w2, w3, w0, w1);
+        sha1_ni_rounds<2>(abcd, e, w2);
+        w3 = sha1_ni_schedule(w3, w0, w1, w2);
+        sha1_ni_rounds<2>(abcd, e, w3);
+
+        w0 = sha1_ni_schedule(w0, w1, w2, w3);
+        sha1_ni_rounds<2>(abcd, e, w0);
+        w1 = sha1_ni_schedule(w1, w2, w3, w0);
+        sha1_ni_rounds<2>(abcd, e, w1);
+        w2 = sha1_ni_schedule(w2, w3, w0, w1);
+        sha1_ni_rounds<2>(abcd, e, w2);
+        w3 = sha1_ni_schedule(w3, w0, w1, w2);
+        sha1_ni_rounds<3>(abcd, e, w3);
+
+        w0 = sha1_ni_schedule(w0, w1, w2, w3);
+        sha1_ni_rounds<3>(abcd, e, w0);
+        w1 = sha1_ni_schedule(w1, w2, w3, w0);
+        sha1_ni_rounds<3>(abcd, e, w1);
+        w2 = sha1_ni_schedule(w2, w3, w0, w1);
+        sha1_ni_rounds<3>(abcd, e, w2);
+        w3 = sha1_ni_schedule(w3, w0, w1, w2);
+        sha1_ni_rounds<3>(abcd, e, w3);
+
+        e0 = _mm_sha1nexte_epu32(e, e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1b));
+    state[4] = static_cast<std::uint32_t>(_mm_extract_epi32(e0, 3));
+}
+
+/**************************************************************************************************/
+
+ADOBE_SHA_X86_TARGET("sha,sse4.1")
+inline __m128i sha256_ni_schedule(__m128i w0, __m128i w1, __m128i w2, __m128i w3) {
+    const __m128i w(_mm_add_epi32(_mm_sha256msg1_epu32(w0, w1), _mm_alignr_epi8(w3, w2, 4)));
+    return _mm_sha256msg2_epu32(w, w3);
+}
+
+// Four rounds; state0 holds abef and state1 cdgh.
+ADOBE_SHA_X86_TARGET("sha,sse4.1")
+inline void sha256_ni_rounds(__m128i& state0, __m128i& state1, __m128i w, const std::uint32_t* k) {
+    const __m128i w_k(_mm_add_epi32(w, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k))));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, w_k);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w_k, 0x0e));
+}
+
+/*
+    Digests the n 64 byte blocks at p into the eight word SHA-256 state, k is the table of 64
+    round constants.
+*/
+ADOBE_SHA_X86_TARGET("sha,sse4.1")
+inline void sha256_ni_digest_blocks(std::uint32_t* state,
+                                    const std::uint8_t* p,
+                                    std::size_t n,
+                                    const std::uint32_t* k) {
+    const __m128i byte_swap(_mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL));
+
+    const __m128i dcba(_mm_shuffle_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0xb1)); // cdab
+    const __m128i hgfe(_mm_shuffle_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)), 0x1b)); // efgh
+
+    __m128i state0(_mm_alignr_epi8(dcba, hgfe, 8));    // abef
+    __m128i state1(_mm_blend_epi16(hgfe, dcba, 0xf0)); // cdgh
+
+    for (; n != 0; --n, p += 64) {
+        const __m128i state0_save(state0);
+        const __m128i state1_save(state1);
+
+        __m128i w0(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0)), byte_swap));
+        __m128i w1(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), byte_swap));
+        __m128i w2(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)), byte_swap));
+        __m128i w3(
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48)), byte_swap));
+
+        sha256_ni_rounds(state0, state1, w0, k);
+        sha256_ni_rounds(state0, state1, w1, k + 4);
+        sha256_ni_rounds(state0, state1, w2, k + 8);
+        sha256_ni_rounds(state0, state1, w3, k + 12);
+
+        for (std::size_t t(16); t != 64; t += 16) {
+            w0 = sha256_ni_schedule(w0, w1, w2, w3);
+            sha256_ni_rounds(state0, state1, w0, k + t);
+            w1 = sha256_ni_schedule(w1, w2, w3, w0);
+            sha256_ni_rounds(state0, state1, w1, k + t + 4);
+            w2 = sha256_ni_schedule(w2, w3, w0, w1);
+            sha256_ni_rounds(state0, state1, w2, k + t + 8);
+            w3 = sha256_ni_schedule(w3, w0, w1, w2);
+            sha256_ni_rounds(state0, state1, w3, k + t + 12);
+        }
+
+        state0 = _mm_add_epi32(state0, state0_save);
+        state1 = _mm_add_epi32(state1, state1_save);
+    }
+
+    const __m128i feba(_mm_shuffle_epi32(state0, 0x1b));
+    const __m128i dchg(_mm_shuffle_epi32(state1, 0xb1));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(dchg, feba, 8));
+}
+
+/**************************************************************************************************/
+
+template <int N>
+ADOBE_SHA_X86_TARGET("avx2")
+inline __m256i sha_avx2_rotr(__m256i x) {
+    return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+}
+
+ADOBE_SHA_X86_TARGET("avx2")
+inline __m256i sha_avx2_add(__m256i x, __m256i y) { return _mm256_add_epi32(x, y); }
+
+ADOBE_SHA_X86_TARGET("avx2")
+inline __m256i sha_avx2_xor(__m256i x, __m256i y) { return _mm256_xor_si256(x, y); }
+
+/*
+    Transposes eight rows of eight words so that word i of every row ends up in w[i].
+*/
+ADOBE_SHA_X86_TARGET("avx2")
+inline void sha_avx2_transpose(__m256i* w) {
+    const __m256i t0(_mm256_unpacklo_epi32(w[0], w[1]));
+    const __m256i t1(_mm256_unpackhi_epi32(w[0], w[1]));
+    const __m256i t2(_mm256_unpacklo_epi32(w[2], w[3]));
+    const __m256i t3(_mm256_unpackhi_epi32(w[2], w[3]));
+    const __m256i t4(_mm256_unpacklo_epi32(w[4], w[5]));
+    const __m256i t5(_mm256_unpackhi_epi32(w[4], w[5]));
+    const __m256i t6(_mm256_unpacklo_epi32(w[6], w[7]));
+    const __m256i t7(_mm256_unpackhi_epi32(w[6], w[7]));
+
+    const __m256i u0(_mm256_unpacklo_epi64(t0, t2));
+    const __m256i u1(_mm256_unpackhi_epi64(t0, t2));
+    const __m256i u2(_mm256_unpacklo_epi64(t1, t3));
+    const __m256i u3(_mm256_unpackhi_epi64(t1, t3));
+    const __m256i u4(_mm256_unpacklo_epi64(t4, t6));
+    const __m256i u5(_mm256_unpackhi_epi64(t4, t6));
+    const __m256i u6(_mm256_unpacklo_epi64(t5, t7));
+    const __m256i u7(_mm256_unpackhi_epi64(t5, t7));
+
+    w[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    w[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    w[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    w[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    w[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    w[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    w[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    w[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/*
+    Loads the sixteen big endian words of the 64 byte block at each of p[0] ... p[7], word i of
+    every block into w[i].
+*/
+ADOBE_SHA_X86_TARGET("avx2")
+inline void sha_avx2_load_lanes(const std::uint8_t* const* p, __m256i* w) {
+    const __m256i byte_swap(_mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                             3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    for (std::size_t half(0); half != 2; ++half) {
+        for (std::size_t lane(0); lane != 8; ++lane) {
+            w[half * 8 + lane] = _mm256_shuffle_epi8(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p[lane] + half * 32)),
+                byte_swap);
+        }
+        sha_avx2_transpose(w + half * 8);
+    }
+}
+
+/**************************************************************************************************/
+
+template <int F>
+ADOBE_SHA_X86_TARGET("avx2")
+inline void sha1_avx2_rounds(__m256i* s, __m256i* w, std::size_t first, std::uint32_t k) {
+    const __m256i k_k(_mm256_set1_epi32(static_cast<int>(k)));
+
+    for (std::size_t t(first); t != first + 20; ++t) {
+        __m256i& w_t(w[t & 15]);
+
+        if (t >= 16) {
+            w_t = sha_avx2_rotr<31>(sha_avx2_xor(sha_avx2_xor(w[(t - 3) & 15], w[(t - 8) & 15]),
+                                                 sha_avx2_xor(w[(t - 14) & 15], w_t)));
+        }
+
+        __m256i f;
+        if constexpr (F == 0) // ch
+            f = _mm256_xor_si256(_mm256_and_si256(s[1], s[2]), _mm256_andnot_si256(s[1], s[3]));
+        else if constexpr (F == 2) // maj
+            f = _mm256_or_si256(_mm256_and_si256(s[1], s[2]),
+                                _mm256_and_si256(s[3], _mm256_or_si256(s[1], s[2])));
+        else // parity
+            f = sha_avx2_xor(sha_avx2_xor(s[1], s[2]), s[3]);
+
+        const __m256i temp(sha_avx2_add(sha_avx2_add(sha_avx2_rotr<27>(s[0]), f),
+                                        sha_avx2_add(sha_avx2_add(s[4], k_k), w_t)));
+        s[4] = s[3];
+        s[3] = s[2];
+        s[2] = sha_avx2_rotr<2>(s[1]);
+        s[1] = s[0];
+        s[0] = temp;
+    }
+}
+
+/*
+    Digests one 64 byte block of each of eight messages. state[i][lane] is word i of the SHA-1
+    state of the lane's message, p[lane] its block.
+*/
+ADOBE_SHA_X86_TARGET("avx2")
+inline void sha1_avx2_digest_lanes(std::uint32_t (*state)[8], const std::uint8_t* const* p) {
+    __m256i w[16];
+    __m256i s[5];
+    __m256i save[5];
+
+    sha_avx2_load_lanes(p, w);
+
+    for (std::size_t i(0); i != 5; ++i)
+        save[i] = s[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[i]));
+
+    sha1_avx2_rounds<0>(s, w, 0, 0x5a827999);
+    sha1_avx2_rounds<1>(s, w, 20, 0x6ed9eba1);
+    sha1_avx2_rounds<2>(s, w, 40, 0x8f1bbcdc);
+    sha1_avx2_rounds<1>(s, w, 60, 0xca62c1d6);
+
+    for (std::size_t i(0); i != 5; ++i)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[i]), sha_avx2_add(s[i], save[i]));
+}
+
+/**************************************************************************************************/
+
+/*
+    Digests one 64 byte block of each of eight messages. state[i][lane] is word i of the SHA-256
+    state of the lane's message, p[lane] its block, and k is the table of 64 round constants.
+*/
+ADOBE_SHA_X86_TARGET("avx2")
+inline void sha256_avx2_digest_lanes(std::uint32_t (*state)[8],
+                                     const std::uint8_t* const* p,
+                                     const std::uint32_t* k) {
+    __m256i w[16];
+    __m256i s[8];
+    __m256i save[8];
+
+    sha_avx2_load_lanes(p, w);
+
+    for (std::size_t i(0); i != 8; ++i)
+        save[i] = s[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[i]));
+
+    for (std::size_t t(0); t != 64; ++t) {
+        __m256i& w_t(w[t & 15]);
+
+        if (t >= 16) {
+            const __m256i w_2(w[(t - 2) & 15]);
+            const __m256i w_15(w[(t - 15) & 15]);
+            const __m256i sigma_1(
+                sha_avx2_xor(sha_avx2_xor(sha_avx2_rotr<17>(w_2), sha_avx2_rotr<19>(w_2)),
+                             _mm256_srli_epi32(w_2, 10)));
+            const __m256i sigma_0(
+                sha_avx2_xor(sha_avx2_xor(sha_avx2_rotr<7>(w_15), sha_avx2_rotr<18>(w_15)),
+                             _mm256_srli_epi32(w_15, 3)));
+
+            w_t = sha_avx2_add(sha_avx2_add(sigma_1, w[(t - 7) & 15]), sha_avx2_add(sigma_0, w_t));
+        }
+
+        const __m256i big_sigma_1(
+            sha_avx2_xor(sha_avx2_xor(sha_avx2_rotr<6>(s[4]), sha_avx2_rotr<11>(s[4])),
+                         sha_avx2_rotr<25>(s[4])));
+        const __m256i ch(
+            _mm256_xor_si256(_mm256_and_si256(s[4], s[5]), _mm256_andnot_si256(s[4], s[6])));
+        const __m256i t1(sha_avx2_add(
+            sha_avx2_add(sha_avx2_add(s[7], big_sigma_1), sha_avx2_add(ch, w_t)),
+            _mm256_set1_epi32(static_cast<int>(k[t]))));
+
+        const __m256i big_sigma_0(
+            sha_avx2_xor(sha_avx2_xor(sha_avx2_rotr<2>(s[0]), sha_avx2_rotr<13>(s[0])),
+                         sha_avx2_rotr<22>(s[0])));
+        const __m256i maj(_mm256_or_si256(_mm256_and_si256(s[0], s[1]),
+                                          _mm256_and_si256(s[2], _mm256_or_si256(s[0], s[1]))));
+        const __m256i t2(sha_avx2_add(big_sigma_0, maj));
+
+        s[7] = s[6];
+        s[6] = s[5];
+        s[5] = s[4];
+        s[4] = sha_avx2_add(s[3], t1);
+        s[3] = s[2];
+        s[2] = s[1];
+        s[1] = s[0];
+        s[0] = sha_avx2_add(t1, t2);
+    }
+
+    for (std::size_t i(0); i != 8; ++i)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[i]), sha_avx2_add(s[i], save[i]));
+}
+
+/**************************************************************************************************/
+
+} // namespace implementation
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_SHA_X86
+
+/**************************************************************************************************/
+
+#endif // ADOBE_IMPLEMENTATION_SHA_X86_HPP
+
+/**************************************************************************************************/
@@ -24,7 +24,15 @@ namespace adobe {
 
 class unique_string_pool_t : boost::noncopyable {
 public:
+    typedef std::size_t (*hash_function_t)(const char* str, std::size_t n);
+
+    /*
+        The pool indexes its strings with hash, which must agree with the hashes given to add();
+        a string hasher policy's hash function, e.g. &wyhash_hasher_t::hash, may be passed. The
+        default is the hash of name_t.
+    */
     unique_string_pool_t();
+    explicit unique_string_pool_t(hash_function_t hash);
 
     ~unique_string_pool_t();
 
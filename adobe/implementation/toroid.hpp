@@ -16,7 +16,9 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <list>
+#include <vector>
 
 /**************************************************************************************************/
 
@@ -60,6 +62,9 @@ private:
     typedef col_header_set_t::iterator col_header_set_iterator_t;
 
 public:
+    typedef toroid_node_t* node_pointer_t;
+    typedef toroid_header_t* header_pointer_t;
+
     byte_toroid_t(std::size_t row_count, std::size_t column_count)
         : data_set_m(1, node_block_t()), row_header_set_m(row_count, toroid_header_t()),
           col_header_set_m(column_count, toroid_header_t()), node_block_count_m(0),
@@ -310,6 +315,12 @@ public:
         return node->column_m;
     }
 
+    static inline char color_of(toroid_node_t* node) { return node->color_m; }
+
+    static inline std::size_t size_of(toroid_header_t* column) { return column->size_m; }
+
+    toroid_header_t* header() { return &header_m; }
+
     toroid_header_t header_m;
 
 #if ADOBE_STD_SERIALIZATION
@@ -415,6 +426,233 @@ std::ostream& operator<<(std::ostream& s, const byte_toroid_t& toroid) {
 
 /**************************************************************************************************/
 
+/*
+    A toroid with the same interface as byte_toroid_t which links its nodes by 32-bit offset
+    rather than by pointer. The nodes are held in a single vector, 32 bytes each against the 56 of
+    a toroid_node_t, which keeps more of a search in cache and makes the toroid copyable, so that
+    independent searches can each work on a copy. A link is the byte offset of the node in the
+    vector rather than its index so that following one is a single load.
+
+    Node 0 is the root header and nodes 1 through column_count are the column headers.
+*/
+
+class compact_toroid_t {
+public:
+    typedef std::uint32_t node_pointer_t;
+    typedef std::uint32_t header_pointer_t;
+
+    compact_toroid_t(std::size_t row_count, std::size_t column_count)
+        : node_set_m(column_count + 1), row_set_m(row_count, 0), column_count_m(column_count),
+          finalized_m(false) {
+        const node_pointer_t last(offset_of(column_count));
+
+        for (std::size_t i(0); i <= column_count; ++i) {
+            const node_pointer_t x(offset_of(i));
+            node_t& node(node_set_m[i]);
+
+            node.left_m = x == 0 ? last : x - node_size_k;
+            node.right_m = x == last ? 0 : x + node_size_k;
+            node.up_m = x;
+            node.down_m = x;
+            node.column_m = x;
+            node.row_m = 0;
+            node.size_m = 0;
+            node.color_m = 0;
+        }
+    }
+
+    void set(std::size_t row, std::size_t col, char color = 0) {
+        // prerequisite: as for byte_toroid_t, nodes are set left to right, then top to bottom.
+
+        assert(row < row_size() && col < column_size());
+        assert(!finalized_m);
+        assert(node_set_m.size() < std::uint32_t(-1) / node_size_k);
+
+        const node_pointer_t x(offset_of(node_set_m.size()));
+        const header_pointer_t column(offset_of(col + 1));
+        node_pointer_t& first(row_set_m[row]);
+
+        node_set_m.emplace_back();
+
+        node_t& node(node_set_m.back());
+
+        if (first == 0) {
+            node.left_m = x;
+            node.right_m = x;
+            first = x;
+        } else {
+            node.left_m = at(first).left_m;
+            node.right_m = first;
+            at(node.left_m).right_m = x;
+            at(first).left_m = x;
+        }
+
+        node.up_m = at(column).up_m;
+        node.down_m = column;
+        at(node.up_m).down_m = x;
+        at(column).up_m = x;
+
+        node.column_m = column;
+        node.row_m = static_cast<std::uint32_t>(row);
+        node.size_m = 0;
+        node.color_m = static_cast<signed char>(color);
+
+        ++at(column).size_m;
+    }
+
+    void set_secondary_column(std::size_t col) {
+        assert(col < column_size());
+
+        // Unlinked from the header list, as in byte_toroid_t::set_secondary_column().
+
+        const header_pointer_t column(offset_of(col + 1));
+        node_t& node(at(column));
+
+        at(node.left_m).right_m = node.right_m;
+        at(node.right_m).left_m = node.left_m;
+        node.right_m = column;
+        node.left_m = column;
+    }
+
+    void finalize() {
+        assert(!finalized_m);
+
+        // There are no row headers to unlink.
+
+        finalized_m = true;
+    }
+
+    void cover_column(header_pointer_t c) {
+        assert(finalized_m);
+
+        at(right_of(c)).left_m = left_of(c);
+        at(left_of(c)).right_m = right_of(c);
+
+        for (node_pointer_t i(down_of(c)); i != c; i = down_of(i)) {
+            for (node_pointer_t j(right_of(i)); j != i; j = right_of(j)) {
+                const node_t& node(at(j));
+
+                at(node.down_m).up_m = node.up_m;
+                at(node.up_m).down_m = node.down_m;
+
+                --at(node.column_m).size_m;
+            }
+        }
+    }
+
+    void uncover_column(header_pointer_t c) {
+        assert(finalized_m);
+
+        for (node_pointer_t i(up_of(c)); i != c; i = up_of(i)) {
+            for (node_pointer_t j(left_of(i)); j != i; j = left_of(j)) {
+                const node_t& node(at(j));
+
+                ++at(node.column_m).size_m;
+
+                at(node.down_m).up_m = j;
+                at(node.up_m).down_m = j;
+            }
+        }
+
+        at(right_of(c)).left_m = c;
+        at(left_of(c)).right_m = c;
+    }
+
+    void purify(node_pointer_t p) {
+        const header_pointer_t c(column_of(p));
+        const signed char x(color_of(p));
+
+        at(c).color_m = x;
+
+        for (node_pointer_t rr(down_of(c)); rr != c; rr = down_of(rr)) {
+            if (color_of(rr) != x) {
+                for (node_pointer_t nn(right_of(rr)); nn != rr; nn = right_of(nn)) {
+                    const node_t& node(at(nn));
+
+                    at(node.up_m).down_m = node.down_m;
+                    at(node.down_m).up_m = node.up_m;
+                    --at(node.column_m).size_m;
+                }
+            } else if (rr != p) {
+                at(rr).color_m = -1;
+            }
+        }
+    }
+
+    void unpurify(node_pointer_t p) {
+        const header_pointer_t c(column_of(p));
+        const signed char x(color_of(p));
+
+        for (node_pointer_t rr(up_of(c)); rr != c; rr = up_of(rr)) {
+            if (color_of(rr) < 0) {
+                at(rr).color_m = x;
+            } else if (rr != p) {
+                for (node_pointer_t nn(left_of(rr)); nn != rr; nn = left_of(nn)) {
+                    const node_t& node(at(nn));
+
+                    at(node.up_m).down_m = nn;
+                    at(node.down_m).up_m = nn;
+                    ++at(node.column_m).size_m;
+                }
+            }
+        }
+
+        at(c).color_m = 0;
+    }
+
+    std::size_t column_size() const { return column_count_m; }
+    std::size_t row_size() const { return row_set_m.size(); }
+
+    std::size_t row_index_of(node_pointer_t node) const { return at(node).row_m; }
+    std::size_t column_index_of(node_pointer_t node) const {
+        return at(node).column_m / node_size_k - 1;
+    }
+
+    node_pointer_t left_of(node_pointer_t node) const { return at(node).left_m; }
+    node_pointer_t right_of(node_pointer_t node) const { return at(node).right_m; }
+    node_pointer_t up_of(node_pointer_t node) const { return at(node).up_m; }
+    node_pointer_t down_of(node_pointer_t node) const { return at(node).down_m; }
+    header_pointer_t column_of(node_pointer_t node) const { return at(node).column_m; }
+    signed char color_of(node_pointer_t node) const { return at(node).color_m; }
+    std::size_t size_of(header_pointer_t column) const { return at(column).size_m; }
+
+    header_pointer_t header() const { return 0; }
+
+private:
+    struct node_t {
+        std::uint32_t left_m;
+        std::uint32_t right_m;
+        std::uint32_t up_m;
+        std::uint32_t down_m;
+        std::uint32_t column_m; // header at the head of this column
+        std::uint32_t row_m;    // index of the row, for reporting solutions
+        std::uint32_t size_m;   // number of 1s in the column, for a column header
+        signed char color_m;
+    };
+
+    enum { node_size_k = sizeof(node_t) };
+
+    static node_pointer_t offset_of(std::size_t index) {
+        return static_cast<node_pointer_t>(index * node_size_k);
+    }
+
+    node_t& at(node_pointer_t x) {
+        return *reinterpret_cast<node_t*>(reinterpret_cast<char*>(node_set_m.data()) + x);
+    }
+
+    const node_t& at(node_pointer_t x) const {
+        return *reinterpret_cast<const node_t*>(reinterpret_cast<const char*>(node_set_m.data()) +
+                                                x);
+    }
+
+    std::vector<node_t> node_set_m;
+    std::vector<node_pointer_t> row_set_m; // the first node of each row, 0 until set
+    std::size_t column_count_m;
+    bool finalized_m;
+};
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
@@ -13,6 +13,9 @@
 
 #include <array>
 
+#include <boost/container/small_vector.hpp>
+#include <boost/operators.hpp>
+
 /*!
 \defgroup layout_attributes Layout Attributes
 \ingroup layout_library
@@ -68,7 +71,7 @@ struct layout_attributes_t
         spacing_m[1] = 10; /* REVISIT FIXED VALUE container_spacing */
     }
 
-    typedef std::vector<int> spacing_t;
+    typedef boost::container::small_vector<int, 2> spacing_t;
 
     struct slice_t {
         slice_t()
@@ -114,10 +117,11 @@ struct layout_attributes_t
 */
 struct place_data_t
 #if !defined(ADOBE_NO_DOCUMENTATION)
-    : extents_slices_t
+    : extents_slices_t,
+      boost::equality_comparable<place_data_t>
 #endif
 {
-    struct slice_t {
+    struct slice_t : boost::equality_comparable<slice_t> {
 #if !defined(ADOBE_NO_DOCUMENTATION)
         slice_t();
 #endif
@@ -126,10 +130,19 @@ struct place_data_t
         int position_m;
         pair_long_t outset_m;
         guide_set_t guide_set_m;
+
+        friend inline bool operator==(const slice_t& x, const slice_t& y) {
+            return x.length_m == y.length_m && x.position_m == y.position_m &&
+                   x.outset_m == y.outset_m && x.guide_set_m == y.guide_set_m;
+        }
     };
 
     std::array<slice_t, 2> slice_m;
 
+    friend inline bool operator==(const place_data_t& x, const place_data_t& y) {
+        return x.slice_m == y.slice_m;
+    }
+
     slice_t& vertical() { return slice_m[extents_slices_t::vertical]; }
     slice_t& horizontal() { return slice_m[extents_slices_t::horizontal]; }
 
@@ -0,0 +1,65 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_MAPPED_FILE_HPP
+#define ADOBE_MAPPED_FILE_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+#include <boost/noncopyable.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*!
+\ingroup utility
+
+\brief A read-only, memory-mapped view of the contents of a file.
+
+The file is mapped for the lifetime of the mapped_file_t. Views obtained from it are invalidated
+when it is destroyed. An empty file yields an empty view.
+
+\exception std::system_error if the file cannot be opened or mapped.
+*/
+
+class mapped_file_t : boost::noncopyable {
+public:
+    explicit mapped_file_t(const std::filesystem::path& path);
+
+    ~mapped_file_t();
+
+    const char* data() const { return data_m; }
+    std::size_t size() const { return size_m; }
+
+    const char* begin() const { return data_m; }
+    const char* end() const { return data_m + size_m; }
+
+    std::string_view view() const { return std::string_view(data_m, size_m); }
+
+private:
+    const char* data_m{nullptr};
+    std::size_t size_m{0};
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
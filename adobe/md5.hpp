@@ -11,9 +11,12 @@
 
 #include <adobe/config.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
 
 /**************************************************************************************************/
 
@@ -72,9 +75,10 @@ Type used to store the digest result of an MD5 hash
 */
 
 /*!
-\fn void adobe::md5_t::update(void* input_block, std::size_t input_length)
+\fn void adobe::md5_t::update(const void* input_block, std::size_t input_length)
 
-Includes a block of data in the MD5 hash being performed.
+Includes a block of data in the MD5 hash being performed. Whole 64 byte blocks are digested
+straight from input_block; only a partial block is buffered.
 
 \param input_block  The block of data to be hashed
 \param input_length Length in bytes of the input data
@@ -97,11 +101,57 @@ public:
 
     md5_t();
 
-    void update(void* input_block, std::size_t input_length);
+    void update(const void* input_block, std::size_t input_length);
 
     digest_t final();
 
+    /*!
+        Digests each of the messages in [first, last), writing the digests in order to result. On
+        processors with AVX2 eight messages are digested at once, a block of each in every step,
+        which is several times faster than digesting small messages one at a time.
+
+        \pre Each message must provide <code>data()</code> and <code>size()</code> of a
+        contiguous range of bytes, such as <code>std::string</code> or
+        <code>std::string_view</code>. The messages are read in batches after the iterator has
+        moved past them, so <code>*first</code> must refer to stable storage rather than a
+        temporary, and the bytes must remain valid until the call returns.
+
+        \return The end of the digests written to result
+    */
+    template <typename I, // I models ForwardIterator
+              typename O> // O models OutputIterator
+    static O digest_each(I first, I last, O result) {
+        static_assert(std::is_base_of<std::forward_iterator_tag,
+                                      typename std::iterator_traits<I>::iterator_category>::value,
+                      "digest_each requires a ForwardIterator.");
+
+        constexpr std::size_t batch_size_k = 64;
+
+        const std::uint8_t* data[batch_size_k];
+        std::size_t size[batch_size_k];
+        digest_t digests[batch_size_k];
+
+        while (first != last) {
+            std::size_t n(0);
+
+            for (; n != batch_size_k && first != last; ++n, ++first) {
+                static_assert(sizeof(*std::data(*first)) == 1, "Messages must supply bytes.");
+
+                data[n] = reinterpret_cast<const std::uint8_t*>(std::data(*first));
+                size[n] = std::size(*first);
+            }
+
+            digest_batch(data, size, n, digests);
+            result = std::copy(digests, digests + n, result);
+        }
+
+        return result;
+    }
+
 private:
+    static void digest_batch(const std::uint8_t* const* data, const std::size_t* size,
+                             std::size_t count, digest_t* result);
+
     void reset();
 
     std::uint32_t state_m[4];  /* state (ABCD) */
@@ -121,7 +171,7 @@ Quick and dirty MD5 hash function for a single input block
 
 \return An MD5 digest of the input block for the length specified
 */
-inline md5_t::digest_t md5(void* input_block, std::size_t input_length) {
+inline md5_t::digest_t md5(const void* input_block, std::size_t input_length) {
     md5_t m;
 
     m.update(input_block, input_length);
@@ -23,7 +23,7 @@
 
 // asl
 #include <adobe/conversion.hpp>
-#include <adobe/fnv.hpp>
+#include <adobe/string_hash.hpp>
 
 /**
     \defgroup name name_t and static_name_t
@@ -51,39 +51,20 @@ namespace detail {
 
 /**************************************************************************************************/
 
-constexpr std::size_t sizesz_k = sizeof(std::size_t);
-
-constexpr bool sizeok_k = sizesz_k == 8 || sizesz_k == 4;
-
-constexpr std::size_t name_fnv_prime_k =
-    sizesz_k == 8 ? static_cast<std::size_t>(0x100000001b3) : static_cast<std::size_t>(0x1000193);
-
-constexpr std::size_t name_fnv_basis_k = sizesz_k == 8
-                                             ? static_cast<std::size_t>(0xcbf29ce484222325ULL)
-                                             : static_cast<std::size_t>(0x811c9dc5);
-
-constexpr std::size_t name_hash(const char* str, std::size_t len, std::size_t n,
-                                std::size_t state) {
-    static_assert(sizeok_k, "Unknown sizeof std::size_t (must be 4 or 8).");
-
-    return n < len ? name_hash(str, len, n + 1,
-                               (state ^ static_cast<std::size_t>(str[n])) * name_fnv_prime_k)
-                   : state;
-}
+// static_name_t hashes are folded into every translation unit and must agree with the library's.
+using name_hasher_t = fnv1a_hasher_t;
 
 constexpr std::size_t name_hash(const char* str, std::size_t len) {
-    static_assert(sizeok_k, "Unknown sizeof std::size_t (must be 4 or 8).");
-
-    return name_hash(str, len, 0, name_fnv_basis_k);
+    return name_hasher_t::hash(str, len);
 }
 
 template <std::size_t N>
 constexpr std::size_t name_hash(const char (&str)[N]) {
-    static_assert(sizeok_k, "Unknown sizeof std::size_t (must be 4 or 8).");
-
     return name_hash(str, N - 1);
 }
 
+constexpr std::size_t name_hash(std::string_view str) { return name_hash(str.data(), str.size()); }
+
 /**************************************************************************************************/
 
 } // namespace detail
@@ -152,7 +133,11 @@ struct static_name_t {
 
     /// @brief Return the hash value of the name_t
     /// @return hash value of the name_t
-    std::size_t hash() const { return hash_m; }
+    constexpr std::size_t hash() const { return hash_m; }
+
+    /// @brief Return the string the static_name_t was created from
+    /// @return pointer to the null-terminated string literal
+    constexpr const char* c_str() const { return string_m; }
 
 private:
     static_name_t() = delete;
@@ -0,0 +1,202 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_PARSE_BATCH_HPP
+#define ADOBE_PARSE_BATCH_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <adobe/adam_parser.hpp>
+#include <adobe/array.hpp>
+#include <adobe/eve_parser.hpp>
+#include <adobe/istream.hpp>
+#include <adobe/name.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*!
+\brief A source to be parsed by parse_adam_batch() or parse_eve_batch().
+
+The text must remain valid until the batch call returns. The stream name of position_m is used for
+error reporting.
+*/
+
+struct parse_source_t {
+    std::string_view text_m;
+    line_position_t position_m;
+};
+
+/**************************************************************************************************/
+
+/*!
+\brief The callbacks made while parsing one Adam source, recorded for later replay.
+
+Each call is kept as the arguments it was made with. If parsing failed the record holds the calls
+made before the error, and replay() rethrows the error after making them, exactly as a direct
+parse would have.
+
+An exception thrown by a callback during replay is reported as a stream_error_t at the position of
+the recorded call, as eve_parse_record_t::replay() reports it.
+*/
+
+struct adam_parse_record_t {
+    struct cell_t {
+        adam_callback_suite_t::cell_type_t type_m;
+        name_t name_m;
+        line_position_t position_m;
+        array_t expression_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct relation_t {
+        line_position_t position_m;
+        array_t conditional_m;
+        std::vector<adam_callback_suite_t::relation_t> relations_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct interface_t {
+        name_t name_m;
+        bool linked_m;
+        line_position_t initializer_position_m;
+        array_t initializer_m;
+        line_position_t expression_position_m;
+        array_t expression_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct external_t {
+        name_t name_m;
+        line_position_t position_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    using call_t = std::variant<cell_t, relation_t, interface_t, external_t>;
+
+    void replay(const adam_callback_suite_t& callbacks) const;
+
+    bool failed() const { return static_cast<bool>(error_m); }
+
+    std::vector<call_t> calls_m;
+    std::exception_ptr error_m;
+};
+
+/**************************************************************************************************/
+
+/*!
+\brief The callbacks made while parsing one Eve source, recorded for later replay.
+
+Views are replayed in parse order and each add_view_proc_m call is passed the position returned
+when its parent view was replayed. A view's parent is the index of the parent's call in calls_m,
+or root_view_k for the position passed to replay(). replay() returns the line position the parse
+ended at.
+
+An exception thrown by a callback during replay is reported as a stream_error_t at the position of
+the recorded call.
+*/
+
+struct eve_parse_record_t {
+    static constexpr std::size_t root_view_k = std::size_t(-1);
+
+    struct view_t {
+        std::size_t parent_m;
+        line_position_t position_m;
+        name_t name_m;
+        array_t parameters_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct cell_t {
+        eve_callback_suite_t::cell_type_t type_m;
+        name_t name_m;
+        line_position_t position_m;
+        array_t initializer_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct relation_t {
+        line_position_t position_m;
+        array_t conditional_m;
+        std::vector<eve_callback_suite_t::relation_t> relations_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct interface_t {
+        name_t name_m;
+        bool linked_m;
+        line_position_t initializer_position_m;
+        array_t initializer_m;
+        line_position_t expression_position_m;
+        array_t expression_m;
+        std::string brief_m;
+        std::string detailed_m;
+    };
+
+    struct finalize_t {};
+
+    using call_t = std::variant<view_t, cell_t, relation_t, interface_t, finalize_t>;
+
+    line_position_t replay(const eve_callback_suite_t::position_t& position,
+                           const eve_callback_suite_t& callbacks) const;
+
+    bool failed() const { return static_cast<bool>(error_m); }
+
+    std::vector<call_t> calls_m;
+    line_position_t end_position_m;
+    std::exception_ptr error_m;
+};
+
+/**************************************************************************************************/
+
+/*
+    Parses one source into a record. Parse errors are held in the record rather than thrown.
+*/
+adam_parse_record_t parse_adam_record(const parse_source_t& source);
+eve_parse_record_t parse_eve_record(const parse_source_t& source);
+
+/*
+    Parses each source concurrently on the adobe::async pool. The records are returned in the
+    order of the sources; replaying them in that order into a single callback suite is equivalent
+    to parsing the sources one after another.
+*/
+std::vector<adam_parse_record_t> parse_adam_batch(const std::vector<parse_source_t>& sources);
+std::vector<adam_parse_record_t>
+parse_adam_batch(const std::vector<std::filesystem::path>& paths);
+
+std::vector<eve_parse_record_t> parse_eve_batch(const std::vector<parse_source_t>& sources);
+std::vector<eve_parse_record_t> parse_eve_batch(const std::vector<std::filesystem::path>& paths);
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_PARSE_BATCH_HPP
+
+/**************************************************************************************************/
@@ -0,0 +1,89 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_PARSE_CACHE_HPP
+#define ADOBE_PARSE_CACHE_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <adobe/parse_batch.hpp>
+#include <adobe/sha.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*
+    A parse image is a compact binary form of a successful parse record. Every name is stored once
+    in a table at the head of the image and referred to by index; expressions are stored as tagged
+    values. An image is tagged with the key of the source it was made from, a SHA-256 of the stream
+    name and the source text.
+
+    Positions in a loaded record carry the stream name and line information but no getline
+    procedure, as is the case for positions from parse_file().
+*/
+
+using parse_cache_key_t = sha256_t::digest_type;
+
+parse_cache_key_t parse_cache_key(std::string_view stream_name, std::string_view source);
+
+/*
+    Returns the image of record. Throws std::invalid_argument if the record failed or holds a value
+    of a type that cannot be stored.
+*/
+std::string make_parse_image(const adam_parse_record_t& record, const parse_cache_key_t& key);
+std::string make_parse_image(const eve_parse_record_t& record, const parse_cache_key_t& key);
+
+/*
+    Loads an image into result. Returns false, leaving result unspecified, if image is not an
+    intact image of the right kind made with key.
+*/
+bool read_parse_image(std::string_view image, const parse_cache_key_t& key,
+                      adam_parse_record_t& result);
+bool read_parse_image(std::string_view image, const parse_cache_key_t& key,
+                      eve_parse_record_t& result);
+
+/**************************************************************************************************/
+
+/*
+    Returns the parse record of the file at path. If cache_directory holds an image for the
+    current contents of the file it is memory-mapped and loaded, otherwise the text is parsed and,
+    if the parse succeeded, an image is written for the next call. Images are named by their key,
+    so an edited source never matches a stale image.
+*/
+adam_parse_record_t parse_adam_cached(const std::filesystem::path& path,
+                                      const std::filesystem::path& cache_directory);
+eve_parse_record_t parse_eve_cached(const std::filesystem::path& path,
+                                    const std::filesystem::path& cache_directory);
+
+/*
+    As parse_adam_batch() and parse_eve_batch(), loading each file through the cache.
+*/
+std::vector<adam_parse_record_t>
+parse_adam_batch(const std::vector<std::filesystem::path>& paths,
+                 const std::filesystem::path& cache_directory);
+std::vector<eve_parse_record_t> parse_eve_batch(const std::vector<std::filesystem::path>& paths,
+                                                const std::filesystem::path& cache_directory);
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_PARSE_CACHE_HPP
+
+/**************************************************************************************************/
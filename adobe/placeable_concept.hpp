@@ -9,6 +9,8 @@
 
 /************************************************************************************************/
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 #include <boost/concept_check.hpp>
 
@@ -201,6 +203,44 @@ inline void place(T& t, const place_data_t& place_data) {
 
 /**************************************************************************************************/
 
+namespace detail {
+
+template <class T, class = void>
+struct has_measure_is_thread_safe : std::false_type {};
+
+template <class T>
+struct has_measure_is_thread_safe<
+    T, std::void_t<decltype(std::declval<const T&>().measure_is_thread_safe())>> : std::true_type {
+};
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+/*!
+
+\ingroup placeable_concept
+
+Returns true if measure (and measure_vertical, for a two pass placeable object) may be called on
+this placeable object while other threads call them on other placeable objects for which this
+function returns true. Eve can then measure such placeable objects in parallel when asked to with
+eve_t::set_concurrent_measure().
+
+The default implementation calls the member function on T of the same name if there is one and
+returns false otherwise. Can be specialized or overloaded for user types.
+
+*/
+
+template <class T>
+inline bool measure_is_thread_safe(const T& t) {
+    if constexpr (detail::has_measure_is_thread_safe<T>::value)
+        return t.measure_is_thread_safe();
+    else
+        return false;
+}
+
+/**************************************************************************************************/
+
 /*!
 
 \ingroup placeable_concept
@@ -223,6 +263,11 @@ struct PlaceableConcept {
         place(t, place_data); // unqualified to allow user versions
     }
 
+    static bool measure_is_thread_safe(const T& t) {
+        using adobe::measure_is_thread_safe;
+        return measure_is_thread_safe(t);
+    }
+
     // Concept checking:
 
     void constraints() {
@@ -259,6 +304,10 @@ struct PlaceableConcept<T*> : public PlaceableConcept<T> {
         PlaceableConcept<T>::place(*r, place_data);
     }
 
+    static bool measure_is_thread_safe(const T* r) {
+        return PlaceableConcept<T>::measure_is_thread_safe(*r);
+    }
+
 #if !defined(ADOBE_NO_DOCUMENTATION)
     void constraints() {
         // boost concept check lib gets confused on VC8 without this
@@ -351,6 +400,9 @@ struct PlaceableTwoPassConcept<T*> : PlaceableTwoPassConcept<T> {
     static void place(T* r, const place_data_t& place_data) {
         PlaceableTwoPassConcept<T>::place(*r, place_data);
     }
+    static bool measure_is_thread_safe(const T* r) {
+        return PlaceableTwoPassConcept<T>::measure_is_thread_safe(*r);
+    }
     static void measure_vertical(T* r, extents_t& calculated_horizontal,
                                  const place_data_t& placed_horizontal) {
         PlaceableTwoPassConcept<T>::measure_vertical(*r, calculated_horizontal, placed_horizontal);
@@ -37,6 +37,7 @@ namespace adobe {
 struct poly_placeable_interface : poly_copyable_interface {
     virtual void measure(extents_t& result) = 0;
     virtual void place(const place_data_t& place_data) = 0;
+    virtual bool measure_is_thread_safe() const = 0;
 };
 
 /**************************************************************************************************/
@@ -62,6 +63,10 @@ struct poly_placeable_instance : optimized_storage_type<T, poly_placeable_interf
     void place(const place_data_t& place_data) {
         PlaceableConcept<T>::place(this->get(), place_data);
     }
+
+    bool measure_is_thread_safe() const {
+        return PlaceableConcept<T>::measure_is_thread_safe(this->get());
+    }
 };
 
 
@@ -85,6 +90,8 @@ struct placeable : public poly_base<poly_placeable_interface, poly_placeable_ins
     void measure(extents_t& result) { interface_ref().measure(result); }
 
     void place(const place_data_t& place_data) { interface_ref().place(place_data); }
+
+    bool measure_is_thread_safe() const { return interface_ref().measure_is_thread_safe(); }
 };
 
 /**************************************************************************************************/
@@ -139,6 +146,10 @@ struct poly_placeable_twopass_instance
     void place(const place_data_t& place_data) {
         PlaceableTwoPassConcept<T>::place(this->get(), place_data);
     }
+
+    bool measure_is_thread_safe() const {
+        return PlaceableTwoPassConcept<T>::measure_is_thread_safe(this->get());
+    }
 };
 
 /**************************************************************************************************/
@@ -162,6 +173,8 @@ struct placeable_twopass
     }
 
     void place(const place_data_t& place_data) { interface_ref().place(place_data); }
+
+    bool measure_is_thread_safe() const { return interface_ref().measure_is_thread_safe(); }
 };
 
 /**************************************************************************************************/
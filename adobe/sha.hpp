@@ -10,14 +10,18 @@
 
 /**************************************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <adobe/cassert.hpp>
+#include <adobe/implementation/sha_x86.hpp>
 
 /**************************************************************************************************/
 
@@ -435,6 +439,47 @@ typename HashTraits::digest_type finalize(typename HashTraits::message_block_typ
 
 /**************************************************************************************************/
 
+template <typename T>
+inline T load_big_endian(const std::uint8_t* p) {
+    T result(0);
+
+    for (std::size_t i(0); i != sizeof(T); ++i)
+        result = (result << 8) | p[i];
+
+    return result;
+}
+
+template <typename T>
+inline void store_big_endian(T x, std::uint8_t* p) {
+    for (std::size_t i(sizeof(T)); i != 0; x >>= 8)
+        p[--i] = static_cast<std::uint8_t>(x);
+}
+
+/*
+Digests n whole message blocks from the contiguous bytes at p, without going through a byte source
+or the running message block. This is the portable kernel behind HashTraits::digest_blocks.
+*/
+template <typename HashTraits>
+void digest_blocks_portable(typename HashTraits::state_digest_type& digest, const std::uint8_t* p,
+                            std::size_t n) {
+    typedef typename HashTraits::message_block_type message_block_type;
+    typedef typename message_block_type::value_type value_type;
+
+    message_block_type message_block;
+    std::uint16_t stuffed_size(0);
+
+    for (; n != 0; --n) {
+        for (auto& element : message_block) {
+            element = load_big_endian<value_type>(p);
+            p += sizeof(value_type);
+        }
+
+        HashTraits::digest_message_block_portable(digest, message_block, stuffed_size);
+    }
+}
+
+/**************************************************************************************************/
+
 template <typename HashTraits>
 void sha_2_digest_message_block(typename HashTraits::state_digest_type& digest,
                                 typename HashTraits::message_block_type& message_block,
@@ -512,9 +557,54 @@ struct sha1_traits_t {
         return {{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0}};
     }
 
+    static inline void digest_blocks(state_digest_type& digest, const std::uint8_t* p,
+                                     std::size_t n) {
+#if ADOBE_SHA_X86
+        if (sha_x86_features().sha_m)
+            return sha1_ni_digest_blocks(digest.data(), p, n);
+#endif
+        digest_blocks_portable<sha1_traits_t>(digest, p, n);
+    }
+
+#if ADOBE_SHA_X86
+    static constexpr std::size_t lane_count_k = 8;
+
+    // A single SHA extensions kernel outruns eight AVX2 lanes.
+    static inline bool prefer_lanes() {
+        return sha_x86_features().avx2_m && !sha_x86_features().sha_m;
+    }
+
+    static inline void digest_lanes(std::uint32_t (*state)[lane_count_k],
+                                    const std::uint8_t* const* p) {
+        sha1_avx2_digest_lanes(state, p);
+    }
+#else
+    static constexpr std::size_t lane_count_k = 1;
+#endif
+
     static inline void digest_message_block(state_digest_type& digest,
                                             message_block_type& message_block,
                                             std::uint16_t& stuffed_size) {
+#if ADOBE_SHA_X86
+        if (sha_x86_features().sha_m) {
+            std::uint8_t block[64];
+
+            for (std::size_t i(0); i != message_block.size(); ++i)
+                store_big_endian(message_block[i], block + i * 4);
+
+            sha1_ni_digest_blocks(digest.data(), block, 1);
+
+            message_block = {{0}};
+            stuffed_size = 0;
+            return;
+        }
+#endif
+        digest_message_block_portable(digest, message_block, stuffed_size);
+    }
+
+    static inline void digest_message_block_portable(state_digest_type& digest,
+                                                     message_block_type& message_block,
+                                                     std::uint16_t& stuffed_size) {
         schedule_type schedule;
         constexpr std::uint_fast8_t schedule_size = static_cast<std::uint_fast8_t>(schedule.size());
 
@@ -594,9 +684,54 @@ struct sha256_traits_t {
     static inline void digest_message_block(state_digest_type& digest,
                                             message_block_type& message_block,
                                             std::uint16_t& stuffed_size) {
+#if ADOBE_SHA_X86
+        if (sha_x86_features().sha_m) {
+            std::uint8_t block[64];
+
+            for (std::size_t i(0); i != message_block.size(); ++i)
+                store_big_endian(message_block[i], block + i * 4);
+
+            sha256_ni_digest_blocks(digest.data(), block, 1, k_set_k.data());
+
+            message_block = {{0}};
+            stuffed_size = 0;
+            return;
+        }
+#endif
+        digest_message_block_portable(digest, message_block, stuffed_size);
+    }
+
+    static inline void digest_message_block_portable(state_digest_type& digest,
+                                                     message_block_type& message_block,
+                                                     std::uint16_t& stuffed_size) {
         sha_2_digest_message_block<sha256_traits_t>(digest, message_block, stuffed_size);
     }
 
+    static inline void digest_blocks(state_digest_type& digest, const std::uint8_t* p,
+                                     std::size_t n) {
+#if ADOBE_SHA_X86
+        if (sha_x86_features().sha_m)
+            return sha256_ni_digest_blocks(digest.data(), p, n, k_set_k.data());
+#endif
+        digest_blocks_portable<sha256_traits_t>(digest, p, n);
+    }
+
+#if ADOBE_SHA_X86
+    static constexpr std::size_t lane_count_k = 8;
+
+    // A single SHA extensions kernel outruns eight AVX2 lanes.
+    static inline bool prefer_lanes() {
+        return sha_x86_features().avx2_m && !sha_x86_features().sha_m;
+    }
+
+    static inline void digest_lanes(std::uint32_t (*state)[lane_count_k],
+                                    const std::uint8_t* const* p) {
+        sha256_avx2_digest_lanes(state, p, k_set_k.data());
+    }
+#else
+    static constexpr std::size_t lane_count_k = 1;
+#endif
+
     static inline std::uint32_t big_sigma_0(std::uint32_t x) {
         return implementation::rotr<2>(x) ^ implementation::rotr<13>(x) ^
                implementation::rotr<22>(x);
@@ -616,22 +751,22 @@ struct sha256_traits_t {
                implementation::shr<10>(x);
     }
 
-    static inline std::uint32_t k(std::size_t t) {
-        static const std::uint32_t k_set[] = {
-            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
-            0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
-            0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
-            0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-            0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
-            0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
-            0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
-            0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
-            0xc67178f2};
+    static constexpr std::array<std::uint32_t, 64> k_set_k = {
+        {0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+         0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+         0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+         0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+         0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+         0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+         0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+         0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+         0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+         0xc67178f2}};
 
+    static inline std::uint32_t k(std::size_t t) {
         assert(t < 64);
 
-        return k_set[t];
+        return k_set_k[t];
     }
 };
 
@@ -669,6 +804,19 @@ struct sha512_traits_t {
         sha_2_digest_message_block<sha512_traits_t>(digest, message_block, stuffed_size);
     }
 
+    static inline void digest_message_block_portable(state_digest_type& digest,
+                                                     message_block_type& message_block,
+                                                     std::uint16_t& stuffed_size) {
+        sha_2_digest_message_block<sha512_traits_t>(digest, message_block, stuffed_size);
+    }
+
+    static inline void digest_blocks(state_digest_type& digest, const std::uint8_t* p,
+                                     std::size_t n) {
+        digest_blocks_portable<sha512_traits_t>(digest, p, n);
+    }
+
+    static constexpr std::size_t lane_count_k = 1;
+
     static inline std::uint64_t big_sigma_0(std::uint64_t x) {
         return implementation::rotr<28>(x) ^ implementation::rotr<34>(x) ^
                implementation::rotr<39>(x);
@@ -736,6 +884,149 @@ struct sha384_traits_t : public sha512_traits_t {
     }
 };
 
+/**************************************************************************************************/
+/*
+Multi-buffer digest of the messages [first, last) into result. Each of the traits' lanes digests a
+message block by block; the final block(s), with the 1-bit, padding, and length, are prepared up
+front in the lane's tail buffer. When a lane finishes its message it picks up the next one, so
+messages of different lengths keep all the lanes busy until the last few. A lone message left at
+the end is finished with the single buffer kernel.
+*/
+template <typename HashTraits, typename I, typename O>
+O digest_lanes(I first, I last, O result) {
+    typedef HashTraits traits_type;
+    typedef typename traits_type::state_digest_type state_digest_type;
+    typedef typename traits_type::digest_type digest_type;
+
+    constexpr std::size_t lane_count_k = traits_type::lane_count_k;
+    constexpr std::size_t word_count_k = std::tuple_size<state_digest_type>::value;
+    constexpr std::size_t block_size_k = traits_type::message_blocksize_k / 8;
+
+    static_assert(traits_type::max_message_bitsize_k == 64, "lanes require a 64-bit length.");
+
+    struct lane_t {
+        const std::uint8_t* data_m;   // the next block to digest
+        std::size_t blocks_m;         // the blocks left at data_m
+        std::size_t tail_blocks_m;    // the blocks in tail_m, once data_m is done
+        std::size_t index_m;          // of the message in [first, last)
+        std::uint8_t tail_m[2 * block_size_k];
+    };
+
+    std::vector<digest_type> digests(static_cast<std::size_t>(std::distance(first, last)));
+    std::uint32_t state[word_count_k][lane_count_k];
+    lane_t lanes[lane_count_k] = {};
+    const std::uint8_t* blocks[lane_count_k];
+    std::size_t index(0);
+    std::size_t active(0);
+
+    // Starts the next message in the lane, if there is one.
+    auto start = [&](lane_t& lane, std::size_t n) {
+        if (first == last) {
+            lane.blocks_m = 0;
+            return;
+        }
+
+        const auto& message(*first);
+        static_assert(sizeof(*std::data(message)) == sizeof(std::uint8_t),
+                      "Messages must supply bytes.");
+
+        const std::uint8_t* data(reinterpret_cast<const std::uint8_t*>(std::data(message)));
+        const std::uint64_t size(std::size(message));
+        const std::size_t remainder(size % block_size_k);
+
+        std::memset(lane.tail_m, 0, sizeof(lane.tail_m));
+        if (remainder)
+            std::memcpy(lane.tail_m, data + (size - remainder), remainder);
+        lane.tail_m[remainder] = 0x80;
+
+        lane.tail_blocks_m = remainder + 1 + 8 <= block_size_k ? 1 : 2;
+
+        std::uint8_t* length(lane.tail_m + lane.tail_blocks_m * block_size_k);
+        for (std::uint64_t bits(size * 8); bits != 0; bits >>= 8)
+            *--length = static_cast<std::uint8_t>(bits);
+
+        lane.data_m = data;
+        lane.blocks_m = size / block_size_k;
+        if (lane.blocks_m == 0) {
+            lane.data_m = lane.tail_m;
+            lane.blocks_m = lane.tail_blocks_m;
+            lane.tail_blocks_m = 0;
+        }
+        lane.index_m = index++;
+
+        const state_digest_type initial(traits_type::initial_state());
+        for (std::size_t i(0); i != word_count_k; ++i)
+            state[i][n] = initial[i];
+
+        ++first;
+        ++active;
+    };
+
+    auto finish = [&](const state_digest_type& digest, std::size_t i) {
+        std::memcpy(&digests[i][0], &digest[0], sizeof(digest_type));
+    };
+
+    for (std::size_t n(0); n != lane_count_k; ++n)
+        start(lanes[n], n);
+
+    while (active != 0) {
+        if (active == 1 && first == last) {
+            for (std::size_t n(0); n != lane_count_k; ++n) {
+                lane_t& lane(lanes[n]);
+
+                if (lane.blocks_m == 0)
+                    continue;
+
+                state_digest_type digest;
+                for (std::size_t i(0); i != word_count_k; ++i)
+                    digest[i] = state[i][n];
+
+                traits_type::digest_blocks(digest, lane.data_m, lane.blocks_m);
+                if (lane.tail_blocks_m)
+                    traits_type::digest_blocks(digest, lane.tail_m, lane.tail_blocks_m);
+
+                finish(digest, lane.index_m);
+            }
+            break;
+        }
+
+        // Idle lanes digest their stale tail, the result is never used.
+        for (std::size_t n(0); n != lane_count_k; ++n)
+            blocks[n] = lanes[n].blocks_m ? lanes[n].data_m : lanes[n].tail_m;
+
+        traits_type::digest_lanes(state, blocks);
+
+        for (std::size_t n(0); n != lane_count_k; ++n) {
+            lane_t& lane(lanes[n]);
+
+            if (lane.blocks_m == 0)
+                continue;
+
+            lane.data_m += block_size_k;
+
+            if (--lane.blocks_m != 0)
+                continue;
+
+            if (lane.tail_blocks_m) {
+                lane.data_m = lane.tail_m;
+                lane.blocks_m = lane.tail_blocks_m;
+                lane.tail_blocks_m = 0;
+                continue;
+            }
+
+            state_digest_type digest;
+            for (std::size_t i(0); i != word_count_k; ++i)
+                digest[i] = state[i][n];
+
+            finish(digest, lane.index_m);
+            --active;
+            start(lane, n);
+        }
+    }
+
+    return std::copy(digests.begin(), digests.end(), result);
+}
+
 /**************************************************************************************************/
 
 #endif
@@ -798,6 +1089,9 @@ public:
     \param first first iterator over the range to digest
     \param last  last iterator over the range to digest
 
+    \note When \c I is a pointer the range is digested as by
+          <code>update(const void* data, std::size_t size)</code>.
+
     \note While the SHA standard specifies the ability to process messages up to
           2^128 bits, this routine is limited to
           `sizeof(std::iterator_traits<I>::difference_type) * 8` bits. A
@@ -809,9 +1103,57 @@ public:
         // We can only update if the current state is byte aligned
         assert(stuffed_size_m % 8 == 0);
 
-        implementation::byte_source_iterators<I> byte_source(first, last);
-        implementation::block_and_digest<traits_type>(state_m, stuffed_size_m, message_size_m,
-                                                      state_digest_m, byte_source);
+        if constexpr (std::is_pointer<I>::value) {
+            static_assert(sizeof(*first) == sizeof(std::uint8_t), "Iterator must supply bytes.");
+
+            update(static_cast<const void*>(first), static_cast<std::size_t>(last - first));
+        } else {
+            implementation::byte_source_iterators<I> byte_source(first, last);
+            implementation::block_and_digest<traits_type>(state_m, stuffed_size_m, message_size_m,
+                                                          state_digest_m, byte_source);
+        }
+    }
+
+    /**
+    \ingroup sha
+
+    This routine can be called successively to digest a data over one or more
+    steps. Whole message blocks are digested straight from the buffer, using
+    the SHA extensions of the processor where they are available.
+
+    \param data first byte of the contiguous range to digest
+    \param size number of <i>bytes</i> to digest
+
+    \note A typed pointer selects <code>update(I first, std::uint64_t num_bits)</code>
+          instead; convert it to <code>const void*</code> to call this routine.
+    */
+    inline void update(const void* data, std::size_t size) {
+        // We can only update if the current state is byte aligned
+        assert(stuffed_size_m % 8 == 0);
+
+        constexpr std::size_t block_size_k = traits_type::message_blocksize_k / 8;
+
+        const std::uint8_t* p(static_cast<const std::uint8_t*>(data));
+
+        // Top up a partially stuffed message block first.
+        if (stuffed_size_m != 0) {
+            const std::size_t n(std::min(size, block_size_k - stuffed_size_m / 8));
+
+            update_bytes(p, n);
+            p += n;
+            size -= n;
+        }
+
+        if (size >= block_size_k) {
+            const std::size_t blocks(size / block_size_k);
+
+            traits_type::digest_blocks(state_digest_m, p, blocks);
+            message_size_m += static_cast<std::uint64_t>(blocks) * block_size_k * 8;
+            p += blocks * block_size_k;
+            size -= blocks * block_size_k;
+        }
+
+        update_bytes(p, size);
     }
 
     /**
@@ -826,6 +1168,9 @@ public:
     \param first first iterator over the range to digest
     \param num_bits number of bits to digest
 
+    \note When \c I is a pointer the whole bytes are digested as by
+          <code>update(const void* data, std::size_t size)</code>.
+
     \note While the SHA standard specifies the ability to process messages up to
           2^128 bits, this routine is limited to messages of 2^64 bits in length.
 
@@ -837,6 +1182,14 @@ public:
         // We can only update if the current state is byte aligned
         assert(stuffed_size_m % 8 == 0);
 
+        if constexpr (std::is_pointer<I>::value) {
+            const std::size_t size(static_cast<std::size_t>(num_bits / 8));
+
+            update(static_cast<const void*>(first), size);
+            first += size;
+            num_bits %= 8;
+        }
+
         implementation::byte_source_iterator_n<I> byte_source(first, num_bits);
         implementation::block_and_digest<traits_type>(state_m, stuffed_size_m, message_size_m,
                                                       state_digest_m, byte_source);
@@ -904,6 +1257,40 @@ public:
         return instance.finalize();
     }
 
+    /**
+    \ingroup sha
+
+    Digests each of the messages in [first, last), writing the digests in
+    order to result. On processors with AVX2 but without the SHA extensions,
+    SHA-1 and SHA-256 digest eight messages at once, a block of each in every
+    step, which is several times faster than digesting them one at a time.
+
+    \pre
+        Each message must provide <code>data()</code> and <code>size()</code>
+        of a contiguous range of bytes, such as <code>std::string</code> or
+        <code>std::string_view</code>. The bytes must remain valid until the
+        call returns.
+
+    \return The end of the digests written to result
+    */
+    template <typename I, // I models ForwardIterator
+              typename O> // O models OutputIterator
+    static O digest_each(I first, I last, O result) {
+        if constexpr (traits_type::lane_count_k > 1) {
+            if (traits_type::prefer_lanes())
+                return implementation::digest_lanes<traits_type>(first, last, result);
+        }
+
+        for (; first != last; ++first, ++result) {
+            sha instance;
+
+            instance.update(static_cast<const void*>(std::data(*first)), std::size(*first));
+            *result = instance.finalize();
+        }
+
+        return result;
+    }
+
     /**
     Returns the finalized digest as an ASCII string.
 
@@ -946,6 +1333,13 @@ public:
 
 #ifndef ADOBE_NO_DOCUMENTATION
 private:
+    void update_bytes(const std::uint8_t* p, std::size_t size) {
+        implementation::byte_source_iterator_n<const std::uint8_t*> byte_source(
+            p, static_cast<std::uint64_t>(size) * 8);
+        implementation::block_and_digest<traits_type>(state_m, stuffed_size_m, message_size_m,
+                                                      state_digest_m, byte_source);
+    }
+
     // ordered to try and maximize fastest cache alignment. This
     // could be improved.
     std::uint64_t message_size_m;
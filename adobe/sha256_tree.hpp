@@ -0,0 +1,135 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_SHA256_TREE_HPP
+#define ADOBE_SHA256_TREE_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <adobe/mapped_file.hpp>
+#include <adobe/sha.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*!
+\ingroup sha
+
+\brief A SHA-256 tree hash of large content, computed in parallel.
+
+The content is split into leaves of leaf_size() bytes, the last of which may be shorter; empty
+content is a single empty leaf. The leaves are digested concurrently on the adobe::async pool and
+combined pairwise, level by level, into a Merkle tree. A node without a sibling at the end of a
+level is carried up unchanged. Every digest is domain separated by a leading byte:
+
+- a leaf is the SHA-256 of <code>0x00 || bytes</code>,
+- an interior node is the SHA-256 of <code>0x01 || left || right</code>,
+- the tree digest is the SHA-256 of <code>0x02 || size || leaf_size || root</code>, with the sizes
+  as 64-bit big-endian integers,
+
+so a leaf cannot be passed off as a node, and trees of the same content with different leaf sizes
+have different digests. The tree digest is not the SHA-256 of the content.
+
+Once built, a single leaf can be verified or updated without rehashing the rest of the content,
+and proof() gives the sibling digests needed to check one leaf against the tree digest alone.
+*/
+
+class sha256_tree_t {
+public:
+    typedef sha256_t::digest_type digest_type;
+
+    static constexpr std::size_t default_leaf_size_k = 1024 * 1024;
+
+    /*!
+        Constructs the tree of empty content.
+
+        \pre leaf_size is not zero.
+    */
+    explicit sha256_tree_t(std::size_t leaf_size = default_leaf_size_k);
+
+    /*!
+        Replaces the content of the tree with the size bytes at data, digesting the leaves in
+        parallel. The bytes are only read during the call.
+    */
+    void assign(const void* data, std::size_t size);
+
+    /*!
+        Replaces the content of the tree with the contents of file. The leaves are digested
+        straight from the mapping, without copying.
+    */
+    void assign(const mapped_file_t& file) { assign(file.data(), file.size()); }
+
+    std::size_t leaf_size() const { return leaf_size_m; }
+    std::uint64_t size() const { return size_m; }
+    std::size_t leaf_count() const { return levels_m.front().size(); }
+
+    const digest_type& leaf(std::size_t i) const { return levels_m.front()[i]; }
+
+    /*!
+        \return The tree digest of the content.
+    */
+    digest_type digest() const;
+
+    /*!
+        \return true if the size bytes at data are the content of leaf i.
+    */
+    bool verify_leaf(std::size_t i, const void* data, std::size_t size) const;
+
+    /*!
+        Replaces the content of leaf i with the size bytes at data and updates the digests on the
+        path to the root.
+
+        \exception std::out_of_range if i is not a leaf of the tree.
+        \exception std::invalid_argument if size is not leaf_size(), or for the last leaf, from 1
+        to leaf_size() (or 0 when it is the only leaf).
+    */
+    void update_leaf(std::size_t i, const void* data, std::size_t size);
+
+    /*!
+        \return The digests of the siblings on the path from leaf i to the root, lowest first.
+    */
+    std::vector<digest_type> proof(std::size_t i) const;
+
+    /*!
+        \return The digest of a leaf holding the size bytes at data.
+    */
+    static digest_type leaf_digest(const void* data, std::size_t size);
+
+    /*!
+        Checks that leaf i, with the digest leaf, is part of the content with the tree digest
+        digest, given the size and leaf size of that content and the proof() of the leaf.
+    */
+    static bool verify_proof(const digest_type& digest, std::uint64_t size, std::size_t leaf_size,
+                             std::size_t i, const digest_type& leaf,
+                             const std::vector<digest_type>& proof);
+
+private:
+    void build_nodes();
+
+    std::size_t leaf_size_m;
+    std::uint64_t size_m{0};
+    std::vector<std::vector<digest_type>> levels_m; // leaves first, the root last
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
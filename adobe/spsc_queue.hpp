@@ -0,0 +1,205 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_SPSC_QUEUE_HPP
+#define ADOBE_SPSC_QUEUE_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <adobe/implementation/bit.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*!
+\ingroup other_container
+
+\brief A bounded, wait-free queue between one producing thread and one consuming thread, such as
+a lexer feeding tokens to a parser.
+
+The capacity is rounded up to a power of two, so that positions wrap with a mask. The producer
+and the consumer each own an index, on a cache line of its own, and keep a copy of the other's
+index which they reload only when the queue looks full, or empty. Unlike circular_queue, elements
+are destroyed as they are popped, and the queue never overwrites elements nor grows.
+
+Only one thread may call the \c try_push functions, and only one the \c try_pop functions.
+
+\template_parameters
+    - \c T The queue's value type, a model of \ref stldoc_MoveConstructible.
+*/
+template <typename T>
+class spsc_queue {
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    explicit spsc_queue(size_type capacity)
+        : mask_m(implementation::bit_ceil(std::max<size_type>(capacity, 1)) - 1),
+          slots_m(new slot_t[mask_m + 1]), tail_m(0), head_cache_m(0), head_m(0),
+          tail_cache_m(0) {}
+
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+
+    ~spsc_queue() {
+        for (size_type n(head_m.load(std::memory_order_relaxed)),
+             last(tail_m.load(std::memory_order_relaxed));
+             n != last; ++n)
+            element(n).~T();
+    }
+
+    size_type capacity() const { return mask_m + 1; }
+
+    /// The number of elements, which may be out of date by the time it is returned.
+    size_type size() const {
+        const size_type head(head_m.load(std::memory_order_acquire));
+        return tail_m.load(std::memory_order_acquire) - head;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    /// Producer: constructs an element at the back from \c args, unless the queue is full.
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        const size_type tail(tail_m.load(std::memory_order_relaxed));
+
+        if (tail - head_cache_m == capacity()) {
+            head_cache_m = head_m.load(std::memory_order_acquire);
+            if (tail - head_cache_m == capacity())
+                return false;
+        }
+
+        ::new (static_cast<void*>(slots_m[tail & mask_m].data_m)) T(std::forward<Args>(args)...);
+        tail_m.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool try_push(const T& x) { return try_emplace(x); }
+    bool try_push(T&& x) { return try_emplace(std::move(x)); }
+
+    /*!
+        Producer: copies as many of the \c n elements starting at \c first as there is room for
+        to the back, publishing them together. \c I models \ref stldoc_InputIterator.
+
+        \return The number of elements pushed.
+    */
+    template <typename I>
+    size_type try_push_n(I first, size_type n) {
+        const size_type tail(tail_m.load(std::memory_order_relaxed));
+
+        if (capacity() - (tail - head_cache_m) < n)
+            head_cache_m = head_m.load(std::memory_order_acquire);
+
+        n = std::min(n, capacity() - (tail - head_cache_m));
+
+        size_type i(0);
+
+        try {
+            for (; i != n; ++i, ++first)
+                ::new (static_cast<void*>(slots_m[(tail + i) & mask_m].data_m)) T(*first);
+        } catch (...) {
+            tail_m.store(tail + i, std::memory_order_release);
+            throw;
+        }
+
+        tail_m.store(tail + n, std::memory_order_release);
+
+        return n;
+    }
+
+    /// Consumer: moves the front element to \c x and destroys it, unless the queue is empty.
+    bool try_pop(T& x) {
+        const size_type head(head_m.load(std::memory_order_relaxed));
+
+        if (head == tail_cache_m) {
+            tail_cache_m = tail_m.load(std::memory_order_acquire);
+            if (head == tail_cache_m)
+                return false;
+        }
+
+        T& front(element(head));
+
+        x = std::move(front);
+        front.~T();
+        head_m.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /*!
+        Consumer: moves up to \c n elements from the front to \c out, destroying them and
+        releasing their room together. \c O models \ref stldoc_OutputIterator.
+
+        \return The number of elements popped.
+    */
+    template <typename O>
+    size_type try_pop_n(O out, size_type n) {
+        const size_type head(head_m.load(std::memory_order_relaxed));
+
+        if (tail_cache_m - head < n)
+            tail_cache_m = tail_m.load(std::memory_order_acquire);
+
+        n = std::min(n, tail_cache_m - head);
+
+        for (size_type i(0); i != n; ++i, ++out) {
+            T& x(element(head + i));
+
+            *out = std::move(x);
+            x.~T();
+        }
+
+        head_m.store(head + n, std::memory_order_release);
+
+        return n;
+    }
+
+private:
+    static constexpr std::size_t cache_line_k = 64;
+
+    struct slot_t {
+        alignas(T) unsigned char data_m[sizeof(T)];
+    };
+
+    T& element(size_type n) {
+        return *std::launder(reinterpret_cast<T*>(slots_m[n & mask_m].data_m));
+    }
+
+    // The indices count every element pushed and popped, and are masked into slots_m.
+
+    const size_type mask_m;
+    const std::unique_ptr<slot_t[]> slots_m;
+
+    alignas(cache_line_k) std::atomic<size_type> tail_m; // written by the producer
+    size_type head_cache_m;                              // the producer's copy of head_m
+
+    alignas(cache_line_k) std::atomic<size_type> head_m; // written by the consumer
+    size_type tail_cache_m;                              // the consumer's copy of tail_m
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_SPSC_QUEUE_HPP
+
+/**************************************************************************************************/
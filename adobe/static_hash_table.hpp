@@ -0,0 +1,365 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_STATIC_HASH_TABLE_HPP
+#define ADOBE_STATIC_HASH_TABLE_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include <adobe/implementation/bit.hpp>
+#include <adobe/name.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+//***************************************************************************//
+//***************************************************************************//
+//***************************************************************************//
+
+/*!
+\class adobe::static_hash_set
+\ingroup other_container
+
+\brief A set of static_name_t keys with a perfect hash, built at compile time.
+
+static_hash_set is the hashed counterpart to static_table. The keys are hashed with the same
+function static_name_t uses and split into small buckets, and a seed is searched for each bucket (at
+compile time when the set is <code>constexpr</code>) such that every key lands in a distinct slot.
+A lookup is then one hash of the key, two probes and one comparison, with no sort required before
+first use. Sets of a few hundred keys build quickly.
+
+Keys may be looked up as a static_name_t (using its precomputed hash), a name_t, or any raw string
+convertible to <code>std::string_view</code>.
+
+\example
+\code
+    using namespace adobe::literals;
+
+    constexpr auto keywords_k = adobe::make_static_hash_set({"true"_name, "false"_name});
+
+    static_assert(keywords_k.contains("false"_name));
+
+    keywords_k.contains(std::string_view("true")); // true
+\endcode
+*/
+
+/*!
+\fn std::size_t adobe::static_hash_set::find(std::string_view key) const
+
+\return the index of <code>key</code> in the initializer, or <code>npos</code> if it is not a
+member of the set.
+
+\exception None Guaranteed not to throw.
+*/
+
+/*!
+\fn bool adobe::static_hash_set::contains(const Key& key) const
+
+\return <code>true</code> if <code>key</code> is a member of the set; <code>false</code> otherwise.
+
+\exception None Guaranteed not to throw.
+*/
+
+//***************************************************************************//
+//***************************************************************************//
+//***************************************************************************//
+
+/*!
+\class adobe::static_hash_table
+\ingroup other_container
+
+\brief A lookup table of fixed size with a perfect hash, built at compile time.
+
+static_hash_table provides the interface of static_table for tables keyed by static_name_t, but is
+fully initialized by its constructor. When declared <code>constexpr</code> the hash is computed by
+the compiler and the table requires no runtime initialization at all.
+
+\example
+\code
+    constexpr auto some_table_k = adobe::make_static_hash_table<void (*)(int)>({
+        {"foo"_name, &do_foo},
+        {"bar"_name, &do_bar},
+        {"baz"_name, &do_baz},
+    });
+
+    some_table_k("baz"_name)(42); // calls do_baz
+\endcode
+*/
+
+/*!
+\fn const value_type& adobe::static_hash_table::operator()(const Key& key) const
+
+\param key The key whose stored value we are searching for.
+
+\exception std::logic_error Thrown if the key does not exist in the table.
+
+\return a reference to the value found associated with <code>key</code>.
+*/
+
+/*!
+\fn bool adobe::static_hash_table::operator()(const Key& key, value_type& result) const
+
+\param key The key whose stored value we are searching for.
+\param result Set to the value associated with the key if <code>key</code> is found.
+
+\return <code>true</code> if <code>key</code> was found and result's assignment did not throw.
+<code>false</code> otherwise.
+*/
+
+/**************************************************************************************************/
+
+namespace detail {
+
+/**************************************************************************************************/
+
+constexpr std::size_t static_hash_mix_k = sizeof(std::size_t) == 8
+                                              ? static_cast<std::size_t>(0x9e3779b97f4a7c15ULL)
+                                              : static_cast<std::size_t>(0x9e3779b9);
+
+/// The slot count is kept sparse enough that a free slot is found for each bucket in a few tries.
+constexpr std::size_t static_hash_capacity(std::size_t n) {
+    return implementation::bit_ceil(n) * 4;
+}
+
+/// Keys are split into buckets of about four, each with its own seed.
+constexpr std::size_t static_hash_buckets(std::size_t n) {
+    return implementation::bit_ceil(n) < 4 ? 1 : implementation::bit_ceil(n) / 4;
+}
+
+/**************************************************************************************************/
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+template <std::size_t Size>
+class static_hash_set {
+public:
+    static_assert(Size != 0, "static_hash_set requires at least one key");
+    static_assert(Size < std::numeric_limits<std::uint16_t>::max(), "static_hash_set too large");
+
+    static constexpr std::size_t npos = Size;
+
+    constexpr explicit static_hash_set(const static_name_t (&keys)[Size]) {
+        for (std::size_t i = 0; i != Size; ++i)
+            assign(i, keys[i]);
+        build();
+    }
+
+    template <typename T>
+    constexpr explicit static_hash_set(const std::pair<static_name_t, T> (&entries)[Size]) {
+        for (std::size_t i = 0; i != Size; ++i)
+            assign(i, entries[i].first);
+        build();
+    }
+
+    constexpr std::size_t find(std::string_view key) const noexcept {
+        return find(key, detail::name_hash(key));
+    }
+
+    constexpr std::size_t find(const static_name_t& key) const noexcept {
+        return find(std::string_view(key.c_str()), key.hash());
+    }
+
+    /// For callers that already have the name_hash() of <code>key</code>.
+    constexpr std::size_t find(std::string_view key, std::size_t hash) const noexcept {
+        std::size_t index(slot_m[slot(hash)]);
+
+        return index && hash_m[index - 1] == hash && key_m[index - 1] == key ? index - 1 : npos;
+    }
+
+    template <typename Key>
+    constexpr bool contains(const Key& key) const noexcept {
+        return find(key) != npos;
+    }
+
+    constexpr std::string_view key(std::size_t index) const { return key_m[index]; }
+
+    static constexpr std::size_t size() { return Size; }
+
+private:
+    /*
+        A two level perfect hash: the high bits of a key's hash select a bucket, and the bucket's
+        seed, found when the set is built, places each of its keys in a distinct slot.
+    */
+
+    static constexpr std::size_t capacity_k = detail::static_hash_capacity(Size);
+    static constexpr std::size_t buckets_k = detail::static_hash_buckets(Size);
+    // Both counts are powers of two, so the width less one is the log2.
+    static constexpr int shift_k =
+        std::numeric_limits<std::size_t>::digits + 1 - implementation::bit_width(capacity_k);
+    static constexpr int bucket_shift_k =
+        std::numeric_limits<std::size_t>::digits + 1 - implementation::bit_width(buckets_k);
+
+    static constexpr std::size_t bucket(std::size_t hash) {
+        // A shift by the full width is undefined, a single bucket is handled separately.
+        return buckets_k == 1 ? 0 : (hash * detail::static_hash_mix_k) >> bucket_shift_k;
+    }
+
+    static constexpr std::size_t slot(std::size_t hash, std::size_t seed) {
+        return ((hash ^ (seed * detail::static_hash_mix_k)) * detail::static_hash_mix_k) >> shift_k;
+    }
+
+    constexpr std::size_t slot(std::size_t hash) const { return slot(hash, seed_m[bucket(hash)]); }
+
+    constexpr void assign(std::size_t index, const static_name_t& key) {
+        key_m[index] = key.c_str();
+        hash_m[index] = key.hash();
+    }
+
+    constexpr void build() {
+        for (std::size_t i = 0; i != Size; ++i) {
+            for (std::size_t j = 0; j != i; ++j) {
+                if (hash_m[i] == hash_m[j])
+                    throw std::logic_error("static_hash_set duplicate key");
+            }
+        }
+
+        std::array<std::size_t, buckets_k> count{};
+        for (std::size_t i = 0; i != Size; ++i)
+            ++count[bucket(hash_m[i])];
+
+        // The fullest buckets are placed first, while the table is emptiest.
+        std::array<bool, buckets_k> placed{};
+
+        for (std::size_t n = 0; n != buckets_k; ++n) {
+            std::size_t b(0);
+            while (placed[b])
+                ++b;
+            for (std::size_t i = b + 1; i != buckets_k; ++i) {
+                if (!placed[i] && count[b] < count[i])
+                    b = i;
+            }
+            placed[b] = true;
+            place(b);
+        }
+    }
+
+    constexpr void place(std::size_t b) {
+        for (std::size_t seed = 0; seed != std::numeric_limits<std::uint16_t>::max(); ++seed) {
+            bool collision(false);
+
+            for (std::size_t i = 0; i != Size && !collision; ++i) {
+                if (bucket(hash_m[i]) != b)
+                    continue;
+
+                std::uint16_t& index(slot_m[slot(hash_m[i], seed)]);
+                collision = index != 0;
+                if (!collision)
+                    index = static_cast<std::uint16_t>(i + 1);
+            }
+
+            if (!collision) {
+                seed_m[b] = static_cast<std::uint16_t>(seed);
+                return;
+            }
+
+            // Clear the slots this seed claimed before trying the next.
+            for (std::size_t i = 0; i != Size; ++i) {
+                if (bucket(hash_m[i]) != b)
+                    continue;
+
+                std::uint16_t& index(slot_m[slot(hash_m[i], seed)]);
+                if (index == i + 1)
+                    index = 0;
+            }
+        }
+
+        throw std::logic_error("static_hash_set no perfect hash found");
+    }
+
+    std::array<std::uint16_t, buckets_k> seed_m{};
+    std::array<std::uint16_t, capacity_k> slot_m{}; // index + 1 of the key, 0 if empty
+    std::array<std::string_view, Size> key_m{};
+    std::array<std::size_t, Size> hash_m{};
+};
+
+/**************************************************************************************************/
+
+template <typename ValueType, std::size_t Size>
+class static_hash_table {
+public:
+    typedef static_name_t key_type;
+    typedef ValueType value_type;
+    typedef std::pair<key_type, value_type> entry_type;
+
+    constexpr explicit static_hash_table(const entry_type (&entries)[Size]) : keys_m(entries) {
+        for (std::size_t i = 0; i != Size; ++i)
+            value_m[i] = entries[i].second;
+    }
+
+    template <typename Key>
+    constexpr const value_type* find(const Key& key) const noexcept {
+        std::size_t index(keys_m.find(key));
+
+        return index == keys_m.npos ? nullptr : &value_m[index];
+    }
+
+    template <typename Key>
+    const value_type& operator()(const Key& key) const {
+        const value_type* result(find(key));
+
+        if (!result)
+            throw std::logic_error("static_hash_table key not found");
+
+        return *result;
+    }
+
+    template <typename Key>
+    bool operator()(const Key& key, value_type& result) const {
+        const value_type* found(find(key));
+
+        if (!found)
+            return false;
+
+        result = *found;
+
+        return true;
+    }
+
+    static constexpr std::size_t size() { return Size; }
+
+private:
+    static_hash_set<Size> keys_m;
+    std::array<value_type, Size> value_m{};
+};
+
+/**************************************************************************************************/
+
+template <std::size_t N>
+constexpr static_hash_set<N> make_static_hash_set(const static_name_t (&keys)[N]) {
+    return static_hash_set<N>(keys);
+}
+
+template <typename ValueType, std::size_t N>
+constexpr static_hash_table<ValueType, N>
+make_static_hash_table(const std::pair<static_name_t, ValueType> (&entries)[N]) {
+    return static_hash_table<ValueType, N>(entries);
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_STATIC_HASH_TABLE_HPP
+
+/**************************************************************************************************/
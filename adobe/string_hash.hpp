@@ -0,0 +1,101 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_STRING_HASH_HPP
+#define ADOBE_STRING_HASH_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+#include <adobe/fnv.hpp>
+#include <adobe/wyhash.hpp>
+
+/**************************************************************************************************/
+
+/**
+    \defgroup string_hash String Hasher Policies
+
+    A string hasher policy hashes a run of characters to a std::size_t. It provides
+
+    - <code>static constexpr std::size_t hash(const char* str, std::size_t n)</code>, and
+    - <code>constexpr std::size_t operator()(std::string_view str) const</code>,
+
+    so it can be given as the Hash of closed_hash_set, closed_hash_map, or hash_index for keys
+    convertible to std::string_view, and its hash function to unique_string_pool_t. Every policy is
+    `constexpr`, so the hashes of keys known at compile time fold.
+
+    name_t and static_name_t always hash with fnv1a_hasher_t.
+*/
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/**
+    \ingroup string_hash
+
+    FNV-1a, one character at a time, at the width of std::size_t.
+*/
+struct fnv1a_hasher_t {
+    static constexpr std::size_t hash(const char* str, std::size_t n) {
+        return static_cast<std::size_t>(fnv1a<sizeof(std::size_t) * 8>(str, str + n));
+    }
+
+    constexpr std::size_t operator()(std::string_view str) const {
+        return hash(str.data(), str.size());
+    }
+};
+
+/**************************************************************************************************/
+
+/**
+    \ingroup string_hash
+
+    The word at a time FNV-1a variant, fnv1a_words, at the width of std::size_t.
+*/
+struct fnv1a_words_hasher_t {
+    static constexpr std::size_t hash(const char* str, std::size_t n) {
+        return static_cast<std::size_t>(fnv1a_words<sizeof(std::size_t) * 8>(str, n));
+    }
+
+    constexpr std::size_t operator()(std::string_view str) const {
+        return hash(str.data(), str.size());
+    }
+};
+
+/**************************************************************************************************/
+
+/**
+    \ingroup string_hash
+
+    wyhash, truncated to the width of std::size_t.
+*/
+struct wyhash_hasher_t {
+    static constexpr std::size_t hash(const char* str, std::size_t n) {
+        return static_cast<std::size_t>(wyhash(str, n));
+    }
+
+    constexpr std::size_t operator()(std::string_view str) const {
+        return hash(str.data(), str.size());
+    }
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
@@ -12,9 +12,14 @@
 /**************************************************************************************************/
 
 #include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <optional>
+#include <type_traits>
 
 #include <adobe/cassert.hpp>
+#include <adobe/implementation/bit.hpp>
+#include <adobe/implementation/byte_scan.hpp>
 
 /**************************************************************************************************/
 
@@ -518,7 +523,8 @@ sequence from T to U determined by the following table:
 
 template <typename T, typename U>
 struct expand_utf
-    : std::integral_constant<std::size_t, detail::expand_utf_t<sizeof(T), sizeof(U)>::value> {};
+    : std::integral_constant<std::size_t,
+                             detail::expand_utf_t<sizeof(T) * 8, sizeof(U) * 8>::value> {};
 
 /**************************************************************************************************/
 
@@ -565,6 +571,437 @@ O copy_utf(const R& r, O o) {
 
 /**************************************************************************************************/
 
+namespace detail {
+
+/**************************************************************************************************/
+/*
+    Bulk, pointer based transcoding. Runs of ASCII are found and converted many code units at a
+    time; everything else is decoded one code point at a time with full validation.
+*/
+
+template <typename U>
+inline std::uint32_t utf_unit(U x) {
+    return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<U>>(x));
+}
+
+/**************************************************************************************************/
+/*
+    Decodes the code point at f and returns the number of code units it takes, or zero if the code
+    units at f are not a valid (shortest form, non-surrogate, in range) encoding. The position is
+    returned rather than updated in place so that it can stay in a register.
+*/
+
+template <typename U>
+inline std::size_t decode_utf(const U* f, const U* l, std::uint32_t& code,
+                              unicode_size_type_<1>) {
+    const std::uint32_t lead(utf_unit(*f));
+
+    if (lead < 0x80) {
+        code = lead;
+        return 1;
+    }
+
+    // Overlong forms, surrogates and out of range values are rejected by value once decoded.
+    if (lead < 0xE0) {
+        if (lead < 0xC2 || l - f < 2)
+            return 0;
+
+        const std::uint32_t trail(utf_unit(f[1]));
+        if ((trail & 0xC0) != 0x80)
+            return 0;
+
+        code = ((lead & 0x1F) << 6) | (trail & 0x3F);
+        return 2;
+    }
+
+    if (lead < 0xF0) {
+        if (l - f < 3)
+            return 0;
+
+        const std::uint32_t trail_1(utf_unit(f[1]));
+        const std::uint32_t trail_2(utf_unit(f[2]));
+        if (((trail_1 & 0xC0) != 0x80) | ((trail_2 & 0xC0) != 0x80))
+            return 0;
+
+        code = ((lead & 0x0F) << 12) | ((trail_1 & 0x3F) << 6) | (trail_2 & 0x3F);
+        if (code < 0x800 || code - 0xD800 < 0x800)
+            return 0;
+
+        return 3;
+    }
+
+    if (lead >= 0xF8 || l - f < 4)
+        return 0;
+
+    const std::uint32_t trail_1(utf_unit(f[1]));
+    const std::uint32_t trail_2(utf_unit(f[2]));
+    const std::uint32_t trail_3(utf_unit(f[3]));
+    if (((trail_1 & 0xC0) != 0x80) | ((trail_2 & 0xC0) != 0x80) | ((trail_3 & 0xC0) != 0x80))
+        return 0;
+
+    code = ((lead & 0x07) << 18) | ((trail_1 & 0x3F) << 12) | ((trail_2 & 0x3F) << 6) |
+           (trail_3 & 0x3F);
+    if (code - 0x10000 >= 0x100000)
+        return 0;
+
+    return 4;
+}
+
+template <typename U>
+inline std::size_t decode_utf(const U* f, const U* l, std::uint32_t& code,
+                              unicode_size_type_<2>) {
+    const std::uint32_t lead(utf_unit(*f));
+
+    if (lead - 0xD800 >= 0x800) {
+        code = lead;
+        return 1;
+    }
+
+    if (lead >= 0xDC00 || l - f < 2)
+        return 0;
+
+    const std::uint32_t trail(utf_unit(f[1]));
+    if (trail - 0xDC00 >= 0x400)
+        return 0;
+
+    code = ((lead - 0xD800) << 10) + (trail - 0xDC00) + 0x10000;
+    return 2;
+}
+
+template <typename U>
+inline std::size_t decode_utf(const U* f, const U*, std::uint32_t& code,
+                              unicode_size_type_<4>) {
+    code = utf_unit(*f);
+
+    if (code > 0x10FFFF || code - 0xD800 < 0x800)
+        return 0;
+
+    return 1;
+}
+
+/**************************************************************************************************/
+
+inline std::size_t utf_encoded_size(std::uint32_t code, unicode_size_type_<1>) {
+    return code < to_utf8_pivot_1_k   ? 1
+           : code < to_utf8_pivot_2_k ? 2
+           : code < to_utf8_pivot_3_k ? 3
+                                      : 4;
+}
+
+inline std::size_t utf_encoded_size(std::uint32_t code, unicode_size_type_<2>) {
+    return code < 0x10000 ? 1 : 2;
+}
+
+inline std::size_t utf_encoded_size(std::uint32_t, unicode_size_type_<4>) { return 1; }
+
+template <typename T>
+T* encode_utf(std::uint32_t code, T* o, unicode_size_type_<1>) {
+    return utf32_to_utf8<T>(code, o);
+}
+
+template <typename T>
+T* encode_utf(std::uint32_t code, T* o, unicode_size_type_<2>) {
+    return utf32_to_utf16<T>(code, o);
+}
+
+template <typename T>
+T* encode_utf(std::uint32_t code, T* o, unicode_size_type_<4>) {
+    *o = static_cast<T>(code);
+    return ++o;
+}
+
+/**************************************************************************************************/
+/*
+    Returns the first code unit in [f, l) that is not ASCII, or l.
+*/
+
+template <typename U>
+const U* find_non_ascii(const U* f, const U* l, unicode_size_type_<1>) {
+    const char* first(reinterpret_cast<const char*>(f));
+    return f + (implementation::find_first_non_ascii(first, reinterpret_cast<const char*>(l)) -
+                first);
+}
+
+template <typename U>
+const U* find_non_ascii(const U* f, const U* l, unicode_size_type_<2>) {
+#if ADOBE_BYTE_SCAN_SSE2
+    const __m128i mask(_mm_set1_epi16(static_cast<short>(0xFF80)));
+    const __m128i zero(_mm_setzero_si128());
+
+    for (; l - f >= 8; f += 8) {
+        const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f)));
+        const unsigned ascii(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, mask), zero)));
+        if (ascii != 0xFFFF)
+            return f + implementation::countr_zero(~ascii) / 2;
+    }
+#endif
+
+    while (f != l && utf_unit(*f) < 0x80)
+        ++f;
+    return f;
+}
+
+template <typename U>
+const U* find_non_ascii(const U* f, const U* l, unicode_size_type_<4>) {
+#if ADOBE_BYTE_SCAN_SSE2
+    const __m128i mask(_mm_set1_epi32(static_cast<int>(0xFFFFFF80)));
+    const __m128i zero(_mm_setzero_si128());
+
+    for (; l - f >= 4; f += 4) {
+        const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f)));
+        const unsigned ascii(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(block, mask), zero)));
+        if (ascii != 0xFFFF)
+            return f + implementation::countr_zero(~ascii) / 4;
+    }
+#endif
+
+    while (f != l && utf_unit(*f) < 0x80)
+        ++f;
+    return f;
+}
+
+/**************************************************************************************************/
+/*
+    Converts the run of ASCII at the start of [f, l) to o and returns its length. The generic
+    version converts one code unit at a time, the overloads below convert sixteen at a time between
+    UTF-8 and the wider encodings.
+*/
+
+template <typename T, typename U, typename S, typename D>
+inline std::size_t copy_ascii(const U* f, const U* l, T* o, S, D) {
+    const U* first(f);
+    for (; f != l && utf_unit(*f) < 0x80; ++f, ++o)
+        *o = static_cast<T>(*f);
+    return f - first;
+}
+
+#if ADOBE_BYTE_SCAN_SSE2
+
+template <typename T, typename U>
+inline std::size_t copy_ascii(const U* f, const U* l, T* o, unicode_size_type_<1> s,
+                              unicode_size_type_<2> d) {
+    const U* first(f);
+    const __m128i zero(_mm_setzero_si128());
+
+    for (; l - f >= 16; f += 16, o += 16) {
+        const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f)));
+        if (_mm_movemask_epi8(block))
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 8), _mm_unpackhi_epi8(block, zero));
+    }
+
+    return (f - first) +
+           copy_ascii<T, U, unicode_size_type_<1>, unicode_size_type_<2>>(f, l, o, s, d);
+}
+
+template <typename T, typename U>
+inline std::size_t copy_ascii(const U* f, const U* l, T* o, unicode_size_type_<1> s,
+                              unicode_size_type_<4> d) {
+    const U* first(f);
+    const __m128i zero(_mm_setzero_si128());
+
+    for (; l - f >= 16; f += 16, o += 16) {
+        const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f)));
+        if (_mm_movemask_epi8(block))
+            break;
+        const __m128i low(_mm_unpacklo_epi8(block, zero));
+        const __m128i high(_mm_unpackhi_epi8(block, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 12), _mm_unpackhi_epi16(high, zero));
+    }
+
+    return (f - first) +
+           copy_ascii<T, U, unicode_size_type_<1>, unicode_size_type_<4>>(f, l, o, s, d);
+}
+
+template <typename T, typename U>
+inline std::size_t copy_ascii(const U* f, const U* l, T* o, unicode_size_type_<2> s,
+                              unicode_size_type_<1> d) {
+    const U* first(f);
+    const __m128i mask(_mm_set1_epi16(static_cast<short>(0xFF80)));
+    const __m128i zero(_mm_setzero_si128());
+
+    for (; l - f >= 16; f += 16, o += 16) {
+        const __m128i a(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f)));
+        const __m128i b(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f + 8)));
+        const __m128i high(_mm_and_si128(_mm_or_si128(a, b), mask));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF)
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_packus_epi16(a, b));
+    }
+
+    return (f - first) +
+           copy_ascii<T, U, unicode_size_type_<2>, unicode_size_type_<1>>(f, l, o, s, d);
+}
+
+template <typename T, typename U>
+inline std::size_t copy_ascii(const U* f, const U* l, T* o, unicode_size_type_<4> s,
+                              unicode_size_type_<1> d) {
+    const U* first(f);
+    const __m128i mask(_mm_set1_epi32(static_cast<int>(0xFFFFFF80)));
+    const __m128i zero(_mm_setzero_si128());
+
+    for (; l - f >= 16; f += 16, o += 16) {
+        const __m128i a(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f)));
+        const __m128i b(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f + 4)));
+        const __m128i c(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f + 8)));
+        const __m128i e(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f + 12)));
+        const __m128i high(
+            _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, e)), mask));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF)
+            break;
+        // Every value is below 0x80 so the signed saturation of the first pack is harmless.
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o),
+                         _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, e)));
+    }
+
+    return (f - first) +
+           copy_ascii<T, U, unicode_size_type_<4>, unicode_size_type_<1>>(f, l, o, s, d);
+}
+
+#endif
+
+/**************************************************************************************************/
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+/*!
+\ingroup unicode
+
+Returns the first code unit of the first invalid sequence in the UTF-8, 16, or 32 text
+<code>[f, l)</code>, or \c l if the text is valid.
+
+UTF-8 is valid when every sequence is the shortest form of its code point; surrogate code points,
+code points above U+10FFFF, and truncated sequences are invalid in every encoding.
+
+\tparam U must be 8, 16, or 32 bit integral type
+*/
+
+template <typename U>
+const U* find_invalid_utf(const U* f, const U* l) {
+    using source_t = detail::unicode_size_type_<sizeof(U)>;
+
+    while (f != l) {
+        if (detail::utf_unit(*f) < 0x80) {
+            f = detail::find_non_ascii(f, l, source_t());
+        } else {
+            std::uint32_t code;
+            const std::size_t n(detail::decode_utf(f, l, code, source_t()));
+            if (!n)
+                return f;
+            f += n;
+        }
+    }
+
+    return l;
+}
+
+/*!
+\ingroup unicode
+
+Returns the number of code units of type \c T that transcode_utf() writes for the text
+<code>[f, l)</code>, or \c std::nullopt if the text is not valid (see find_invalid_utf()). This is
+the first pass of a conversion into a buffer of exactly the right size:
+
+\code
+    std::optional<std::size_t> n(adobe::utf_length<char16_t>(first, last));
+    if (!n)
+        throw std::invalid_argument("invalid UTF-8");
+
+    std::u16string result(*n, u'\0');
+    adobe::transcode_utf<char16_t>(first, last, result.data());
+\endcode
+
+\tparam T must be 8, 16, or 32 bit integral type
+\tparam U must be 8, 16, or 32 bit integral type
+*/
+
+template <typename T, typename U>
+std::optional<std::size_t> utf_length(const U* f, const U* l) {
+    using source_t = detail::unicode_size_type_<sizeof(U)>;
+    using target_t = detail::unicode_size_type_<sizeof(T)>;
+
+    if constexpr (sizeof(T) == sizeof(U)) {
+        if (find_invalid_utf(f, l) != l)
+            return std::nullopt;
+        return std::size_t(l - f);
+    } else {
+        std::size_t result(0);
+
+        while (f != l) {
+            if (detail::utf_unit(*f) < 0x80) {
+                const U* run(detail::find_non_ascii(f, l, source_t()));
+                result += run - f;
+                f = run;
+            } else {
+                std::uint32_t code;
+                const std::size_t n(detail::decode_utf(f, l, code, source_t()));
+                if (!n)
+                    return std::nullopt;
+                f += n;
+                result += detail::utf_encoded_size(code, target_t());
+            }
+        }
+
+        return result;
+    }
+}
+
+/*!
+\ingroup unicode
+
+`transcode_utf` converts the text <code>[f, l)</code> from UTF-8, 16, or 32 to UTF-8, 16, or 32
+starting at `o`. Unlike copy_utf(), runs of ASCII are converted many code units at a time, and
+text that is already in the target encoding is copied as a block.
+
+\tparam T must be 8, 16, or 32 bit integral type
+\tparam U must be 8, 16, or 32 bit integral type
+
+\pre `[f, l)` is valid, see find_invalid_utf()
+\pre `[o, o + n)` is a valid range, where `n` is the result of utf_length()
+
+\note If the source contains an invalid sequence then its first code unit is skipped; the code
+will not read beyond the source range or write more than `l - f` times
+<code>expand_utf<U, T>::value</code> code units.
+
+\return A pointer to the end of the encoded text.
+*/
+
+template <typename T, typename U>
+T* transcode_utf(const U* f, const U* l, T* o) {
+    using source_t = detail::unicode_size_type_<sizeof(U)>;
+    using target_t = detail::unicode_size_type_<sizeof(T)>;
+
+    if constexpr (sizeof(T) == sizeof(U)) {
+        if (f != l)
+            std::memcpy(o, f, (l - f) * sizeof(T));
+        return o + (l - f);
+    } else {
+        while (f != l) {
+            if (detail::utf_unit(*f) < 0x80) {
+                const std::size_t n(detail::copy_ascii(f, l, o, source_t(), target_t()));
+                f += n;
+                o += n;
+            } else {
+                std::uint32_t code;
+                const std::size_t n(detail::decode_utf(f, l, code, source_t()));
+                if (n)
+                    o = detail::encode_utf(code, o, target_t());
+                f += n ? n : 1;
+            }
+        }
+
+        return o;
+    }
+}
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
@@ -0,0 +1,170 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_WYHASH_HPP
+#define ADOBE_WYHASH_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <adobe/implementation/bit.hpp>
+
+/**************************************************************************************************/
+
+/**
+    \defgroup wyhash wyhash Hashing Algorithm
+
+    A fast, general purpose, non-cryptographic hash after wyhash by Wang Yi, which is released
+    into the public domain (https://github.com/wangyi-fudan/wyhash). Each step multiplies two
+    64-bit words into a 128-bit product and folds its halves together, consuming 16 bytes at a time
+    (48 bytes across three independent chains for long keys). Short keys, the common case for
+    names and dictionary keys, take two or three loads and two multiplies whatever their length.
+
+    The hash is the same on every platform and folds at compile time for constant keys.
+
+    \warning
+    This algorithm is not cryptographically secure. Do not use it where secure algorithms (e.g.,
+    \ref sha) are required.
+*/
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+namespace detail {
+
+/**************************************************************************************************/
+
+constexpr std::uint64_t wyhash_secret_k[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                                              0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+/// The 128-bit product of a and b, the low half in a and the high half in b.
+constexpr void wyhash_mum(std::uint64_t& a, std::uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    const uint128_t r(static_cast<uint128_t>(a) * b);
+
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    const std::uint64_t ha(a >> 32), hb(b >> 32), la(a & 0xffffffff), lb(b & 0xffffffff);
+    const std::uint64_t rh(ha * hb), rm0(ha * lb), rm1(hb * la), rl(la * lb);
+    const std::uint64_t t(rl + (rm0 << 32));
+    const std::uint64_t lo(t + (rm1 << 32));
+
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+#endif
+}
+
+constexpr std::uint64_t wyhash_mix(std::uint64_t a, std::uint64_t b) {
+    wyhash_mum(a, b);
+    return a ^ b;
+}
+
+constexpr std::uint64_t wyhash_read8(const char* p) {
+    return implementation::load_little_endian<std::uint64_t>(p);
+}
+
+constexpr std::uint64_t wyhash_read4(const char* p) {
+    return implementation::load_little_endian<std::uint32_t>(p);
+}
+
+/**************************************************************************************************/
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+/**
+    \ingroup wyhash
+
+    \return The 64-bit hash of the n bytes at p with the given seed.
+*/
+constexpr std::uint64_t wyhash(const char* p, std::size_t n, std::uint64_t seed = 0) {
+    using detail::wyhash_mix;
+    using detail::wyhash_read4;
+    using detail::wyhash_read8;
+    using detail::wyhash_secret_k;
+
+    seed ^= wyhash_mix(seed ^ wyhash_secret_k[0], wyhash_secret_k[1]);
+
+    std::uint64_t a(0);
+    std::uint64_t b(0);
+
+    if (n <= 16) {
+        if (n >= 4) {
+            const std::size_t middle((n >> 3) << 2);
+
+            a = wyhash_read4(p) << 32 | wyhash_read4(p + middle);
+            b = wyhash_read4(p + n - 4) << 32 | wyhash_read4(p + n - 4 - middle);
+        } else if (n > 0) {
+            a = static_cast<std::uint64_t>(static_cast<unsigned char>(p[0])) << 16 |
+                static_cast<std::uint64_t>(static_cast<unsigned char>(p[n >> 1])) << 8 |
+                static_cast<unsigned char>(p[n - 1]);
+        }
+    } else {
+        std::size_t i(n);
+
+        if (i > 48) {
+            std::uint64_t see1(seed);
+            std::uint64_t see2(seed);
+
+            do {
+                seed = wyhash_mix(wyhash_read8(p) ^ wyhash_secret_k[1],
+                                  wyhash_read8(p + 8) ^ seed);
+                see1 = wyhash_mix(wyhash_read8(p + 16) ^ wyhash_secret_k[2],
+                                  wyhash_read8(p + 24) ^ see1);
+                see2 = wyhash_mix(wyhash_read8(p + 32) ^ wyhash_secret_k[3],
+                                  wyhash_read8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+
+            seed ^= see1 ^ see2;
+        }
+
+        for (; i > 16; i -= 16, p += 16)
+            seed = wyhash_mix(wyhash_read8(p) ^ wyhash_secret_k[1], wyhash_read8(p + 8) ^ seed);
+
+        a = wyhash_read8(p + i - 16);
+        b = wyhash_read8(p + i - 8);
+    }
+
+    a ^= wyhash_secret_k[1];
+    b ^= seed;
+    detail::wyhash_mum(a, b);
+
+    return wyhash_mix(a ^ wyhash_secret_k[0] ^ n, b ^ wyhash_secret_k[1]);
+}
+
+/**
+    \ingroup wyhash
+
+    \return The 64-bit hash of str with the given seed.
+*/
+constexpr std::uint64_t wyhash(std::string_view str, std::uint64_t seed = 0) {
+    return wyhash(str.data(), str.size(), seed);
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif
+
+/**************************************************************************************************/
@@ -0,0 +1,433 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_XML_EVENT_PARSER_HPP
+#define ADOBE_XML_EVENT_PARSER_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include <adobe/implementation/byte_scan.hpp>
+#include <adobe/istream.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+namespace implementation {
+
+/**************************************************************************************************/
+
+constexpr std::array<bool, 256> xml_name_char_k = [] {
+    std::array<bool, 256> result{};
+
+    for (int c = 'a'; c <= 'z'; ++c)
+        result[c] = true;
+    for (int c = 'A'; c <= 'Z'; ++c)
+        result[c] = true;
+    for (int c = '0'; c <= '9'; ++c)
+        result[c] = true;
+    for (int c = 0x80; c != 0x100; ++c)
+        result[c] = true; // any multibyte UTF-8 sequence
+    result['_'] = result[':'] = result['-'] = result['.'] = true;
+
+    return result;
+}();
+
+/*
+    Decodes the reference named by reference, without the leading '&' and trailing ';', as UTF-8
+    into buffer, which must hold at least four bytes. Returns the number of bytes written, or zero
+    if the reference is not known.
+*/
+std::size_t decode_xml_reference(std::string_view reference, char* buffer);
+
+[[noreturn]] void throw_xml_event_error(const char* what, std::string_view text, const char* at,
+                                        const line_position_t& position);
+
+/**************************************************************************************************/
+
+} // namespace implementation
+
+/**************************************************************************************************/
+
+/*!
+\ingroup asl_xml_parser
+\brief The events of xml_event_parser_t, all of which are ignored.
+
+A handler need only provide the events it is interested in; derive from this class for the rest.
+*/
+
+struct xml_event_handler_t {
+    void start_element(std::string_view /*name*/) {}
+    void attribute(std::string_view /*name*/, std::string_view /*value*/) {}
+    void text(std::string_view /*text*/) {}
+    void end_element(std::string_view /*name*/) {}
+};
+
+/**************************************************************************************************/
+
+/*!
+\ingroup asl_xml_parser
+\brief A streaming XML parser over a contiguous buffer.
+
+The parser reports the structure of the document to a handler as a sequence of events:
+
+- <code>start_element(name)</code>, followed by <code>attribute(name, value)</code> for each
+  attribute of the element in document order,
+- <code>text(text)</code> for character data,
+- <code>end_element(name)</code>, also for an empty element.
+
+Every view passed to the handler refers into the parsed text, except for the text of a
+character or entity reference which refers to a buffer valid only for the duration of the call.
+Character data may be reported in several consecutive text events; it is split around references
+and CDATA sections. Attribute values are reported as they appear in the source, use
+decode_xml_references() to expand them. Comments, processing instructions and the document type
+declaration are skipped.
+
+The text is scanned for delimiters many bytes at a time and no memory is allocated per element;
+the stack of open elements is kept as views into the text.
+
+\exception adobe::stream_error_t if the text is not well formed.
+*/
+
+template <typename Handler>
+class xml_event_parser_t : boost::noncopyable {
+public:
+    xml_event_parser_t(std::string_view text, const line_position_t& position, Handler& handler)
+        : text_m(text), position_m(position), handler_m(handler), p_m(text.data()),
+          last_m(text.data() + text.size()) {
+        open_m.reserve(32);
+    }
+
+    /*!
+        Parses the text as a document: an optional byte order mark and prolog, a single root
+        element, and trailing comments or processing instructions.
+    */
+    void parse_document();
+
+    /*!
+        Parses the text as the content of an element.
+    */
+    void parse_content();
+
+private:
+    [[noreturn]] void error(const char* what) const {
+        implementation::throw_xml_event_error(what, text_m, p_m, position_m);
+    }
+
+    bool starts_with(std::string_view x) const {
+        return std::size_t(last_m - p_m) >= x.size() && std::equal(x.begin(), x.end(), p_m);
+    }
+
+    bool skip_space() {
+        const char* first(p_m);
+        while (p_m != last_m && (*p_m == ' ' || *p_m == '\n' || *p_m == '\t' || *p_m == '\r'))
+            ++p_m;
+        return p_m != first;
+    }
+
+    std::string_view name() {
+        const char* first(p_m);
+        while (p_m != last_m && implementation::xml_name_char_k[static_cast<unsigned char>(*p_m)])
+            ++p_m;
+        if (p_m == first)
+            error("expected a name");
+        return std::string_view(first, p_m - first);
+    }
+
+    void require(char c) {
+        if (p_m == last_m || *p_m != c)
+            error(c == '>' ? "expected '>'" : c == '=' ? "expected '='" : "unexpected character");
+        ++p_m;
+    }
+
+    // Skips past the next occurrence of terminator, returning the text before it.
+    std::string_view skip_to(std::string_view terminator, const char* what) {
+        const std::string_view rest(p_m, last_m - p_m);
+        const std::size_t found(rest.find(terminator));
+        if (found == std::string_view::npos)
+            error(what);
+        p_m += found + terminator.size();
+        return rest.substr(0, found);
+    }
+
+    void content(bool single_element);
+    void start_tag();
+    void end_tag(std::size_t base);
+    void reference();
+    void misc(bool prolog);
+
+    std::string_view text_m;
+    line_position_t position_m;
+    Handler& handler_m;
+    const char* p_m;
+    const char* last_m;
+    std::vector<std::string_view> open_m;
+};
+
+/**************************************************************************************************/
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::parse_document() {
+    if (starts_with("\xEF\xBB\xBF"))
+        p_m += 3;
+
+    misc(true);
+
+    if (p_m == last_m || *p_m != '<')
+        error("expected the root element");
+
+    content(true);
+    misc(false);
+
+    if (p_m != last_m)
+        error("unexpected content after the root element");
+}
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::parse_content() {
+    content(false);
+}
+
+/**************************************************************************************************/
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::content(bool single_element) {
+    const std::size_t base(open_m.size());
+
+    while (true) {
+        const char* next(implementation::find_first_of_bytes<'<', '&'>(p_m, last_m));
+
+        if (next != p_m)
+            handler_m.text(std::string_view(p_m, next - p_m));
+
+        p_m = next;
+
+        if (p_m == last_m) {
+            if (open_m.size() != base)
+                error("unexpected end of text in element");
+            return;
+        }
+
+        if (*p_m == '&') {
+            reference();
+        } else if (starts_with("</")) {
+            end_tag(base);
+        } else if (starts_with("<!--")) {
+            p_m += 4;
+            skip_to("-->", "unterminated comment");
+        } else if (starts_with("<![CDATA[")) {
+            p_m += 9;
+            const std::string_view data(skip_to("]]>", "unterminated CDATA section"));
+            if (!data.empty())
+                handler_m.text(data);
+        } else if (starts_with("<?")) {
+            p_m += 2;
+            skip_to("?>", "unterminated processing instruction");
+        } else {
+            start_tag();
+        }
+
+        if (single_element && open_m.size() == base)
+            return;
+    }
+}
+
+/**************************************************************************************************/
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::start_tag() {
+    ++p_m; // '<'
+
+    const std::string_view element(name());
+    handler_m.start_element(element);
+
+    while (true) {
+        const bool space(skip_space());
+
+        if (p_m == last_m)
+            error("unexpected end of text in tag");
+
+        if (*p_m == '>') {
+            ++p_m;
+            open_m.push_back(element);
+            return;
+        }
+
+        if (*p_m == '/') {
+            ++p_m;
+            require('>');
+            handler_m.end_element(element);
+            return;
+        }
+
+        if (!space)
+            error("expected whitespace before attribute");
+
+        const std::string_view attribute(name());
+        skip_space();
+        require('=');
+        skip_space();
+
+        if (p_m == last_m || (*p_m != '"' && *p_m != '\''))
+            error("expected a quoted attribute value");
+
+        const char* first(++p_m);
+        const char* last(p_m[-1] == '"'
+                             ? implementation::find_first_of_bytes<'"', '<'>(first, last_m)
+                             : implementation::find_first_of_bytes<'\'', '<'>(first, last_m));
+
+        p_m = last;
+        if (p_m == last_m || *p_m == '<')
+            error("unterminated attribute value");
+        ++p_m;
+
+        handler_m.attribute(attribute, std::string_view(first, last - first));
+    }
+}
+
+/**************************************************************************************************/
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::end_tag(std::size_t base) {
+    p_m += 2; // "</"
+
+    const std::string_view element(name());
+    skip_space();
+    require('>');
+
+    if (open_m.size() == base)
+        error("end tag without a start tag");
+    if (open_m.back() != element)
+        error("end tag does not match start tag");
+
+    open_m.pop_back();
+    handler_m.end_element(element);
+}
+
+/**************************************************************************************************/
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::reference() {
+    // References are short, the longest HTML entity name is 31 characters.
+    const char* first(p_m + 1);
+    const char* last(static_cast<const char*>(
+        std::memchr(first, ';', std::min<std::size_t>(last_m - first, 33))));
+
+    if (!last)
+        error("unterminated reference");
+
+    char buffer[4];
+    const std::size_t size(
+        implementation::decode_xml_reference(std::string_view(first, last - first), buffer));
+
+    if (!size)
+        error("unknown reference");
+
+    handler_m.text(std::string_view(buffer, size));
+    p_m = last + 1;
+}
+
+/**************************************************************************************************/
+
+template <typename Handler>
+void xml_event_parser_t<Handler>::misc(bool prolog) {
+    while (true) {
+        skip_space();
+
+        if (starts_with("<?")) {
+            p_m += 2;
+            skip_to("?>", "unterminated processing instruction");
+        } else if (starts_with("<!--")) {
+            p_m += 4;
+            skip_to("-->", "unterminated comment");
+        } else if (prolog && starts_with("<!DOCTYPE")) {
+            // An internal subset is enclosed in brackets and may itself contain '>'.
+            const char* next(implementation::find_first_of_bytes<'[', '>'>(p_m, last_m));
+            p_m = next;
+            if (p_m != last_m && *p_m == '[')
+                skip_to("]", "unterminated document type declaration");
+            skip_to(">", "unterminated document type declaration");
+        } else {
+            return;
+        }
+    }
+}
+
+/**************************************************************************************************/
+
+/*!
+\ingroup asl_xml_parser
+
+Parses text as an XML document, reporting its events to handler.
+
+\exception adobe::stream_error_t if the text is not well formed.
+*/
+template <typename Handler>
+void parse_xml_events(std::string_view text, const line_position_t& position, Handler& handler) {
+    xml_event_parser_t<Handler>(text, position, handler).parse_document();
+}
+
+/**************************************************************************************************/
+
+/*!
+\ingroup asl_xml_parser
+
+Copies value to output, replacing each character or entity reference with its UTF-8 text. An
+unknown or unterminated reference is copied unchanged.
+*/
+template <typename O> // O models OutputIterator
+O decode_xml_references(std::string_view value, O output) {
+    const char* first(value.data());
+    const char* const last(first + value.size());
+
+    while (true) {
+        const char* next(implementation::find_first_of_bytes<'&'>(first, last));
+        output = std::copy(first, next, output);
+
+        if (next == last)
+            return output;
+
+        const char* end(static_cast<const char*>(
+            std::memchr(next + 1, ';', std::min<std::size_t>(last - next - 1, 33))));
+        char buffer[4];
+        const std::size_t size(
+            end ? implementation::decode_xml_reference(
+                      std::string_view(next + 1, end - next - 1), buffer)
+                : 0);
+
+        if (size) {
+            output = std::copy(buffer, buffer + size, output);
+            first = end + 1;
+        } else {
+            *output++ = '&';
+            first = next + 1;
+        }
+    }
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_XML_EVENT_PARSER_HPP
+
+/**************************************************************************************************/
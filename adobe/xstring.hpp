@@ -19,14 +19,19 @@
 #include <adobe/string.hpp>
 #include <adobe/unicode.hpp>
 #include <adobe/xml_parser.hpp>
+#include <adobe/xstring_glossary.hpp>
 
 #include <boost/noncopyable.hpp>
 
 #include <cassert>
 #include <cctype>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 /**************************************************************************************************/
@@ -96,14 +101,17 @@ struct context_frame_t {
     typedef xml_parser_t<char*>::callback_proc_t callback_proc_t;
     typedef xml_parser_t<char*>::preorder_predicate_t preorder_predicate_t;
 
-    context_frame_t() : parse_info_m("xstring context_frame_t"), parsed_m(false) {}
+    context_frame_t()
+        : parse_info_m("xstring context_frame_t"), parsed_m(false),
+          glossary_m(std::make_shared<store_t>()) {}
 
     context_frame_t(const context_frame_t& rhs)
         : parse_info_m(rhs.parse_info_m), parsed_m(rhs.parsed_m),
           attribute_set_m(rhs.attribute_set_m), glossary_m(rhs.glossary_m),
-          callback_m(rhs.callback_m), predicate_m(rhs.predicate_m)
+          compiled_m(rhs.compiled_m), callback_m(rhs.callback_m), predicate_m(rhs.predicate_m)
     // slurp_m(rhs.slurp_m), // not to be transferred from context to context
     // pool_m(rhs.pool_m), // not to be transferred from context to context
+    // results_m(rhs.results_m), // not to be transferred from context to context
     {}
 
     context_frame_t& operator=(const context_frame_t& rhs) {
@@ -111,10 +119,12 @@ struct context_frame_t {
         parsed_m = rhs.parsed_m;
         attribute_set_m = rhs.attribute_set_m;
         glossary_m = rhs.glossary_m;
+        compiled_m = rhs.compiled_m;
         callback_m = rhs.callback_m;
         predicate_m = rhs.predicate_m;
         // slurp_m = rhs.slurp_m; // not to be transferred from context to context
         // pool_m = rhs.pool_m; // not to be transferred from context to context
+        results_m.clear(); // results of the previous context are stale
 
         return *this;
     }
@@ -125,7 +135,17 @@ struct context_frame_t {
     }
 
     inline store_range_pair_t range_for_key(const store_t::key_type& key) {
-        return glossary_m.equal_range(key);
+        return glossary_m->equal_range(key);
+    }
+
+    /*
+        Frames share their glossary with the frames they were copied from, so pushing a context
+        is cheap. The glossary is copied the first time a frame adds to a shared one.
+    */
+    store_t& writable_glossary() {
+        if (glossary_m.use_count() != 1)
+            glossary_m = std::make_shared<store_t>(*glossary_m);
+        return *glossary_m;
     }
 
     std::pair<bool, store_iterator> exact_match_exists(const attribute_set_t& attribute_set,
@@ -150,14 +170,23 @@ struct context_frame_t {
 
     token_range_t clone(const token_range_t& token);
 
+    /*
+        Returns the result of looking up the xstring fragment [xstr, xstr + n), memoized until the
+        context changes. Only valid when no client element handler is installed.
+    */
+    const std::string& resolve(const char* xstr, std::size_t n);
+
     line_position_t parse_info_m;
     bool parsed_m;
     attribute_set_t attribute_set_m;
-    store_t glossary_m;
+    std::shared_ptr<store_t> glossary_m;
+    std::shared_ptr<const xstring_glossary_t> compiled_m;
     callback_proc_t callback_m;
     preorder_predicate_t predicate_m;
     token_range_t slurp_m;
     unique_string_pool_t pool_m;
+    std::unordered_map<std::string, std::string> results_m;
+    std::uint64_t results_generation_m{0};
 };
 
 /**************************************************************************************************/
@@ -182,6 +211,19 @@ void xstring_clear_glossary();
 #endif
 /**************************************************************************************************/
 
+/*
+    The glossary shared by every thread. A lookup tries the compiled glossary installed by the
+    innermost xstring_context_t first, then this one, and then the glossary a context parsed from
+    XML. Setting it replaces the snapshot atomically; lookups already in progress finish with the
+    snapshot they started with.
+*/
+
+void xstring_set_shared_glossary(std::shared_ptr<const xstring_glossary_t> glossary);
+
+std::shared_ptr<const xstring_glossary_t> xstring_shared_glossary();
+
+/**************************************************************************************************/
+
 // XML fragment parsing
 
 template <typename O> // O models OutputIterator
@@ -217,7 +259,18 @@ inline void parse_xml_fragment(const char* fragment, O output) {
 
 template <typename O> // O models OutputIterator; required: sizeof(value_type(O)) >= 21 bits
 inline void xstring(const char* xstr, std::size_t n, O output) {
-    parse_xml_fragment(reinterpret_cast<uchar_ptr_t>(xstr), n, output);
+    implementation::context_frame_t& context(implementation::top_frame());
+
+    // A client element handler may have side effects, so its results are not memoized.
+    if (context.predicate_m) {
+        parse_xml_fragment(reinterpret_cast<uchar_ptr_t>(xstr), n, output);
+        return;
+    }
+
+    const std::string& result(context.resolve(xstr, n));
+    const uchar_ptr_t first(reinterpret_cast<uchar_ptr_t>(result.data()));
+
+    std::copy(first, first + result.size(), output);
 }
 
 template <typename O> // O models OutputIterator; required: sizeof(value_type(O)) >= 21 bits
@@ -269,6 +322,7 @@ struct xstring_context_t : boost::noncopyable {
         context.slurp_m.second = reinterpret_cast<uchar_ptr_t>(parse_last);
         context.parse_info_m = parse_info;
         context.parsed_m = false;
+        context.results_m.clear();
 
         glossary_parse();
     }
@@ -277,7 +331,35 @@ struct xstring_context_t : boost::noncopyable {
     xstring_context_t(I first_attribute, I last_attribute)
         : back_frame_m(implementation::top_frame()) // save snapshot of stack
     {
-        implementation::top_frame().attribute_set_m.insert(first_attribute, last_attribute);
+        implementation::context_frame_t& context(implementation::top_frame());
+
+        context.attribute_set_m.insert(first_attribute, last_attribute);
+        context.results_m.clear();
+    }
+
+    /*
+        Looks up xstrings in glossary before the glossary of the enclosing context. The glossary
+        is shared, not copied.
+    */
+    explicit xstring_context_t(std::shared_ptr<const xstring_glossary_t> glossary)
+        : back_frame_m(implementation::top_frame()) // save snapshot of stack
+    {
+        implementation::context_frame_t& context(implementation::top_frame());
+
+        context.compiled_m = std::move(glossary);
+        context.results_m.clear();
+    }
+
+    template <typename I> // I models InputIterator
+    xstring_context_t(I first_attribute, I last_attribute,
+                      std::shared_ptr<const xstring_glossary_t> glossary)
+        : back_frame_m(implementation::top_frame()) // save snapshot of stack
+    {
+        implementation::context_frame_t& context(implementation::top_frame());
+
+        context.attribute_set_m.insert(first_attribute, last_attribute);
+        context.compiled_m = std::move(glossary);
+        context.results_m.clear();
     }
 
     template <typename I> // I models InputIterator
@@ -293,16 +375,19 @@ struct xstring_context_t : boost::noncopyable {
         context.slurp_m.second = parse_last;
         context.parse_info_m = parse_info;
         context.parsed_m = false;
+        context.results_m.clear();
 
         glossary_parse();
     }
 
     void set_preorder_predicate(preorder_predicate_t proc) {
         implementation::top_frame().predicate_m = proc;
+        implementation::top_frame().results_m.clear();
     }
 
     void set_element_handler(callback_proc_t proc) {
         implementation::top_frame().callback_m = proc;
+        implementation::top_frame().results_m.clear();
     }
 
     ~xstring_context_t() { implementation::top_frame() = back_frame_m; } // restore stack as it was
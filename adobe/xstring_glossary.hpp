@@ -0,0 +1,138 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#ifndef ADOBE_XSTRING_GLOSSARY_HPP
+#define ADOBE_XSTRING_GLOSSARY_HPP
+
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <adobe/istream.hpp>
+#include <adobe/name.hpp>
+#include <adobe/xml_parser.hpp>
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+/*!
+\ingroup asl_xstring
+\brief An immutable, indexed form of an xstring glossary.
+
+A glossary is compiled once from a sequence of <code>xstr</code> elements. Each id is interned as
+a name_t and each distinct set of the remaining attributes (typically \c lang and \c platform) is
+interned as a small integer, so looking up an entry for an exact attribute set is a single hash
+probe on (id, attribute set). Lookups that have no exact entry fall back to the closest match: the
+entry for the id whose attributes agree with the most of the searched attributes and contradict
+none of them.
+
+A compiled glossary has a binary image that can be written to disk and memory-mapped by load().
+Entry values refer directly into the image and are not copied.
+*/
+
+class xstring_glossary_t {
+public:
+    using attribute_set_id_t = std::uint32_t;
+
+    static constexpr attribute_set_id_t npos = attribute_set_id_t(-1);
+
+    xstring_glossary_t() = default;
+
+    /*!
+        Compiles the <code>xstr</code> elements in xml. Where an id has more than one entry with
+        the same attributes the first is kept.
+
+        \exception adobe::stream_error_t if xml is not well formed.
+    */
+    static xstring_glossary_t
+    compile(std::string_view xml,
+            const line_position_t& position = line_position_t("xstring_glossary_t"));
+
+    /*!
+        Loads an image returned by image(). load() copies the image, load_file() maps the file
+        for the lifetime of the glossary.
+
+        \exception std::runtime_error if the image is corrupt.
+        \exception std::system_error if the file cannot be mapped.
+    */
+    static xstring_glossary_t load(std::string_view image);
+    static xstring_glossary_t load_file(const std::filesystem::path& path);
+
+    std::string image() const;
+
+    /*!
+        Returns the value of the entry for id that best matches attributes, or nullptr. An \c id
+        attribute in attributes is ignored.
+
+        \exception std::runtime_error if more than one entry is equally close.
+    */
+    const token_range_t* find(name_t id, const attribute_set_t& attributes) const;
+
+    /*!
+        Returns the interned id of attributes, or npos if no entry has exactly these attributes.
+    */
+    attribute_set_id_t attribute_set_id(const attribute_set_t& attributes) const;
+
+    std::size_t size() const { return entries_m.size(); }
+    bool empty() const { return entries_m.empty(); }
+
+private:
+    using attribute_key_t = std::vector<std::pair<name_t, name_t>>;
+
+    struct attribute_key_hash_t {
+        std::size_t operator()(const attribute_key_t& x) const;
+    };
+
+    struct entry_key_hash_t {
+        std::size_t operator()(const std::pair<name_t, attribute_set_id_t>& x) const {
+            return std::hash<name_t>()(x.first) * 31 + x.second;
+        }
+    };
+
+    struct entry_t {
+        name_t id_m;
+        attribute_set_id_t attributes_m;
+        token_range_t value_m;
+    };
+
+    static attribute_key_t make_key(const attribute_set_t& attributes);
+
+    attribute_set_id_t intern(attribute_key_t key);
+    void insert(name_t id, attribute_set_id_t attributes, const token_range_t& value);
+    void read_image(std::string_view image);
+
+    std::shared_ptr<const void> storage_m;
+    std::vector<entry_t> entries_m;
+    std::vector<attribute_key_t> attribute_sets_m;
+    std::unordered_map<attribute_key_t, attribute_set_id_t, attribute_key_hash_t> set_index_m;
+    std::unordered_map<std::pair<name_t, attribute_set_id_t>, std::uint32_t, entry_key_hash_t>
+        index_m;
+    std::unordered_map<name_t, std::vector<std::uint32_t>> by_id_m;
+};
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
+
+#endif // ADOBE_XSTRING_GLOSSARY_HPP
+
+/**************************************************************************************************/
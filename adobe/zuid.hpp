@@ -13,6 +13,8 @@
 
 #include <boost/operators.hpp>
 
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -110,6 +112,51 @@ public:
     std::string str() const;
     char* c_str() const;
 
+    /// The layouts generate_n can produce, named for their RFC 9562 version numbers.
+    enum version_t { random_k = 4, time_ordered_k = 7 };
+
+    /**
+        \return A version 4 zuid of 122 pseudo-random bits.
+
+        Each thread draws from its own generator, seeded once from system entropy, so generation
+        takes no locks.
+    */
+    static zuid_t random();
+
+    /**
+        \return A version 7 zuid: a 48-bit Unix timestamp in milliseconds followed by random bits.
+
+        Zuids from one thread compare in the order they were generated, a counter in the leading
+        random bits ordering those within the same millisecond; zuids from different threads are
+        ordered to the millisecond. As with random(), generation takes no locks.
+    */
+    static zuid_t time_ordered();
+
+    /**
+        Writes n zuids of the given version to out, reading the clock and the thread's generator
+        state once per batch rather than once per zuid.
+
+        \return The end of the output.
+    */
+    template <typename O> // O models OutputIterator
+    static O generate_n(O out, std::size_t n, version_t version = random_k) {
+        constexpr std::size_t batch_size_k = 64;
+        uuid_t batch[batch_size_k];
+
+        while (n != 0) {
+            const std::size_t count(n < batch_size_k ? n : batch_size_k);
+
+            generate(batch, count, version);
+
+            for (std::size_t i(0); i != count; ++i, ++out)
+                *out = zuid_t(batch[i]);
+
+            n -= count;
+        }
+
+        return out;
+    }
+
     static const zuid_t null;
 
 #if !defined(ADOBE_NO_DOCUMENTATION)
@@ -118,11 +165,15 @@ public:
 private:
     friend bool operator==(const zuid_t& a, const zuid_t& b);
     friend bool operator<(const zuid_t& a, const zuid_t& b);
+    friend std::to_chars_result to_chars(char* first, char* last, const zuid_t& x);
+    friend std::from_chars_result from_chars(const char* first, const char* last, zuid_t& x);
 
     struct zeroed {};
 
     zuid_t(zeroed);
 
+    static void generate(uuid_t* first, std::size_t n, version_t version);
+
     uuid_t uuid_m;
 #endif
 };
@@ -134,6 +185,27 @@ bool operator==(const zuid_t& a, const zuid_t& b);
 bool operator<(const zuid_t& a, const zuid_t& b);
 
 #endif
+/**************************************************************************************************/
+
+/**
+    Writes the 36 character, lower case form of x,
+    <code>xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx</code>, to [first, last), without a terminating
+    null, in the manner of <code>std::to_chars</code>.
+
+    \return <code>{first + zuid_t::string_size_k, std::errc()}</code>, or
+    <code>{last, std::errc::value_too_large}</code> if the range is too small.
+*/
+std::to_chars_result to_chars(char* first, char* last, const zuid_t& x);
+
+/**
+    Parses a zuid in the form written by to_chars, in either case, from the start of
+    [first, last), in the manner of <code>std::from_chars</code>.
+
+    \return <code>{first + zuid_t::string_size_k, std::errc()}</code>, or
+    <code>{first, std::errc::invalid_argument}</code>, leaving x unchanged, if the range does not
+    start with a zuid.
+*/
+std::from_chars_result from_chars(const char* first, const char* last, zuid_t& x);
 
 /**************************************************************************************************/
 
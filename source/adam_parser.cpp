@@ -13,15 +13,13 @@
 #include <istream>
 #include <sstream>
 #include <utility>
-#include <adobe/algorithm/binary_search.hpp>
-#include <adobe/algorithm/lower_bound.hpp>
-#include <adobe/algorithm/sort.hpp>
-#include <adobe/algorithm/sorted.hpp>
 
 #include <adobe/any_regular.hpp>
 #include <adobe/array.hpp>
 #include <adobe/dictionary.hpp>
+#include <adobe/mapped_file.hpp>
 #include <adobe/name.hpp>
+#include <adobe/static_hash_table.hpp>
 
 #include <adobe/implementation/token.hpp>
 
@@ -38,38 +36,27 @@ using namespace adobe;
 
 /**************************************************************************************************/
 
-static_name_t constant_k = "constant"_name;
-static_name_t external_k = "external"_name;
-static_name_t input_k = "input"_name;
-static_name_t interface_k = "interface"_name;
-static_name_t invariant_k = "invariant"_name;
-static_name_t logic_k = "logic"_name;
-static_name_t output_k = "output"_name;
-static_name_t relate_k = "relate"_name;
-static_name_t sheet_k = "sheet"_name;
-static_name_t unlink_k = "unlink"_name;
-static_name_t when_k = "when"_name;
+constexpr static_name_t constant_k = "constant"_name;
+constexpr static_name_t external_k = "external"_name;
+constexpr static_name_t input_k = "input"_name;
+constexpr static_name_t interface_k = "interface"_name;
+constexpr static_name_t invariant_k = "invariant"_name;
+constexpr static_name_t logic_k = "logic"_name;
+constexpr static_name_t output_k = "output"_name;
+constexpr static_name_t relate_k = "relate"_name;
+constexpr static_name_t sheet_k = "sheet"_name;
+constexpr static_name_t unlink_k = "unlink"_name;
+constexpr static_name_t when_k = "when"_name;
 
-static_name_t keyword_table[] = {
+constexpr auto keyword_table = make_static_hash_set({
     constant_k, external_k, input_k, interface_k, invariant_k, logic_k,
     output_k,   relate_k,   sheet_k, unlink_k,    when_k,
-};
+});
 
 /**************************************************************************************************/
 
 bool keyword_lookup(const adobe::name_t& name) {
-    using namespace adobe;
-
-#ifndef NDEBUG
-    static bool inited = false;
-    if (!inited) {
-        assert(is_sorted(keyword_table));
-        inited = true;
-    }
-#endif
-
-    return binary_search(keyword_table, name, adobe::less(), constructor<name_t>()) !=
-           boost::end(keyword_table);
+    return keyword_table.contains(name);
 }
 
 /**************************************************************************************************/
@@ -99,6 +86,16 @@ adam_parser::adam_parser(std::istream& in, const line_position_t& position,
     assert(adam_callback_suite_m.add_interface_proc_m);
 }
 
+adam_parser::adam_parser(std::string_view source, const line_position_t& position,
+                         const adam_callback_suite_t& callbacks)
+    : expression_parser(source, position), adam_callback_suite_m(callbacks) {
+    set_keyword_extension_lookup(std::bind(&keyword_lookup, _1));
+
+    assert(adam_callback_suite_m.add_cell_proc_m); // all callbacks are required.
+    assert(adam_callback_suite_m.add_relation_proc_m);
+    assert(adam_callback_suite_m.add_interface_proc_m);
+}
+
 /**************************************************************************************************/
 
 void parse(std::istream& stream, const line_position_t& position,
@@ -108,6 +105,21 @@ void parse(std::istream& stream, const line_position_t& position,
 
 /**************************************************************************************************/
 
+void parse(std::string_view source, const line_position_t& position,
+           const adam_callback_suite_t& callbacks) {
+    adam_parser(source, position, callbacks).parse();
+}
+
+/**************************************************************************************************/
+
+void parse_file(const std::filesystem::path& path, const adam_callback_suite_t& callbacks) {
+    mapped_file_t file(path);
+    const auto name(path.u8string()); // std::u8string from C++20
+    parse(file.view(), line_position_t(reinterpret_cast<const char*>(name.c_str())), callbacks);
+}
+
+/**************************************************************************************************/
+
 array_t parse_adam_expression(const std::string& str_expression) {
     std::stringstream expression_stream(str_expression);
 
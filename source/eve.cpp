@@ -7,10 +7,18 @@
 
 #include <adobe/eve.hpp>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <boost/iterator/filter_iterator.hpp>
 #include <boost/iterator/transform_iterator.hpp>
@@ -22,8 +30,10 @@
 #include <adobe/cmath.hpp>
 #include <adobe/forest.hpp>
 #include <adobe/functional.hpp>
+#include <adobe/future.hpp>
 #include <adobe/iterator.hpp>
 #include <adobe/numeric.hpp>
+#include <adobe/wyhash.hpp>
 
 #ifndef NDEBUG
 #include <iostream>
@@ -88,6 +98,9 @@ struct view_proxy_t : adobe::extents_slices_t {
     poly_placeable_t& placeable_m;
 
     bool visible_m;
+    bool dirty_m;          // must be measured again
+    bool vertical_dirty_m; // must be measured vertically again
+    bool placed_valid_m; // placed_m holds the place data last given to the placeable
 
     typedef std::array<guide_set_t, 2> fr_guide_set_t;
 
@@ -101,12 +114,21 @@ struct view_proxy_t : adobe::extents_slices_t {
     std::array<fr_guide_set_t, 2> container_guide_set_m; // forward/reverse guide set for
     // container
 
+    extents_t::slice_t first_vertical_m;         // vertical slice the last measure gave
+    place_data_t::slice_t measured_horizontal_m; // placement the last measure_vertical saw
+    extents_t::slice_t measured_vertical_m;      // result of the last measure_vertical
+    place_data_t placed_m;
+
+    void invalidate();
+    void measure();
     void calculate();
+    void invalidate_vertical(bool force);
+    void measure_vertical();
     void calculate_vertical();
-    void place();
+    void place(bool force);
 
     void adjust(::child_iterator, ::child_iterator, slice_select_t);
-    void solve_up(::child_iterator, ::child_iterator, slice_select_t slice);
+    bool solve_up(::child_iterator, ::child_iterator, slice_select_t slice);
     bool solve_down(::child_iterator, ::child_iterator, slice_select_t slice);
     void layout(::child_iterator, ::child_iterator, slice_select_t slice);
     void flatten(::child_iterator, ::child_iterator, slice_select_t slice,
@@ -117,8 +139,8 @@ struct view_proxy_t : adobe::extents_slices_t {
     void adjust_outsets_cross(::child_iterator first, ::child_iterator last, slice_select_t slice);
     void adjust_with(::child_iterator first, ::child_iterator last, slice_select_t slice);
     void adjust_cross(::child_iterator first, ::child_iterator last, slice_select_t slice);
-    void solve_up_with(::child_iterator first, ::child_iterator last, slice_select_t slice);
-    void solve_up_cross(::child_iterator first, ::child_iterator last, slice_select_t slice);
+    bool solve_up_with(::child_iterator first, ::child_iterator last, slice_select_t slice);
+    bool solve_up_cross(::child_iterator first, ::child_iterator last, slice_select_t slice);
     bool solve_down_with(::child_iterator first, ::child_iterator last, slice_select_t slice);
     bool solve_down_cross(::child_iterator first, ::child_iterator last, slice_select_t slice);
     void layout_with(::child_iterator first, ::child_iterator last, slice_select_t slice);
@@ -248,18 +270,30 @@ public:
 
     ~implementation_t();
 
-    std::pair<int, int> evaluate(evaluate_options_t, int width, int height);
-    std::pair<int, int> adjust(evaluate_options_t options, int width, int height);
+    std::pair<int, int> evaluate(evaluate_options_t, int width, int height, bool incremental);
+    std::pair<int, int> adjust(evaluate_options_t options, int width, int height, bool force);
     iterator add_placeable(iterator parent, const layout_attributes_t& initial,
                            bool is_container_type, poly_placeable_t& placeable, bool reverse);
     void set_visible(iterator, bool);
     void set_layout_attributes(iterator, const layout_attributes_t&);
+    void invalidate(iterator);
+    void set_concurrent_measure(bool x) { concurrent_measure_m = x; }
+    void set_layout_cache(std::shared_ptr<layout_cache_t> x) { layout_cache_m = std::move(x); }
 
     void print_debug(std::ostream& os);
 
+    statistics_t statistics_m;
+
 private:
     void solve(slice_select_t select);
     void layout(slice_select_t select, int optional_length);
+    void measure_concurrently(bool implementation::view_proxy_t::*dirty,
+                              void (implementation::view_proxy_t::*measure)());
+    std::pair<int, int> solve_and_place(evaluate_options_t options, int width, int height,
+                                        bool force);
+    std::uint64_t layout_key(evaluate_options_t options, int width, int height);
+    bool replay_layout(std::uint64_t hash, bool force);
+    void cache_layout(std::uint64_t hash);
 
 
     typedef edge_iterator<cursor, adobe::forest_trailing_edge> postorder_iterator;
@@ -274,6 +308,47 @@ private:
     }
 
     proxy_tree_t proxies_m;
+
+    /*
+        The arguments and result of the last layout. While nothing has been marked since the last
+        evaluation, another incremental evaluation with the same arguments has the same result.
+    */
+    bool dirty_m{true};
+    evaluate_options_t last_options_m{evaluate_nested};
+    std::pair<int, int> last_size_m{0, 0};
+    std::pair<int, int> last_result_m{0, 0};
+
+    bool concurrent_measure_m{false};
+
+    std::shared_ptr<layout_cache_t> layout_cache_m;
+    std::vector<int> layout_key_m; // the key of the layout being looked up
+
+    /*
+        The working storage of solve(), kept between calls so that a layout of the same views
+        allocates nothing.
+    */
+    struct solve_scratch_t {
+        struct node_t {
+            cursor position_m;
+            std::size_t parent_m;
+            std::size_t first_child_m;
+            std::size_t next_sibling_m;
+            std::size_t postorder_m;
+        };
+
+        std::vector<node_t> nodes_m;
+        std::vector<std::size_t> by_postorder_m;
+        std::vector<std::size_t> ancestors_m;
+        std::vector<std::size_t> last_child_m;
+        std::vector<std::size_t> down_now_m;
+        std::vector<std::size_t> down_next_m;
+        std::vector<std::size_t> up_now_m;
+        std::vector<char> marked_down_m;
+        std::vector<char> marked_next_m;
+        std::vector<char> marked_up_m;
+    };
+
+    solve_scratch_t solve_scratch_m;
 };
 
 /**************************************************************************************************/
@@ -285,15 +360,22 @@ eve_t::~eve_t() { delete object_m; }
 #endif
 
 std::pair<int, int> eve_t::evaluate(evaluate_options_t options, int width, int height) {
-    return object_m->evaluate(options, width, height);
+    return object_m->evaluate(options, width, height, false);
+}
+
+std::pair<int, int> eve_t::evaluate_incremental(evaluate_options_t options, int width,
+                                                int height) {
+    return object_m->evaluate(options, width, height, true);
 }
 
 std::pair<int, int> eve_t::adjust(evaluate_options_t options, int width, int height) {
-    return object_m->adjust(options, width, height);
+    return object_m->adjust(options, width, height, true);
 }
 
 void eve_t::print_debug(std::ostream& os) { object_m->print_debug(os); }
 
+const eve_t::statistics_t& eve_t::statistics() const { return object_m->statistics_m; }
+
 eve_t::iterator eve_t::add_placeable(iterator parent, const layout_attributes_t& initial,
                                      bool is_container_type,      // is the element a container?
                                      poly_placeable_t& placeable, // signals to call for the element
@@ -307,6 +389,14 @@ void eve_t::set_layout_attributes(iterator c, const layout_attributes_t& geometr
     return object_m->set_layout_attributes(c, geometry);
 }
 
+void eve_t::invalidate(iterator c) { object_m->invalidate(c); }
+
+void eve_t::set_concurrent_measure(bool x) { object_m->set_concurrent_measure(x); }
+
+void eve_t::set_layout_cache(std::shared_ptr<layout_cache_t> x) {
+    object_m->set_layout_cache(std::move(x));
+}
+
 
 /**************************************************************************************************/
 
@@ -343,6 +433,8 @@ eve_t::iterator eve_t::implementation_t::add_placeable(iterator parent,
     if (!is_container_type)
         parent->geometry_m.placement_m = place_leaf;
 
+    dirty_m = true;
+
     return parent;
 }
 
@@ -420,11 +512,23 @@ void with_default_formatting(std::ostream& os, F&& f) {
 
 /**************************************************************************************************/
 
-void eve_t::implementation_t::set_visible(iterator c, bool visible) { c->visible_m = visible; }
+void eve_t::implementation_t::set_visible(iterator c, bool visible) {
+    if (c->visible_m == visible)
+        return;
+
+    c->visible_m = visible;
+    invalidate(c);
+}
 
 void eve_t::implementation_t::set_layout_attributes(iterator c,
                                                     const layout_attributes_t& geometry) {
     c->geometry_m = geometry;
+    invalidate(c);
+}
+
+void eve_t::implementation_t::invalidate(iterator c) {
+    c->invalidate();
+    dirty_m = true;
 }
 
 void eve_t::implementation_t::print_debug(std::ostream& output_stream) {
@@ -481,13 +585,152 @@ void eve_t::implementation_t::print_debug(std::ostream& output_stream) {
 /**************************************************************************************************/
 
 void eve_t::implementation_t::solve(slice_select_t select) {
-    adobe::for_each_position(
-        postorder_range(),
-        apply_to_children<postorder_iterator>(&implementation::view_proxy_t::solve_up, select));
+    /*
+        Guides are solved by alternating passes: a preorder pass of solve_down(), pushing the
+        guides of each container into its children, then a postorder pass of solve_up(),
+        recomputing each container from its children, until no solve_down() moves a guide.
+
+        A container's solve_down() reads its guides and its children's guides and lengths, and
+        writes its children's guides; solve_up() reads the same and writes the container's guides
+        and length. Each is a no-op unless one of its inputs changed since it was last called -
+        except a solve_down() which moved a guide, as it stops after the first child it moves. So
+        rather than sweep every container, each pass visits only those whose inputs changed, in
+        the order a full sweep would, which gives the same solution as full sweeps in the same
+        number of passes while doing work proportional to the guides that move.
+    */
+
+    constexpr std::size_t none_k = std::size_t(-1);
 
-    // REVISIT (sparent) : HUGE opportunities to optimize this.
+    solve_scratch_t& scratch(solve_scratch_m);
+    std::vector<solve_scratch_t::node_t>& nodes(scratch.nodes_m); // the containers, in preorder
+    std::vector<std::size_t>& by_postorder(scratch.by_postorder_m);
+    std::vector<std::size_t>& ancestors(scratch.ancestors_m);
+
+    nodes.clear();
+    by_postorder.clear();
+    ancestors.clear();
+
+    {
+        std::vector<std::size_t>& last_child(scratch.last_child_m);
+
+        last_child.clear();
+
+        for (auto first(std::begin(filter_fullorder_range(proxies_m, filter_visible()))),
+             last(std::end(filter_fullorder_range(proxies_m, filter_visible())));
+             first != last; ++first) {
+            if (first->geometry_m.placement_m == place_leaf)
+                continue;
+
+            if (first.edge() == forest_trailing_edge) {
+                nodes[ancestors.back()].postorder_m = by_postorder.size();
+                by_postorder.push_back(ancestors.back());
+                ancestors.pop_back();
+                continue;
+            }
+
+            const std::size_t index(nodes.size());
+            const std::size_t parent(ancestors.empty() ? none_k : ancestors.back());
+
+            nodes.push_back(solve_scratch_t::node_t{first, parent, none_k, none_k, 0});
+            last_child.push_back(none_k);
+
+            if (parent != none_k) {
+                if (last_child[parent] == none_k)
+                    nodes[parent].first_child_m = index;
+                else
+                    nodes[last_child[parent]].next_sibling_m = index;
+                last_child[parent] = index;
+            }
+
+            ancestors.push_back(index);
+        }
+    }
+
+    auto solve_up = [&](std::size_t i) {
+        ++statistics_m.solve_visits_m;
+        cursor c(nodes[i].position_m);
+        return c->solve_up(::child_begin(c), ::child_end(c), select);
+    };
+
+    auto solve_down = [&](std::size_t i) {
+        ++statistics_m.solve_visits_m;
+        cursor c(nodes[i].position_m);
+        return c->solve_down(::child_begin(c), ::child_end(c), select);
+    };
+
+    /*
+        The containers to visit: down_now holds preorder indices and up_now postorder indices, as
+        min-heaps, so a container marked for this pass ahead of the current one is still visited
+        in it. down_next holds those to visit in the next pass.
+    */
+
+    std::vector<std::size_t>& down_now(scratch.down_now_m);
+    std::vector<std::size_t>& down_next(scratch.down_next_m);
+    std::vector<std::size_t>& up_now(scratch.up_now_m);
+    std::vector<char>& marked_down(scratch.marked_down_m);
+    std::vector<char>& marked_next(scratch.marked_next_m);
+    std::vector<char>& marked_up(scratch.marked_up_m);
+
+    down_now.clear();
+    down_next.clear();
+    up_now.clear();
+    marked_down.assign(nodes.size(), false);
+    marked_next.assign(nodes.size(), false);
+    marked_up.assign(nodes.size(), false);
+
+    auto mark = [](std::vector<std::size_t>& heap, std::vector<char>& marked, std::size_t key,
+                   std::size_t i) {
+        if (marked[i])
+            return;
+        marked[i] = true;
+        heap.push_back(key);
+        std::push_heap(heap.begin(), heap.end(), std::greater<std::size_t>());
+    };
+
+    auto pop = [](std::vector<std::size_t>& heap) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<std::size_t>());
+        std::size_t result(heap.back());
+        heap.pop_back();
+        return result;
+    };
+
+    auto mark_next = [&](std::size_t i) {
+        if (i != none_k && !marked_next[i]) {
+            marked_next[i] = true;
+            down_next.push_back(i);
+        }
+    };
+
+    auto mark_up = [&](std::size_t i) { mark(up_now, marked_up, nodes[i].postorder_m, i); };
+
+    /*
+        A container which changes in solve_up() changes the inputs of its parent's solve_up(),
+        in this pass, and of its own and its parent's solve_down(), in the next.
+    */
+    auto up_pass = [&] {
+        while (!up_now.empty()) {
+            const std::size_t i(by_postorder[pop(up_now)]);
+
+            marked_up[i] = false;
+
+            if (!solve_up(i))
+                continue;
 
-    // solve until things settle down.
+            mark_next(i);
+            mark_next(nodes[i].parent_m);
+
+            if (nodes[i].parent_m != none_k)
+                mark_up(nodes[i].parent_m);
+        }
+    };
+
+    for (std::size_t i : by_postorder)
+        mark_up(i);
+
+    up_pass();
+
+    for (std::size_t i(0); i != nodes.size(); ++i)
+        mark_next(i);
 
     bool progress(false);
 
@@ -503,18 +746,40 @@ void eve_t::implementation_t::solve(slice_select_t select) {
 
     do {
         --limiter;
+        ++statistics_m.solve_passes_m;
         progress = false;
 
-        for (preorder_iterator first(std::begin(preorder_range())),
-             last(std::end(preorder_range()));
-             first != last; ++first) {
-            progress |=
-                first->solve_down(::child_begin(first.base()), ::child_end(first.base()), select);
+        for (std::size_t i : down_next) {
+            marked_next[i] = false;
+            mark(down_now, marked_down, i, i);
+        }
+        down_next.clear();
+
+        /*
+            A container which moves the guides of its children changes their inputs, to visit
+            later in this pass, and is visited again in the next.
+        */
+        while (!down_now.empty()) {
+            const std::size_t i(pop(down_now));
+
+            marked_down[i] = false;
+
+            if (!solve_down(i))
+                continue;
+
+            progress = true;
+
+            mark_next(i);
+            mark_up(i);
+
+            for (std::size_t child(nodes[i].first_child_m); child != none_k;
+                 child = nodes[child].next_sibling_m) {
+                mark(down_now, marked_down, child, child);
+                mark_up(child);
+            }
         }
 
-        adobe::for_each_position(postorder_range(),
-                                 ::apply_to_children<postorder_iterator>(
-                                     &implementation::view_proxy_t::solve_up, select));
+        up_pass();
 
     } while (progress && limiter);
 
@@ -544,21 +809,112 @@ void eve_t::implementation_t::layout(slice_select_t select, int optional_length)
 
 /**************************************************************************************************/
 
+namespace {
+
+/// Adds the time since it was constructed or last called to a phase of eve_t::statistics_t.
+class phase_timer_t {
+public:
+    void operator()(eve_t::statistics_t::duration_t& phase) {
+        const std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+        phase += now - last_m;
+        last_m = now;
+    }
+
+private:
+    std::chrono::steady_clock::time_point last_m{std::chrono::steady_clock::now()};
+};
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+/*
+    Measures the visible views marked dirty whose placeables are thread safe, in parallel. Measures
+    only write to their own view, so the serial pass which follows, measuring the rest and
+    aggregating in order, lays out the same as if it had measured them all.
+*/
+
+void eve_t::implementation_t::measure_concurrently(
+    bool implementation::view_proxy_t::*dirty, void (implementation::view_proxy_t::*measure)()) {
+    std::vector<implementation::view_proxy_t*> views;
+
+    for (auto& proxy : postorder_range()) {
+        if (proxy.*dirty && proxy.placeable_m.measure_is_thread_safe())
+            views.push_back(&proxy);
+    }
+
+    if (views.size() < 2)
+        return;
+
+    adobe::for_each_async(views.size(), [&](std::size_t i) { (views[i]->*measure)(); });
+}
+
+/**************************************************************************************************/
+
 std::pair<int, int> eve_t::implementation_t::evaluate(evaluate_options_t options, int width,
-                                                      int height) {
+                                                      int height, bool incremental) {
+    if (incremental && !dirty_m && options == last_options_m &&
+        std::make_pair(width, height) == last_size_m)
+        return last_result_m;
+
+    phase_timer_t timer;
+
+    if (!incremental)
+        adobe::for_each(postorder_range(), &proxy_tree_t::value_type::invalidate);
+
     // Calculate
 
+    if (concurrent_measure_m)
+        measure_concurrently(&proxy_tree_t::value_type::dirty_m,
+                             &proxy_tree_t::value_type::measure);
+
     adobe::for_each(postorder_range(), &proxy_tree_t::value_type::calculate);
 
+    dirty_m = false;
+    timer(statistics_m.calculate_time_m);
+
     // adjust
 
-    return adjust(options, width, height);
+    return adjust(options, width, height, !incremental);
 }
 
 /**************************************************************************************************/
 
 std::pair<int, int> eve_t::implementation_t::adjust(evaluate_options_t options, int width,
-                                                    int height) {
+                                                    int height, bool force) {
+    if (!layout_cache_m)
+        return solve_and_place(options, width, height, force);
+
+    phase_timer_t timer;
+    const std::uint64_t hash(layout_key(options, width, height));
+
+    if (replay_layout(hash, force)) {
+        ++statistics_m.layout_cache_hits_m;
+        last_options_m = options;
+        last_size_m = std::make_pair(width, height);
+        timer(statistics_m.place_time_m);
+        return last_result_m;
+    }
+
+    ++statistics_m.layout_cache_misses_m;
+    timer(statistics_m.place_time_m);
+    solve_and_place(options, width, height, force);
+
+    phase_timer_t cache_timer;
+    cache_layout(hash);
+    cache_timer(statistics_m.place_time_m);
+
+    return last_result_m;
+}
+
+/**************************************************************************************************/
+
+std::pair<int, int> eve_t::implementation_t::solve_and_place(evaluate_options_t options, int width,
+                                                             int height, bool force) {
+    phase_timer_t timer;
+
     // adjust
 
     adobe::for_each_position(
@@ -568,6 +924,7 @@ std::pair<int, int> eve_t::implementation_t::adjust(evaluate_options_t options,
     // solve
 
     solve(horizontal); // Not necessary
+    timer(statistics_m.solve_time_m);
     layout(horizontal, width);
 
     // adjust outsets
@@ -575,14 +932,24 @@ std::pair<int, int> eve_t::implementation_t::adjust(evaluate_options_t options,
     adobe::for_each_position(postorder_range(),
                              apply_to_children<postorder_iterator>(
                                  &implementation::view_proxy_t::adjust_outsets, horizontal));
+    timer(statistics_m.layout_time_m);
 
     // flatten
 
     adobe::for_each_position(preorder_range(), apply_flatten_t(horizontal, options));
+    timer(statistics_m.flatten_time_m);
 
     // give the client a crack at adjusting vertical
 
+    for (auto& proxy : postorder_range())
+        proxy.invalidate_vertical(force);
+
+    if (concurrent_measure_m)
+        measure_concurrently(&proxy_tree_t::value_type::vertical_dirty_m,
+                             &proxy_tree_t::value_type::measure_vertical);
+
     adobe::for_each(postorder_range(), &proxy_tree_t::value_type::calculate_vertical);
+    timer(statistics_m.calculate_time_m);
 
     // adjust
 
@@ -593,6 +960,7 @@ std::pair<int, int> eve_t::implementation_t::adjust(evaluate_options_t options,
     // solve
 
     solve(vertical);
+    timer(statistics_m.solve_time_m);
     layout(vertical, height);
 
     // adjust outsets
@@ -600,17 +968,194 @@ std::pair<int, int> eve_t::implementation_t::adjust(evaluate_options_t options,
     adobe::for_each_position(postorder_range(),
                              apply_to_children<postorder_iterator>(
                                  &implementation::view_proxy_t::adjust_outsets, vertical));
+    timer(statistics_m.layout_time_m);
 
     // flatten
 
     adobe::for_each_position(preorder_range(), apply_flatten_t(vertical, options));
+    timer(statistics_m.flatten_time_m);
 
     // place
 
-    adobe::for_each(preorder_range(), &proxy_tree_t::value_type::place);
+    for (auto& proxy : preorder_range())
+        proxy.place(force);
+    timer(statistics_m.place_time_m);
+
+    last_options_m = options;
+    last_size_m = std::make_pair(width, height);
+    last_result_m = std::make_pair(proxies_m.front().place_m.horizontal().length_m,
+                                   proxies_m.front().place_m.vertical().length_m);
 
-    return std::make_pair(proxies_m.front().place_m.horizontal().length_m,
-                          proxies_m.front().place_m.vertical().length_m);
+    return last_result_m;
+}
+
+/**************************************************************************************************/
+
+struct eve_t::layout_cache_t::implementation_t {
+    struct entry_t {
+        std::uint64_t hash_m;
+        std::vector<int> key_m;
+        std::vector<place_data_t> places_m; // of the visible views, in preorder
+        std::pair<int, int> result_m;
+    };
+
+    using list_t = std::list<entry_t>;
+
+    explicit implementation_t(std::size_t capacity) : capacity_m(capacity) {}
+
+    const std::size_t capacity_m;
+    list_t entries_m; // the most recently used first
+    std::unordered_map<std::uint64_t, list_t::iterator> index_m; // one entry per hash
+    mutable std::mutex mutex_m;
+};
+
+/**************************************************************************************************/
+
+eve_t::layout_cache_t::layout_cache_t(std::size_t capacity)
+    : object_m(new implementation_t(capacity)) {}
+
+eve_t::layout_cache_t::~layout_cache_t() { delete object_m; }
+
+std::size_t eve_t::layout_cache_t::capacity() const { return object_m->capacity_m; }
+
+std::size_t eve_t::layout_cache_t::size() const {
+    std::lock_guard<std::mutex> lock(object_m->mutex_m);
+    return object_m->entries_m.size();
+}
+
+void eve_t::layout_cache_t::clear() {
+    implementation_t::list_t entries;
+
+    {
+        std::lock_guard<std::mutex> lock(object_m->mutex_m);
+        entries.swap(object_m->entries_m);
+        object_m->index_m.clear();
+    }
+}
+
+/**************************************************************************************************/
+
+/*
+    Writes everything the layout of the visible views depends on to layout_key_m, and returns its
+    hash: the arguments, the shape of the view tree, and each view's measurements and attributes.
+    The vertical slice a two pass placeable measures is left out, as it follows from the rest.
+*/
+
+std::uint64_t eve_t::implementation_t::layout_key(evaluate_options_t options, int width,
+                                                 int height) {
+    enum { leading_k, trailing_k };
+
+    std::vector<int>& key(layout_key_m);
+
+    key.assign({options, width, height});
+
+    auto append_slice = [&](const extents_t::slice_t& x) {
+        key.insert(key.end(), {x.length_m, x.outset_m.first, x.outset_m.second, x.frame_m.first,
+                               x.frame_m.second, x.inset_m.first, x.inset_m.second,
+                               static_cast<int>(x.guide_set_m.size())});
+        key.insert(key.end(), x.guide_set_m.begin(), x.guide_set_m.end());
+    };
+
+    for (auto first(std::begin(filter_fullorder_range(proxies_m, filter_visible()))),
+         last(std::end(filter_fullorder_range(proxies_m, filter_visible())));
+         first != last; ++first) {
+        if (first.edge() == forest_trailing_edge) {
+            key.push_back(trailing_k);
+            continue;
+        }
+
+        const layout_attributes_t& geometry(first->geometry_m);
+
+        key.push_back(leading_k);
+        append_slice(geometry.extents_m.horizontal());
+        append_slice(first->first_vertical_m);
+
+        key.insert(key.end(), {geometry.indent_m, geometry.create_m, geometry.placement_m,
+                               static_cast<int>(geometry.spacing_m.size())});
+        key.insert(key.end(), geometry.spacing_m.begin(), geometry.spacing_m.end());
+
+        for (const layout_attributes_t::slice_t& e : geometry.slice_m) {
+            key.insert(key.end(), {e.alignment_m, e.suppress_m, e.balance_m, e.margin_m.first,
+                                   e.margin_m.second, e.child_alignment_m});
+        }
+    }
+
+    return wyhash(reinterpret_cast<const char*>(key.data()), key.size() * sizeof(int));
+}
+
+/**************************************************************************************************/
+
+/*
+    If the cache holds a layout for layout_key_m, places the views as it did and returns true.
+    The placeables are called outside of the cache lock.
+*/
+
+bool eve_t::implementation_t::replay_layout(std::uint64_t hash, bool force) {
+    layout_cache_t::implementation_t& cache(*layout_cache_m->object_m);
+
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex_m);
+
+        auto index(cache.index_m.find(hash));
+
+        // The full key is compared, a hash collision is a miss.
+        if (index == cache.index_m.end() || index->second->key_m != layout_key_m)
+            return false;
+
+        auto found(index->second);
+
+        cache.entries_m.splice(cache.entries_m.begin(), cache.entries_m, found);
+
+        auto place(found->places_m.begin());
+
+        for (auto& proxy : preorder_range())
+            proxy.place_m = *place++;
+
+        last_result_m = found->result_m;
+    }
+
+    for (auto& proxy : preorder_range())
+        proxy.place(force);
+
+    return true;
+}
+
+/**************************************************************************************************/
+
+void eve_t::implementation_t::cache_layout(std::uint64_t hash) {
+    layout_cache_t::implementation_t& cache(*layout_cache_m->object_m);
+
+    if (cache.capacity_m == 0)
+        return;
+
+    layout_cache_t::implementation_t::list_t entry(1);
+
+    entry.front().hash_m = hash;
+    entry.front().key_m = layout_key_m;
+    entry.front().result_m = last_result_m;
+
+    for (auto& proxy : preorder_range())
+        entry.front().places_m.push_back(proxy.place_m);
+
+    std::lock_guard<std::mutex> lock(cache.mutex_m);
+
+    /*
+        Another eve_t sharing the cache may have added the same layout meanwhile, or a layout with
+        the same hash. Either is replaced.
+    */
+    auto index(cache.index_m.emplace(hash, entry.begin()));
+
+    if (!index.second) {
+        cache.entries_m.erase(index.first->second);
+        index.first->second = entry.begin();
+    }
+
+    cache.entries_m.splice(cache.entries_m.begin(), entry);
+
+    if (cache.entries_m.size() > cache.capacity_m) {
+        cache.index_m.erase(cache.entries_m.back().hash_m);
+        cache.entries_m.pop_back();
+    }
 }
 
 /**************************************************************************************************/
@@ -626,24 +1171,38 @@ namespace implementation {
 /**************************************************************************************************/
 
 view_proxy_t::view_proxy_t(const adobe::layout_attributes_t& d, poly_placeable_t& p)
-    : placeable_m(p), visible_m(true), geometry_m(d) {}
+    : placeable_m(p), visible_m(true), dirty_m(true), vertical_dirty_m(false),
+      placed_valid_m(false), geometry_m(d) {}
 
 /**************************************************************************************************/
 
-void view_proxy_t::calculate() {
+void view_proxy_t::invalidate() {
+    dirty_m = true;
+    placed_valid_m = false;
+}
+
+/**************************************************************************************************/
+
+void view_proxy_t::measure() {
     /*
-        REVISIT (sparent) : What we want is for the data from placeable widgets to be preserved
-        unless they are explicity dirtied - rather than calling measure for every update.
-        For now, there are several bugs caused by the measuring code in widgets assuming that
-       the
-        initial extents it is handed is a defaulted extents. Without that - some code
-       accumulates
-        metrics into the extents giving ever increasing growth when a window is resized (as an
-        example). This fix is a hack - to just always clear the extents before measuring.
+        The data from the placeable is preserved unless it is explicitly dirtied. Widgets may
+        assume the extents they are handed to measure are defaulted - some accumulate metrics
+        into them, which would give ever increasing growth when a window is resized - so each
+        measure starts from cleared extents. The layout passes only read the extents, except for
+        calculate_vertical() replacing the vertical slice of a two pass placeable, so only that
+        slice is kept aside.
     */
     geometry_m.extents_m = extents_t();
-
     placeable_m.measure(geometry_m.extents_m);
+    first_vertical_m = geometry_m.extents_m.vertical();
+    dirty_m = false;
+}
+
+/**************************************************************************************************/
+
+void view_proxy_t::calculate() {
+    if (dirty_m)
+        measure();
 
     extents_t::slice_t& eslice = geometry_m.extents_m.horizontal();
 
@@ -675,14 +1234,33 @@ void view_proxy_t::calculate() {
 
 /**************************************************************************************************/
 
+void view_proxy_t::invalidate_vertical(bool force) {
+    // The vertical measure depends only on the horizontal measure and placement.
+    vertical_dirty_m = poly_cast<poly_placeable_twopass_t*>(&placeable_m) &&
+                       (force || !placed_valid_m || place_m.horizontal() != measured_horizontal_m);
+}
+
+/**************************************************************************************************/
+
+void view_proxy_t::measure_vertical() {
+    // We pass a copy of the geometry so client can't modify horizontal properties.
+    extents_t vertical_stuff(geometry_m.extents_m);
+    vertical_stuff.vertical() = first_vertical_m;
+    poly_cast<poly_placeable_twopass_t&>(placeable_m).measure_vertical(vertical_stuff, place_m);
+    measured_vertical_m = vertical_stuff.vertical();
+    measured_horizontal_m = place_m.horizontal();
+    vertical_dirty_m = false;
+}
+
+/**************************************************************************************************/
+
 void view_proxy_t::calculate_vertical() {
     extents_t::slice_t& eslice = geometry_m.extents_m.vertical();
 
-    if (poly_placeable_twopass_t* p = poly_cast<poly_placeable_twopass_t*>(&placeable_m)) {
-        // We pass a copy of the geometry so client can't modify horizontal properties.
-        extents_t vertical_stuff(geometry_m.extents_m);
-        p->measure_vertical(vertical_stuff, place_m);
-        eslice = vertical_stuff.vertical();
+    if (poly_cast<poly_placeable_twopass_t*>(&placeable_m)) {
+        if (vertical_dirty_m)
+            measure_vertical();
+        eslice = measured_vertical_m;
     }
 
     place_m.vertical().length_m = eslice.length_m;
@@ -696,7 +1274,14 @@ void view_proxy_t::calculate_vertical() {
 
 /**************************************************************************************************/
 
-void view_proxy_t::place() { placeable_m.place(place_m); }
+void view_proxy_t::place(bool force) {
+    if (!force && placed_valid_m && place_m == placed_m)
+        return;
+
+    placeable_m.place(place_m);
+    placed_m = place_m;
+    placed_valid_m = true;
+}
 
 /**************************************************************************************************/
 
@@ -753,20 +1338,20 @@ void view_proxy_t::adjust(::child_iterator first, ::child_iterator last, slice_s
 
 /**************************************************************************************************/
 
-void view_proxy_t::solve_up(::child_iterator first, ::child_iterator last, slice_select_t select) {
+bool view_proxy_t::solve_up(::child_iterator first, ::child_iterator last, slice_select_t select) {
     if (geometry_m.placement_m == adobe::eve_t::place_leaf)
-        return;
+        return false;
 
     if (select == vertical) {
         if (geometry_m.placement_m == adobe::eve_t::place_column)
-            solve_up_with(first, last, vertical);
+            return solve_up_with(first, last, vertical);
         else
-            solve_up_cross(first, last, vertical);
+            return solve_up_cross(first, last, vertical);
     } else {
         if (geometry_m.placement_m == adobe::eve_t::place_row)
-            solve_up_with(first, last, horizontal);
+            return solve_up_with(first, last, horizontal);
         else
-            solve_up_cross(first, last, horizontal);
+            return solve_up_cross(first, last, horizontal);
     }
 }
 
@@ -1383,8 +1968,9 @@ void view_proxy_t::adjust_cross(::child_iterator first, ::child_iterator last,
 
 /**************************************************************************************************/
 
-void view_proxy_t::solve_up_with(::child_iterator first, ::child_iterator last,
+bool view_proxy_t::solve_up_with(::child_iterator first, ::child_iterator last,
                                  slice_select_t select) {
+    bool result(false);
     const layout_attributes_t::slice_t& gslice(geometry_m.slice_m[select]);
     const extents_t::slice_t& eslice(geometry_m.extents_m.slice_m[select]);
     int length(eslice.frame_m.first + gslice.margin_m.first);
@@ -1416,7 +2002,10 @@ void view_proxy_t::solve_up_with(::child_iterator first, ::child_iterator last,
             for (guide_set_t::iterator guide(reverse_child_guide_set.begin());
                  guide != reverse_child_guide_set.end(); ++guide, ++reverse_guide_iter) {
                 ADOBE_ASSERT(reverse_guide_iter != reverse_guide_set.end());
-                *reverse_guide_iter = std::max(*reverse_guide_iter, *guide + rlength);
+                if (*guide + rlength > *reverse_guide_iter) {
+                    *reverse_guide_iter = *guide + rlength;
+                    result = true;
+                }
             }
 
             if ((rfirst->geometry_m.placement_m == adobe::eve_t::place_leaf) &&
@@ -1451,7 +2040,10 @@ void view_proxy_t::solve_up_with(::child_iterator first, ::child_iterator last,
             for (guide_set_t::iterator guide(forward_child_guide_set.begin());
                  guide != forward_child_guide_set.end(); ++guide, ++forward_guide_iter) {
                 ADOBE_ASSERT(forward_guide_iter != forward_guide_set.end());
-                *forward_guide_iter = std::max(*forward_guide_iter, *guide + length);
+                if (*guide + length > *forward_guide_iter) {
+                    *forward_guide_iter = *guide + length;
+                    result = true;
+                }
             }
 
             if ((iter->geometry_m.placement_m == adobe::eve_t::place_leaf) &&
@@ -1473,10 +2065,16 @@ void view_proxy_t::solve_up_with(::child_iterator first, ::child_iterator last,
         guide_set_t::iterator iter{adobe::max_adjacent_difference(forward_guide_set)};
 
         guide_set_t::value_type accumulate(forward_guide_set.front());
-
-        std::generate(
-            std::next(forward_guide_set.begin()), forward_guide_set.end(),
-            [&, _difference = *std::next(iter) - *iter] { return accumulate += _difference; });
+        const guide_set_t::value_type difference(*std::next(iter) - *iter);
+
+        for (guide_set_t::iterator guide(std::next(forward_guide_set.begin()));
+             guide != forward_guide_set.end(); ++guide) {
+            accumulate += difference;
+            if (*guide != accumulate) {
+                *guide = accumulate;
+                result = true;
+            }
+        }
     }
 
     length += additional_rlength;
@@ -1484,7 +2082,13 @@ void view_proxy_t::solve_up_with(::child_iterator first, ::child_iterator last,
     // update properties on this container.
 
     measured_length_m[select] = length;
-    container_length_m[select] = std::max(length, container_length_m[select]);
+
+    if (length > container_length_m[select]) {
+        container_length_m[select] = length;
+        result = true;
+    }
+
+    return result;
 }
 
 /**************************************************************************************************/
@@ -1609,8 +2213,9 @@ bool view_proxy_t::solve_down_with(::child_iterator first, ::child_iterator last
 
 /**************************************************************************************************/
 
-void view_proxy_t::solve_up_cross(::child_iterator first, ::child_iterator last,
+bool view_proxy_t::solve_up_cross(::child_iterator first, ::child_iterator last,
                                   slice_select_t select) {
+    bool result(false);
     const layout_attributes_t::slice_t& gslice(geometry_m.slice_m[select]);
     const extents_t::slice_t& eslice(geometry_m.extents_m.slice_m[select]);
     int near_additional(eslice.frame_m.first + gslice.margin_m.first);
@@ -1655,7 +2260,10 @@ void view_proxy_t::solve_up_cross(::child_iterator first, ::child_iterator last,
                  guide_last(forward_child_guide_set.end()), base_guide(forward_guide_set.begin());
                  guide_first != guide_last; ++guide_first, ++base_guide) {
                 ADOBE_ASSERT(base_guide != forward_guide_set.end());
-                *base_guide = std::max(*base_guide, *guide_first + forward_iter_length);
+                if (*guide_first + forward_iter_length > *base_guide) {
+                    *base_guide = *guide_first + forward_iter_length;
+                    result = true;
+                }
             }
         } break;
         default:
@@ -1673,7 +2281,10 @@ void view_proxy_t::solve_up_cross(::child_iterator first, ::child_iterator last,
                  guide_last(reverse_child_guide_set.end()), base_guide(reverse_guide_set.begin());
                  guide_first != guide_last; ++guide_first, ++base_guide) {
                 ADOBE_ASSERT(base_guide != reverse_guide_set.end());
-                *base_guide = std::max(*base_guide, *guide_first + reverse_iter_length);
+                if (*guide_first + reverse_iter_length > *base_guide) {
+                    *base_guide = *guide_first + reverse_iter_length;
+                    result = true;
+                }
             }
         } break;
         default:
@@ -1746,7 +2357,13 @@ void view_proxy_t::solve_up_cross(::child_iterator first, ::child_iterator last,
     // update properties on this container.
 
     measured_length_m[select] = length;
-    container_length_m[select] = std::max(length, container_length_m[select]);
+
+    if (length > container_length_m[select]) {
+        container_length_m[select] = length;
+        result = true;
+    }
+
+    return result;
 }
 
 /**************************************************************************************************/
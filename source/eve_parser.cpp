@@ -7,15 +7,15 @@
 
 #include <adobe/eve_parser.hpp>
 
-#include <adobe/algorithm/binary_search.hpp>
-#include <adobe/algorithm/sorted.hpp>
 #include <adobe/any_regular.hpp>
 #include <adobe/array.hpp>
 #include <adobe/cassert.hpp>
 #include <adobe/dictionary.hpp>
 #include <adobe/functional/operator.hpp>
 #include <adobe/implementation/token.hpp>
+#include <adobe/mapped_file.hpp>
 #include <adobe/name.hpp>
+#include <adobe/static_hash_table.hpp>
 #include <functional>
 #include <string>
 
@@ -34,33 +34,22 @@ using namespace adobe;
 
 /**************************************************************************************************/
 
-static_name_t constant_k = "constant"_name;
-static_name_t interface_k = "interface"_name;
-static_name_t layout_k = "layout"_name;
-static_name_t logic_k = "logic"_name;
-static_name_t relate_k = "relate"_name;
-static_name_t unlink_k = "unlink"_name;
-static_name_t view_k = "view"_name;
-static_name_t when_k = "when"_name;
+constexpr static_name_t constant_k = "constant"_name;
+constexpr static_name_t interface_k = "interface"_name;
+constexpr static_name_t layout_k = "layout"_name;
+constexpr static_name_t logic_k = "logic"_name;
+constexpr static_name_t relate_k = "relate"_name;
+constexpr static_name_t unlink_k = "unlink"_name;
+constexpr static_name_t view_k = "view"_name;
+constexpr static_name_t when_k = "when"_name;
 
-static_name_t keyword_table[] = {constant_k, interface_k, layout_k, logic_k,
-                                 relate_k,   unlink_k,    view_k,   when_k};
+constexpr auto keyword_table = make_static_hash_set(
+    {constant_k, interface_k, layout_k, logic_k, relate_k, unlink_k, view_k, when_k});
 
 /**************************************************************************************************/
 
 bool keyword_lookup(const name_t& name) {
-    using namespace adobe;
-
-#ifndef NDEBUG
-    static bool inited = false;
-    if (!inited) {
-        ADOBE_ASSERT(is_sorted(keyword_table));
-        inited = true;
-    }
-#endif
-
-    return binary_search(keyword_table, name, adobe::less(), constructor<name_t>()) !=
-           boost::end(keyword_table);
+    return keyword_table.contains(name);
 }
 
 /**************************************************************************************************/
@@ -78,6 +67,14 @@ public:
         //  ADOBE_ASSERT(assembler_m.add_cell_proc_m); Only required if you have a sheet state.
     }
 
+    eve_parser(const eve_callback_suite_t& assembler, std::string_view source,
+               const line_position_t& position)
+        : expression_parser(source, position), assembler_m(assembler) {
+        set_keyword_extension_lookup(std::bind(&keyword_lookup, _1));
+
+        ADOBE_ASSERT(assembler_m.add_view_proc_m);
+    }
+
     void parse(const position_t&);
 
 private:
@@ -504,6 +501,19 @@ void eve_parser::require_view_statement_list(const position_t& location) {
 
 /**************************************************************************************************/
 
+line_position_t parse(eve_parser& parser, const eve_callback_suite_t::position_t& position) {
+    try {
+        parser.parse(position);
+    } catch (const stream_error_t&) {
+        throw;
+    } catch (const exception& error) {
+        throw stream_error_t(error, parser.next_position());
+    }
+    return parser.next_position();
+}
+
+/**************************************************************************************************/
+
 } // namespace
 
 namespace adobe {
@@ -514,14 +524,27 @@ line_position_t parse(std::istream& in, const line_position_t& line_position,
                       const eve_callback_suite_t::position_t& position,
                       const eve_callback_suite_t& assembler) {
     eve_parser parser(assembler, in, line_position);
-    try {
-        parser.parse(position);
-    } catch (const stream_error_t&) {
-        throw;
-    } catch (const exception& error) {
-        throw stream_error_t(error, parser.next_position());
-    }
-    return parser.next_position();
+    return parse(parser, position);
+}
+
+/**************************************************************************************************/
+
+line_position_t parse(std::string_view source, const line_position_t& line_position,
+                      const eve_callback_suite_t::position_t& position,
+                      const eve_callback_suite_t& assembler) {
+    eve_parser parser(assembler, source, line_position);
+    return parse(parser, position);
+}
+
+/**************************************************************************************************/
+
+line_position_t parse_file(const std::filesystem::path& path,
+                           const eve_callback_suite_t::position_t& position,
+                           const eve_callback_suite_t& assembler) {
+    mapped_file_t file(path);
+    const auto name(path.u8string()); // std::u8string from C++20
+    return parse(file.view(), line_position_t(reinterpret_cast<const char*>(name.c_str())),
+                 position, assembler);
 }
 
 /**************************************************************************************************/
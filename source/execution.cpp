@@ -0,0 +1,45 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/algorithm/execution.hpp>
+
+#include <thread>
+
+using namespace std;
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+namespace execution {
+
+/**************************************************************************************************/
+
+namespace detail {
+
+/**************************************************************************************************/
+
+size_t concurrency() {
+    static const size_t result = max<size_t>(1, thread::hardware_concurrency());
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace detail
+
+/**************************************************************************************************/
+
+} // namespace execution
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
@@ -7,23 +7,25 @@
 
 #include <adobe/implementation/expression_filter.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cctype>
-#include <functional>
+#include <cstring>
 #include <iterator>
-#include <vector>
 #include <locale>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 
-#include <adobe/algorithm/copy.hpp>
-#include <adobe/algorithm/find.hpp>
-#include <adobe/algorithm/lower_bound.hpp>
-#include <adobe/functional.hpp>
-#include <adobe/table_index.hpp>
+#include <adobe/implementation/bit.hpp>
+#include <adobe/implementation/byte_scan.hpp>
+#include <adobe/static_hash_table.hpp>
 #include <adobe/unicode.hpp>
 
 /**************************************************************************************************/
 
 using namespace std;
-using namespace std::placeholders;
+using namespace adobe::literals;
 
 /**************************************************************************************************/
 
@@ -91,386 +93,432 @@ InputIterator datoi(InputIterator first, InputIterator last, Result& result) {
 
 /**************************************************************************************************/
 
-template <typename I, typename O, typename P>
-std::pair<I, O>
-copy_until(I first, I last, O output,
-           P pred = adobe::always_true<typename std::iterator_traits<I>::value_type>()) {
-    for (; first != last && pred(*first); ++first)
-        *output++ = *first;
-
-    return std::make_pair(first, output);
-}
+constexpr pair<adobe::static_name_t, std::uint32_t> entity_set_k[] = {
+    {"Aacute"_name, 0x00C1},
+    {"aacute"_name, 0x00E1},
+    {"Acirc"_name, 0x00C2},
+    {"acirc"_name, 0x00E2},
+    {"acute"_name, 0x00B4},
+    {"AElig"_name, 0x00C6},
+    {"aelig"_name, 0x00E6},
+    {"Agrave"_name, 0x00C0},
+    {"agrave"_name, 0x00E0},
+    {"alefsym"_name, 0x2135},
+    {"Alpha"_name, 0x0391},
+    {"alpha"_name, 0x03B1},
+    {"amp"_name, 0x0026},
+    {"and"_name, 0x2227},
+    {"ang"_name, 0x2220},
+    {"Aring"_name, 0x00C5},
+    {"aring"_name, 0x00E5},
+    {"asymp"_name, 0x2248},
+    {"Atilde"_name, 0x00C3},
+    {"atilde"_name, 0x00E3},
+    {"Auml"_name, 0x00C4},
+    {"auml"_name, 0x00E4},
+    {"bdquo"_name, 0x201E},
+    {"Beta"_name, 0x0392},
+    {"beta"_name, 0x03B2},
+    {"brvbar"_name, 0x00A6},
+    {"bull"_name, 0x2022},
+    {"cap"_name, 0x2229},
+    {"Ccedil"_name, 0x00C7},
+    {"ccedil"_name, 0x00E7},
+    {"cedil"_name, 0x00B8},
+    {"cent"_name, 0x00A2},
+    {"Chi"_name, 0x03A7},
+    {"chi"_name, 0x03C7},
+    {"circ"_name, 0x02C6},
+    {"clubs"_name, 0x2663},
+    {"cong"_name, 0x2245},
+    {"copy"_name, 0x00A9},
+    {"cr"_name, 0x000D},
+    {"crarr"_name, 0x21B5},
+    {"cup"_name, 0x222A},
+    {"curren"_name, 0x00A4},
+    {"dagger"_name, 0x2020},
+    {"Dagger"_name, 0x2021},
+    {"darr"_name, 0x2193},
+    {"dArr"_name, 0x21D3},
+    {"deg"_name, 0x00B0},
+    {"Delta"_name, 0x0394},
+    {"delta"_name, 0x03B4},
+    {"diams"_name, 0x2666},
+    {"divide"_name, 0x00F7},
+    {"Eacute"_name, 0x00C9},
+    {"eacute"_name, 0x00E9},
+    {"Ecirc"_name, 0x00CA},
+    {"ecirc"_name, 0x00EA},
+    {"Egrave"_name, 0x00C8},
+    {"egrave"_name, 0x00E8},
+    {"empty"_name, 0x2205},
+    {"emsp"_name, 0x2003},
+    {"ensp"_name, 0x2002},
+    {"Epsilon"_name, 0x0395},
+    {"epsilon"_name, 0x03B5},
+    {"equiv"_name, 0x2261},
+    {"Eta"_name, 0x0397},
+    {"eta"_name, 0x03B7},
+    {"ETH"_name, 0x00D0},
+    {"eth"_name, 0x00F0},
+    {"Euml"_name, 0x00CB},
+    {"euml"_name, 0x00EB},
+    {"euro"_name, 0x20AC},
+    {"exist"_name, 0x2203},
+    {"fnof"_name, 0x0192},
+    {"forall"_name, 0x2200},
+    {"frac12"_name, 0x00BD},
+    {"frac14"_name, 0x00BC},
+    {"frac34"_name, 0x00BE},
+    {"frasl"_name, 0x2044},
+    {"Gamma"_name, 0x0393},
+    {"gamma"_name, 0x03B3},
+    {"ge"_name, 0x2265},
+    {"gt"_name, 0x003E},
+    {"harr"_name, 0x2194},
+    {"hArr"_name, 0x21D4},
+    {"hearts"_name, 0x2665},
+    {"hellip"_name, 0x2026},
+    {"Iacute"_name, 0x00CD},
+    {"iacute"_name, 0x00ED},
+    {"Icirc"_name, 0x00CE},
+    {"icirc"_name, 0x00EE},
+    {"iexcl"_name, 0x00A1},
+    {"Igrave"_name, 0x00CC},
+    {"igrave"_name, 0x00EC},
+    {"image"_name, 0x2111},
+    {"infin"_name, 0x221E},
+    {"int"_name, 0x222B},
+    {"Iota"_name, 0x0399},
+    {"iota"_name, 0x03B9},
+    {"iquest"_name, 0x00BF},
+    {"isin"_name, 0x2208},
+    {"Iuml"_name, 0x00CF},
+    {"iuml"_name, 0x00EF},
+    {"Kappa"_name, 0x039A},
+    {"kappa"_name, 0x03BA},
+    {"Lambda"_name, 0x039B},
+    {"lambda"_name, 0x03BB},
+    {"lang"_name, 0x2329},
+    {"laquo"_name, 0x00AB},
+    {"larr"_name, 0x2190},
+    {"lArr"_name, 0x21D0},
+    {"lceil"_name, 0x2308},
+    {"ldquo"_name, 0x201C},
+    {"le"_name, 0x2264},
+    {"lf"_name, 0x000A},
+    {"lfloor"_name, 0x230A},
+    {"lowast"_name, 0x2217},
+    {"loz"_name, 0x25CA},
+    {"lrm"_name, 0x200E},
+    {"lsaquo"_name, 0x2039},
+    {"lsquo"_name, 0x2018},
+    {"lt"_name, 0x003C},
+    {"macr"_name, 0x00AF},
+    {"mdash"_name, 0x2014},
+    {"micro"_name, 0x00B5},
+    {"middot"_name, 0x00B7},
+    {"minus"_name, 0x2212},
+    {"Mu"_name, 0x039C},
+    {"mu"_name, 0x03BC},
+    {"nabla"_name, 0x2207},
+    {"nbsp"_name, 0x00A0},
+    {"ndash"_name, 0x2013},
+    {"ne"_name, 0x2260},
+    {"ni"_name, 0x220B},
+    {"not"_name, 0x00AC},
+    {"notin"_name, 0x2209},
+    {"nsub"_name, 0x2284},
+    {"Ntilde"_name, 0x00D1},
+    {"ntilde"_name, 0x00F1},
+    {"Nu"_name, 0x039D},
+    {"nu"_name, 0x03BD},
+    {"Oacute"_name, 0x00D3},
+    {"oacute"_name, 0x00F3},
+    {"Ocirc"_name, 0x00D4},
+    {"ocirc"_name, 0x00F4},
+    {"OElig"_name, 0x0152},
+    {"oelig"_name, 0x0153},
+    {"Ograve"_name, 0x00D2},
+    {"ograve"_name, 0x00F2},
+    {"oline"_name, 0x203E},
+    {"Omega"_name, 0x03A9},
+    {"omega"_name, 0x03C9},
+    {"Omicron"_name, 0x039F},
+    {"omicron"_name, 0x03BF},
+    {"oplus"_name, 0x2295},
+    {"or"_name, 0x2228},
+    {"ordf"_name, 0x00AA},
+    {"ordm"_name, 0x00BA},
+    {"Oslash"_name, 0x00D8},
+    {"oslash"_name, 0x00F8},
+    {"Otilde"_name, 0x00D5},
+    {"otilde"_name, 0x00F5},
+    {"otimes"_name, 0x2297},
+    {"Ouml"_name, 0x00D6},
+    {"ouml"_name, 0x00F6},
+    {"para"_name, 0x00B6},
+    {"part"_name, 0x2202},
+    {"permil"_name, 0x2030},
+    {"perp"_name, 0x22A5},
+    {"Phi"_name, 0x03A6},
+    {"phi"_name, 0x03C6},
+    {"Pi"_name, 0x03A0},
+    {"pi"_name, 0x03C0},
+    {"piv"_name, 0x03D6},
+    {"plusmn"_name, 0x00B1},
+    {"pound"_name, 0x00A3},
+    {"prime"_name, 0x2032},
+    {"Prime"_name, 0x2033},
+    {"prod"_name, 0x220F},
+    {"prop"_name, 0x221D},
+    {"Psi"_name, 0x03A8},
+    {"psi"_name, 0x03C8},
+    {"quot"_name, 0x0022},
+    {"radic"_name, 0x221A},
+    {"rang"_name, 0x232A},
+    {"raquo"_name, 0x00BB},
+    {"rarr"_name, 0x2192},
+    {"rArr"_name, 0x21D2},
+    {"rceil"_name, 0x2309},
+    {"rdquo"_name, 0x201D},
+    {"real"_name, 0x211C},
+    {"reg"_name, 0x00AE},
+    {"rfloor"_name, 0x230B},
+    {"Rho"_name, 0x03A1},
+    {"rho"_name, 0x03C1},
+    {"rlm"_name, 0x200F},
+    {"rsaquo"_name, 0x203A},
+    {"rsquo"_name, 0x2019},
+    {"sbquo"_name, 0x201A},
+    {"Scaron"_name, 0x0160},
+    {"scaron"_name, 0x0161},
+    {"sdot"_name, 0x22C5},
+    {"sect"_name, 0x00A7},
+    {"shy"_name, 0x00AD},
+    {"Sigma"_name, 0x03A3},
+    {"sigma"_name, 0x03C3},
+    {"sigmaf"_name, 0x03C2},
+    {"sim"_name, 0x223C},
+    {"spades"_name, 0x2660},
+    {"sub"_name, 0x2282},
+    {"sube"_name, 0x2286},
+    {"sum"_name, 0x2211},
+    {"sup"_name, 0x2283},
+    {"sup1"_name, 0x00B9},
+    {"sup2"_name, 0x00B2},
+    {"sup3"_name, 0x00B3},
+    {"supe"_name, 0x2287},
+    {"szlig"_name, 0x00DF},
+    {"tab"_name, 0x0009},
+    {"Tau"_name, 0x03A4},
+    {"tau"_name, 0x03C4},
+    {"there4"_name, 0x2234},
+    {"Theta"_name, 0x0398},
+    {"theta"_name, 0x03B8},
+    {"thetasym"_name, 0x03D1},
+    {"thinsp"_name, 0x2009},
+    {"THORN"_name, 0x00DE},
+    {"thorn"_name, 0x00FE},
+    {"tilde"_name, 0x02DC},
+    {"times"_name, 0x00D7},
+    {"trade"_name, 0x2122},
+    {"Uacute"_name, 0x00DA},
+    {"uacute"_name, 0x00FA},
+    {"uarr"_name, 0x2191},
+    {"uArr"_name, 0x21D1},
+    {"Ucirc"_name, 0x00DB},
+    {"ucirc"_name, 0x00FB},
+    {"Ugrave"_name, 0x00D9},
+    {"ugrave"_name, 0x00F9},
+    {"uml"_name, 0x00A8},
+    {"upsih"_name, 0x03D2},
+    {"Upsilon"_name, 0x03A5},
+    {"upsilon"_name, 0x03C5},
+    {"Uuml"_name, 0x00DC},
+    {"uuml"_name, 0x00FC},
+    {"weierp"_name, 0x2118},
+    {"Xi"_name, 0x039E},
+    {"xi"_name, 0x03BE},
+    {"Yacute"_name, 0x00DD},
+    {"yacute"_name, 0x00FD},
+    {"yen"_name, 0x00A5},
+    {"yuml"_name, 0x00FF},
+    {"Yuml"_name, 0x0178},
+    {"Zeta"_name, 0x0396},
+    {"zeta"_name, 0x03B6},
+    {"zwj"_name, 0x200D},
+    {"zwnj"_name, 0x200C},
+    // NOTE (fbrereto) : These are not a part of the HTML default entity list, but are still
+    // useful
+    {"apos"_name, 0x0027},
+};
+
+constexpr std::size_t entity_count_k = std::size(entity_set_k);
 
 /**************************************************************************************************/
 
-#define ADOBE_CODE_POINT(x) std::uint32_t(x##UL)
+constexpr auto entity_name_table_k = adobe::make_static_hash_table<std::uint32_t>(entity_set_k);
 
 /**************************************************************************************************/
 
-typedef pair<string, std::uint32_t> code_point_set_value_type;
-typedef vector<code_point_set_value_type> code_point_set_t;
+struct code_point_entry_t {
+    std::uint32_t code_point_m;
+    std::uint16_t index_m;
+};
+
+// The entity set ordered by code point, for the reverse lookup.
+constexpr auto code_point_index_k = [] {
+    array<code_point_entry_t, entity_count_k> result{};
+
+    for (std::size_t i = 0; i != entity_count_k; ++i)
+        result[i] = {entity_set_k[i].second, static_cast<std::uint16_t>(i)};
+
+    // An insertion sort, std::sort is not constexpr before C++20.
+    for (std::size_t i = 1; i != entity_count_k; ++i) {
+        for (std::size_t j = i; j != 0 && result[j].code_point_m < result[j - 1].code_point_m;
+             --j) {
+            const code_point_entry_t x(result[j]);
+            result[j] = result[j - 1];
+            result[j - 1] = x;
+        }
+    }
 
-/**************************************************************************************************/
+    return result;
+}();
 
-const code_point_set_t& code_point_set() {
-    typedef code_point_set_value_type value_type;
-
-    static code_point_set_t code_point_set_s;
-    static bool inited(false);
-
-    if (!inited) {
-        inited = true;
-
-        value_type default_entry_set[] = {
-            value_type("Aacute", ADOBE_CODE_POINT(0x00C1)),
-            value_type("aacute", ADOBE_CODE_POINT(0x00E1)),
-            value_type("Acirc", ADOBE_CODE_POINT(0x00C2)),
-            value_type("acirc", ADOBE_CODE_POINT(0x00E2)),
-            value_type("acute", ADOBE_CODE_POINT(0x00B4)),
-            value_type("AElig", ADOBE_CODE_POINT(0x00C6)),
-            value_type("aelig", ADOBE_CODE_POINT(0x00E6)),
-            value_type("Agrave", ADOBE_CODE_POINT(0x00C0)),
-            value_type("agrave", ADOBE_CODE_POINT(0x00E0)),
-            value_type("alefsym", ADOBE_CODE_POINT(0x2135)),
-            value_type("Alpha", ADOBE_CODE_POINT(0x0391)),
-            value_type("alpha", ADOBE_CODE_POINT(0x03B1)),
-            value_type("amp", ADOBE_CODE_POINT(0x0026)),
-            value_type("and", ADOBE_CODE_POINT(0x2227)),
-            value_type("ang", ADOBE_CODE_POINT(0x2220)),
-            value_type("Aring", ADOBE_CODE_POINT(0x00C5)),
-            value_type("aring", ADOBE_CODE_POINT(0x00E5)),
-            value_type("asymp", ADOBE_CODE_POINT(0x2248)),
-            value_type("Atilde", ADOBE_CODE_POINT(0x00C3)),
-            value_type("atilde", ADOBE_CODE_POINT(0x00E3)),
-            value_type("Auml", ADOBE_CODE_POINT(0x00C4)),
-            value_type("auml", ADOBE_CODE_POINT(0x00E4)),
-            value_type("bdquo", ADOBE_CODE_POINT(0x201E)),
-            value_type("Beta", ADOBE_CODE_POINT(0x0392)),
-            value_type("beta", ADOBE_CODE_POINT(0x03B2)),
-            value_type("brvbar", ADOBE_CODE_POINT(0x00A6)),
-            value_type("bull", ADOBE_CODE_POINT(0x2022)),
-            value_type("cap", ADOBE_CODE_POINT(0x2229)),
-            value_type("Ccedil", ADOBE_CODE_POINT(0x00C7)),
-            value_type("ccedil", ADOBE_CODE_POINT(0x00E7)),
-            value_type("cedil", ADOBE_CODE_POINT(0x00B8)),
-            value_type("cent", ADOBE_CODE_POINT(0x00A2)),
-            value_type("Chi", ADOBE_CODE_POINT(0x03A7)),
-            value_type("chi", ADOBE_CODE_POINT(0x03C7)),
-            value_type("circ", ADOBE_CODE_POINT(0x02C6)),
-            value_type("clubs", ADOBE_CODE_POINT(0x2663)),
-            value_type("cong", ADOBE_CODE_POINT(0x2245)),
-            value_type("copy", ADOBE_CODE_POINT(0x00A9)),
-            value_type("cr", ADOBE_CODE_POINT(0x000D)),
-            value_type("crarr", ADOBE_CODE_POINT(0x21B5)),
-            value_type("cup", ADOBE_CODE_POINT(0x222A)),
-            value_type("curren", ADOBE_CODE_POINT(0x00A4)),
-            value_type("dagger", ADOBE_CODE_POINT(0x2020)),
-            value_type("Dagger", ADOBE_CODE_POINT(0x2021)),
-            value_type("darr", ADOBE_CODE_POINT(0x2193)),
-            value_type("dArr", ADOBE_CODE_POINT(0x21D3)),
-            value_type("deg", ADOBE_CODE_POINT(0x00B0)),
-            value_type("Delta", ADOBE_CODE_POINT(0x0394)),
-            value_type("delta", ADOBE_CODE_POINT(0x03B4)),
-            value_type("diams", ADOBE_CODE_POINT(0x2666)),
-            value_type("divide", ADOBE_CODE_POINT(0x00F7)),
-            value_type("Eacute", ADOBE_CODE_POINT(0x00C9)),
-            value_type("eacute", ADOBE_CODE_POINT(0x00E9)),
-            value_type("Ecirc", ADOBE_CODE_POINT(0x00CA)),
-            value_type("ecirc", ADOBE_CODE_POINT(0x00EA)),
-            value_type("Egrave", ADOBE_CODE_POINT(0x00C8)),
-            value_type("egrave", ADOBE_CODE_POINT(0x00E8)),
-            value_type("empty", ADOBE_CODE_POINT(0x2205)),
-            value_type("emsp", ADOBE_CODE_POINT(0x2003)),
-            value_type("ensp", ADOBE_CODE_POINT(0x2002)),
-            value_type("Epsilon", ADOBE_CODE_POINT(0x0395)),
-            value_type("epsilon", ADOBE_CODE_POINT(0x03B5)),
-            value_type("equiv", ADOBE_CODE_POINT(0x2261)),
-            value_type("Eta", ADOBE_CODE_POINT(0x0397)),
-            value_type("eta", ADOBE_CODE_POINT(0x03B7)),
-            value_type("ETH", ADOBE_CODE_POINT(0x00D0)),
-            value_type("eth", ADOBE_CODE_POINT(0x00F0)),
-            value_type("Euml", ADOBE_CODE_POINT(0x00CB)),
-            value_type("euml", ADOBE_CODE_POINT(0x00EB)),
-            value_type("euro", ADOBE_CODE_POINT(0x20AC)),
-            value_type("exist", ADOBE_CODE_POINT(0x2203)),
-            value_type("fnof", ADOBE_CODE_POINT(0x0192)),
-            value_type("forall", ADOBE_CODE_POINT(0x2200)),
-            value_type("frac12", ADOBE_CODE_POINT(0x00BD)),
-            value_type("frac14", ADOBE_CODE_POINT(0x00BC)),
-            value_type("frac34", ADOBE_CODE_POINT(0x00BE)),
-            value_type("frasl", ADOBE_CODE_POINT(0x2044)),
-            value_type("Gamma", ADOBE_CODE_POINT(0x0393)),
-            value_type("gamma", ADOBE_CODE_POINT(0x03B3)),
-            value_type("ge", ADOBE_CODE_POINT(0x2265)),
-            value_type("gt", ADOBE_CODE_POINT(0x003E)),
-            value_type("harr", ADOBE_CODE_POINT(0x2194)),
-            value_type("hArr", ADOBE_CODE_POINT(0x21D4)),
-            value_type("hearts", ADOBE_CODE_POINT(0x2665)),
-            value_type("hellip", ADOBE_CODE_POINT(0x2026)),
-            value_type("Iacute", ADOBE_CODE_POINT(0x00CD)),
-            value_type("iacute", ADOBE_CODE_POINT(0x00ED)),
-            value_type("Icirc", ADOBE_CODE_POINT(0x00CE)),
-            value_type("icirc", ADOBE_CODE_POINT(0x00EE)),
-            value_type("iexcl", ADOBE_CODE_POINT(0x00A1)),
-            value_type("Igrave", ADOBE_CODE_POINT(0x00CC)),
-            value_type("igrave", ADOBE_CODE_POINT(0x00EC)),
-            value_type("image", ADOBE_CODE_POINT(0x2111)),
-            value_type("infin", ADOBE_CODE_POINT(0x221E)),
-            value_type("int", ADOBE_CODE_POINT(0x222B)),
-            value_type("Iota", ADOBE_CODE_POINT(0x0399)),
-            value_type("iota", ADOBE_CODE_POINT(0x03B9)),
-            value_type("iquest", ADOBE_CODE_POINT(0x00BF)),
-            value_type("isin", ADOBE_CODE_POINT(0x2208)),
-            value_type("Iuml", ADOBE_CODE_POINT(0x00CF)),
-            value_type("iuml", ADOBE_CODE_POINT(0x00EF)),
-            value_type("Kappa", ADOBE_CODE_POINT(0x039A)),
-            value_type("kappa", ADOBE_CODE_POINT(0x03BA)),
-            value_type("Lambda", ADOBE_CODE_POINT(0x039B)),
-            value_type("lambda", ADOBE_CODE_POINT(0x03BB)),
-            value_type("lang", ADOBE_CODE_POINT(0x2329)),
-            value_type("laquo", ADOBE_CODE_POINT(0x00AB)),
-            value_type("larr", ADOBE_CODE_POINT(0x2190)),
-            value_type("lArr", ADOBE_CODE_POINT(0x21D0)),
-            value_type("lceil", ADOBE_CODE_POINT(0x2308)),
-            value_type("ldquo", ADOBE_CODE_POINT(0x201C)),
-            value_type("le", ADOBE_CODE_POINT(0x2264)),
-            value_type("lf", ADOBE_CODE_POINT(0x000A)),
-            value_type("lfloor", ADOBE_CODE_POINT(0x230A)),
-            value_type("lowast", ADOBE_CODE_POINT(0x2217)),
-            value_type("loz", ADOBE_CODE_POINT(0x25CA)),
-            value_type("lrm", ADOBE_CODE_POINT(0x200E)),
-            value_type("lsaquo", ADOBE_CODE_POINT(0x2039)),
-            value_type("lsquo", ADOBE_CODE_POINT(0x2018)),
-            value_type("lt", ADOBE_CODE_POINT(0x003C)),
-            value_type("macr", ADOBE_CODE_POINT(0x00AF)),
-            value_type("mdash", ADOBE_CODE_POINT(0x2014)),
-            value_type("micro", ADOBE_CODE_POINT(0x00B5)),
-            value_type("middot", ADOBE_CODE_POINT(0x00B7)),
-            value_type("minus", ADOBE_CODE_POINT(0x2212)),
-            value_type("Mu", ADOBE_CODE_POINT(0x039C)),
-            value_type("mu", ADOBE_CODE_POINT(0x03BC)),
-            value_type("nabla", ADOBE_CODE_POINT(0x2207)),
-            value_type("nbsp", ADOBE_CODE_POINT(0x00A0)),
-            value_type("ndash", ADOBE_CODE_POINT(0x2013)),
-            value_type("ne", ADOBE_CODE_POINT(0x2260)),
-            value_type("ni", ADOBE_CODE_POINT(0x220B)),
-            value_type("not", ADOBE_CODE_POINT(0x00AC)),
-            value_type("notin", ADOBE_CODE_POINT(0x2209)),
-            value_type("nsub", ADOBE_CODE_POINT(0x2284)),
-            value_type("Ntilde", ADOBE_CODE_POINT(0x00D1)),
-            value_type("ntilde", ADOBE_CODE_POINT(0x00F1)),
-            value_type("Nu", ADOBE_CODE_POINT(0x039D)),
-            value_type("nu", ADOBE_CODE_POINT(0x03BD)),
-            value_type("Oacute", ADOBE_CODE_POINT(0x00D3)),
-            value_type("oacute", ADOBE_CODE_POINT(0x00F3)),
-            value_type("Ocirc", ADOBE_CODE_POINT(0x00D4)),
-            value_type("ocirc", ADOBE_CODE_POINT(0x00F4)),
-            value_type("OElig", ADOBE_CODE_POINT(0x0152)),
-            value_type("oelig", ADOBE_CODE_POINT(0x0153)),
-            value_type("Ograve", ADOBE_CODE_POINT(0x00D2)),
-            value_type("ograve", ADOBE_CODE_POINT(0x00F2)),
-            value_type("oline", ADOBE_CODE_POINT(0x203E)),
-            value_type("Omega", ADOBE_CODE_POINT(0x03A9)),
-            value_type("omega", ADOBE_CODE_POINT(0x03C9)),
-            value_type("Omicron", ADOBE_CODE_POINT(0x039F)),
-            value_type("omicron", ADOBE_CODE_POINT(0x03BF)),
-            value_type("oplus", ADOBE_CODE_POINT(0x2295)),
-            value_type("or", ADOBE_CODE_POINT(0x2228)),
-            value_type("ordf", ADOBE_CODE_POINT(0x00AA)),
-            value_type("ordm", ADOBE_CODE_POINT(0x00BA)),
-            value_type("Oslash", ADOBE_CODE_POINT(0x00D8)),
-            value_type("oslash", ADOBE_CODE_POINT(0x00F8)),
-            value_type("Otilde", ADOBE_CODE_POINT(0x00D5)),
-            value_type("otilde", ADOBE_CODE_POINT(0x00F5)),
-            value_type("otimes", ADOBE_CODE_POINT(0x2297)),
-            value_type("Ouml", ADOBE_CODE_POINT(0x00D6)),
-            value_type("ouml", ADOBE_CODE_POINT(0x00F6)),
-            value_type("para", ADOBE_CODE_POINT(0x00B6)),
-            value_type("part", ADOBE_CODE_POINT(0x2202)),
-            value_type("permil", ADOBE_CODE_POINT(0x2030)),
-            value_type("perp", ADOBE_CODE_POINT(0x22A5)),
-            value_type("Phi", ADOBE_CODE_POINT(0x03A6)),
-            value_type("phi", ADOBE_CODE_POINT(0x03C6)),
-            value_type("Pi", ADOBE_CODE_POINT(0x03A0)),
-            value_type("pi", ADOBE_CODE_POINT(0x03C0)),
-            value_type("piv", ADOBE_CODE_POINT(0x03D6)),
-            value_type("plusmn", ADOBE_CODE_POINT(0x00B1)),
-            value_type("pound", ADOBE_CODE_POINT(0x00A3)),
-            value_type("prime", ADOBE_CODE_POINT(0x2032)),
-            value_type("Prime", ADOBE_CODE_POINT(0x2033)),
-            value_type("prod", ADOBE_CODE_POINT(0x220F)),
-            value_type("prop", ADOBE_CODE_POINT(0x221D)),
-            value_type("Psi", ADOBE_CODE_POINT(0x03A8)),
-            value_type("psi", ADOBE_CODE_POINT(0x03C8)),
-            value_type("quot", ADOBE_CODE_POINT(0x0022)),
-            value_type("radic", ADOBE_CODE_POINT(0x221A)),
-            value_type("rang", ADOBE_CODE_POINT(0x232A)),
-            value_type("raquo", ADOBE_CODE_POINT(0x00BB)),
-            value_type("rarr", ADOBE_CODE_POINT(0x2192)),
-            value_type("rArr", ADOBE_CODE_POINT(0x21D2)),
-            value_type("rceil", ADOBE_CODE_POINT(0x2309)),
-            value_type("rdquo", ADOBE_CODE_POINT(0x201D)),
-            value_type("real", ADOBE_CODE_POINT(0x211C)),
-            value_type("reg", ADOBE_CODE_POINT(0x00AE)),
-            value_type("rfloor", ADOBE_CODE_POINT(0x230B)),
-            value_type("Rho", ADOBE_CODE_POINT(0x03A1)),
-            value_type("rho", ADOBE_CODE_POINT(0x03C1)),
-            value_type("rlm", ADOBE_CODE_POINT(0x200F)),
-            value_type("rsaquo", ADOBE_CODE_POINT(0x203A)),
-            value_type("rsquo", ADOBE_CODE_POINT(0x2019)),
-            value_type("sbquo", ADOBE_CODE_POINT(0x201A)),
-            value_type("Scaron", ADOBE_CODE_POINT(0x0160)),
-            value_type("scaron", ADOBE_CODE_POINT(0x0161)),
-            value_type("sdot", ADOBE_CODE_POINT(0x22C5)),
-            value_type("sect", ADOBE_CODE_POINT(0x00A7)),
-            value_type("shy", ADOBE_CODE_POINT(0x00AD)),
-            value_type("Sigma", ADOBE_CODE_POINT(0x03A3)),
-            value_type("sigma", ADOBE_CODE_POINT(0x03C3)),
-            value_type("sigmaf", ADOBE_CODE_POINT(0x03C2)),
-            value_type("sim", ADOBE_CODE_POINT(0x223C)),
-            value_type("spades", ADOBE_CODE_POINT(0x2660)),
-            value_type("sub", ADOBE_CODE_POINT(0x2282)),
-            value_type("sube", ADOBE_CODE_POINT(0x2286)),
-            value_type("sum", ADOBE_CODE_POINT(0x2211)),
-            value_type("sup", ADOBE_CODE_POINT(0x2283)),
-            value_type("sup1", ADOBE_CODE_POINT(0x00B9)),
-            value_type("sup2", ADOBE_CODE_POINT(0x00B2)),
-            value_type("sup3", ADOBE_CODE_POINT(0x00B3)),
-            value_type("supe", ADOBE_CODE_POINT(0x2287)),
-            value_type("szlig", ADOBE_CODE_POINT(0x00DF)),
-            value_type("tab", ADOBE_CODE_POINT(0x0009)),
-            value_type("Tau", ADOBE_CODE_POINT(0x03A4)),
-            value_type("tau", ADOBE_CODE_POINT(0x03C4)),
-            value_type("there4", ADOBE_CODE_POINT(0x2234)),
-            value_type("Theta", ADOBE_CODE_POINT(0x0398)),
-            value_type("theta", ADOBE_CODE_POINT(0x03B8)),
-            value_type("thetasym", ADOBE_CODE_POINT(0x03D1)),
-            value_type("thinsp", ADOBE_CODE_POINT(0x2009)),
-            value_type("THORN", ADOBE_CODE_POINT(0x00DE)),
-            value_type("thorn", ADOBE_CODE_POINT(0x00FE)),
-            value_type("tilde", ADOBE_CODE_POINT(0x02DC)),
-            value_type("times", ADOBE_CODE_POINT(0x00D7)),
-            value_type("trade", ADOBE_CODE_POINT(0x2122)),
-            value_type("Uacute", ADOBE_CODE_POINT(0x00DA)),
-            value_type("uacute", ADOBE_CODE_POINT(0x00FA)),
-            value_type("uarr", ADOBE_CODE_POINT(0x2191)),
-            value_type("uArr", ADOBE_CODE_POINT(0x21D1)),
-            value_type("Ucirc", ADOBE_CODE_POINT(0x00DB)),
-            value_type("ucirc", ADOBE_CODE_POINT(0x00FB)),
-            value_type("Ugrave", ADOBE_CODE_POINT(0x00D9)),
-            value_type("ugrave", ADOBE_CODE_POINT(0x00F9)),
-            value_type("uml", ADOBE_CODE_POINT(0x00A8)),
-            value_type("upsih", ADOBE_CODE_POINT(0x03D2)),
-            value_type("Upsilon", ADOBE_CODE_POINT(0x03A5)),
-            value_type("upsilon", ADOBE_CODE_POINT(0x03C5)),
-            value_type("Uuml", ADOBE_CODE_POINT(0x00DC)),
-            value_type("uuml", ADOBE_CODE_POINT(0x00FC)),
-            value_type("weierp", ADOBE_CODE_POINT(0x2118)),
-            value_type("Xi", ADOBE_CODE_POINT(0x039E)),
-            value_type("xi", ADOBE_CODE_POINT(0x03BE)),
-            value_type("Yacute", ADOBE_CODE_POINT(0x00DD)),
-            value_type("yacute", ADOBE_CODE_POINT(0x00FD)),
-            value_type("yen", ADOBE_CODE_POINT(0x00A5)),
-            value_type("yuml", ADOBE_CODE_POINT(0x00FF)),
-            value_type("Yuml", ADOBE_CODE_POINT(0x0178)),
-            value_type("Zeta", ADOBE_CODE_POINT(0x0396)),
-            value_type("zeta", ADOBE_CODE_POINT(0x03B6)),
-            value_type("zwj", ADOBE_CODE_POINT(0x200D)),
-            value_type("zwnj", ADOBE_CODE_POINT(0x200C))
-#if 1
-            // NOTE (fbrereto) : These are not a part of the HTML default entity list, but are still
-            // useful
-            ,
-            value_type("apos", ADOBE_CODE_POINT(0x0027))
-#endif
-        };
+const code_point_entry_t* code_point_index_find(std::uint32_t code_point) {
+    auto found(lower_bound(code_point_index_k.begin(), code_point_index_k.end(), code_point,
+                           [](const auto& x, std::uint32_t y) { return x.code_point_m < y; }));
 
-        std::size_t entry_set_size(sizeof(default_entry_set) / sizeof(default_entry_set[0]));
+    return found == code_point_index_k.end() || found->code_point_m != code_point ? nullptr
+                                                                                 : &*found;
+}
 
-        code_point_set_s.reserve(entry_set_size);
+const string& entity_name(std::size_t index) {
+    static const auto names_s = [] {
+        array<string, entity_count_k> result;
 
-        adobe::copy(default_entry_set, std::back_inserter(code_point_set_s));
+        for (std::size_t i = 0; i != entity_count_k; ++i)
+            result[i] = entity_set_k[i].first.c_str();
 
-        assert(code_point_set_s.size() == entry_set_size);
-    }
+        return result;
+    }();
 
-    return code_point_set_s;
+    return names_s[index];
 }
 
 /**************************************************************************************************/
 
-#undef ADOBE_CODE_POINT
-
-/**************************************************************************************************/
-
-typedef adobe::table_index<const std::uint32_t, const code_point_set_t::value_type>
-    code_point_index_type;
+/*
+    The escaped form of each byte, empty for bytes that are copied unchanged. A byte taken as a
+    Latin-1 code point with an entity is replaced by the entity; other control characters and
+    bytes with the high bit set are replaced by a hexadecimal character reference.
+*/
 
-/**************************************************************************************************/
+struct escape_t {
+    char text_m[8];
+    std::uint8_t size_m;
+};
 
-const code_point_index_type& code_point_index() {
-    static const code_point_index_type index(code_point_set().begin(), code_point_set().end(),
-                                             &code_point_set_t::value_type::second);
-    static bool inited(false);
+constexpr auto escape_table_k = [] {
+    array<escape_t, 256> result{};
 
-    if (!inited) {
-        inited = true;
+    for (const auto& e : entity_set_k) {
+        if (e.second > 0xFF)
+            continue;
 
-        const_cast<code_point_index_type&>(index).sort();
-        // const_cast<code_point_index_type&>(index).unique();
+        escape_t& escape(result[e.second]);
+        const char* name(e.first.c_str());
 
-        assert(index.size() == code_point_set().size());
+        escape.text_m[escape.size_m++] = '&';
+        while (*name)
+            escape.text_m[escape.size_m++] = *name++;
+        escape.text_m[escape.size_m++] = ';';
     }
 
-    return index;
-}
+    for (std::size_t c = 0; c != 256; ++c) {
+        escape_t& escape(result[c]);
 
-/**************************************************************************************************/
+        if (escape.size_m || (0x20 <= c && c < 0x7F))
+            continue;
 
-code_point_index_type::const_iterator code_point_index_find(std::uint32_t code_point) {
-    const code_point_index_type& index(code_point_index());
-    code_point_index_type::const_iterator found(adobe::lower_bound(
-        index, code_point, adobe::compare_members(&code_point_set_t::value_type::second)));
+        const char* digits("0123456789ABCDEF");
 
-    return found == index.end() || found->second != code_point ? index.end() : found;
-}
-
-/**************************************************************************************************/
+        for (char x : {'&', '#', 'x', digits[c >> 4], digits[c & 0x0F], ';'})
+            escape.text_m[escape.size_m++] = x;
+    }
 
-typedef adobe::table_index<const string, const code_point_set_t::value_type> entity_name_index_type;
+    return result;
+}();
 
 /**************************************************************************************************/
 
-const entity_name_index_type& entity_name_index() {
-    static const entity_name_index_type index(code_point_set().begin(), code_point_set().end(),
-                                              &code_point_set_t::value_type::first);
-    static bool inited(false);
+constexpr bool is_escape_delimiter(std::size_t c) {
+    return c < 0x20 || 0x7F <= c || c == '"' || c == '&' || c == '\'' || c == '<' || c == '>';
+}
 
-    if (!inited) {
-        inited = true;
+constexpr bool escape_table_matches_delimiters() {
+    for (std::size_t c = 0; c != 256; ++c) {
+        if ((escape_table_k[c].size_m != 0) != is_escape_delimiter(c))
+            return false;
+    }
+    return true;
+}
 
-        const_cast<entity_name_index_type&>(index).sort();
-        // const_cast<entity_name_index_type&>(index).unique();
+static_assert(escape_table_matches_delimiters(),
+              "find_escape() must stop at exactly the bytes with an escaped form");
 
-        assert(index.size() == code_point_set().size());
+/*
+    Returns the first byte in [first, last) that is escaped, or last.
+*/
+const char* find_escape(const char* first, const char* last) {
+#if ADOBE_BYTE_SCAN_SSE2
+    for (; last - first >= 16; first += 16) {
+        const __m128i block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+
+        // As signed bytes, control characters and bytes with the high bit set are below ' '.
+        const __m128i escaped(
+            _mm_or_si128(_mm_cmplt_epi8(block, _mm_set1_epi8(' ')),
+                         adobe::implementation::byte_scan_match<'"', '&', '\'', '<', '>', '\x7F'>(
+                             block)));
+
+        if (const int mask = _mm_movemask_epi8(escaped))
+            return first + adobe::implementation::countr_zero(static_cast<unsigned>(mask));
     }
+#endif
+
+    while (first != last && !escape_table_k[static_cast<unsigned char>(*first)].size_m)
+        ++first;
 
-    return index;
+    return first;
 }
 
 /**************************************************************************************************/
 
-entity_name_index_type::const_iterator entity_name_index_find(const string& entity_name) {
-    const entity_name_index_type& index(entity_name_index());
-    entity_name_index_type::const_iterator found(adobe::lower_bound(
-        index, entity_name, adobe::compare_members(&code_point_set_t::value_type::first)));
+/*
+    Returns the code point of the entity or character reference named by entity, which does not
+    include the leading '&' or the trailing ';'.
+*/
+std::uint32_t entity_code_point(string_view entity) {
+    if (entity.size() > 1 && entity[0] == '#') {
+        std::uint32_t result;
 
-    return found == index.end() || found->first != entity_name ? index.end() : found;
-}
+        if (entity[1] == 'x')
+            xatoi(entity.begin() + 2, entity.end(), result);
+        else
+            datoi(entity.begin() + 1, entity.end(), result);
 
-/**************************************************************************************************/
+        return result;
+    }
 
-inline bool needs_escape(unsigned char c) { return !std::isprint(c) || (c & 0x80); }
+    const std::uint32_t* found(entity_name_table_k.find(entity));
+
+    if (!found)
+        throw std::range_error("entity name not found");
+
+    return *found;
+}
 
 /**************************************************************************************************/
 
@@ -483,58 +531,24 @@ namespace adobe {
 /**************************************************************************************************/
 
 const string& entity_map_find(std::uint32_t code_point) {
-    code_point_index_type::const_iterator found(code_point_index_find(code_point));
+    const code_point_entry_t* found(code_point_index_find(code_point));
 
-    if (found == code_point_index().end())
+    if (!found)
         throw std::range_error("code point not found");
 
-    return found->first;
+    return entity_name(found->index_m);
 }
 
 /**************************************************************************************************/
 
-std::uint32_t entity_map_find(const string& entity) {
-    string::const_iterator first(entity.begin());
-
-    if (entity.size() > 1 && *first == '#') {
-        string::const_iterator last(entity.end());
-        std::uint32_t result;
-
-        ++first;
-
-        if (*first == 'x')
-            xatoi(++first, last, result);
-        else
-            datoi(first, last, result);
-
-        return result;
-    }
-
-    entity_name_index_type::const_iterator found(entity_name_index_find(entity));
-
-    if (found == entity_name_index().end())
-        throw std::range_error("entity name not found");
-
-    return found->second;
-}
+std::uint32_t entity_map_find(const string& entity) { return entity_code_point(entity); }
 
 /**************************************************************************************************/
 
 bool needs_entity_escape(const string& value) {
-    for (string::const_iterator iter(value.begin()); iter != value.end(); ++iter) {
-        unsigned char c(*iter);
-
-        if (needs_escape(c))
-            return true;
+    const char* last(value.data() + value.size());
 
-        code_point_index_type::const_iterator found(
-            code_point_index_find(static_cast<std::uint32_t>(c)));
-
-        if (found != code_point_index().end())
-            return true;
-    }
-
-    return false;
+    return find_escape(value.data(), last) != last;
 }
 
 /**************************************************************************************************/
@@ -544,32 +558,23 @@ string entity_escape(const string& value) {
 
     result.reserve(value.size());
 
-    for (string::const_iterator iter(value.begin()); iter != value.end(); ++iter) {
-        unsigned char c(*iter);
+    const char* first(value.data());
+    const char* const last(first + value.size());
 
-        code_point_index_type::const_iterator found(
-            code_point_index_find(static_cast<std::uint32_t>(c)));
+    while (true) {
+        const char* next(find_escape(first, last));
 
-        if (found != code_point_index().end()) {
-            result.push_back('&');
-            result.append(found->first);
-            result.push_back(';');
-        } else if (needs_escape(c)) {
-            char nybble1((c >> 4) & 0x0f);
-            char nybble2(c & 0x0f);
+        result.append(first, next - first);
 
-            result.append(string("&#x"));
+        if (next == last)
+            return result;
 
-            result.push_back(nybble1 >= 0x0a ? 'A' + (nybble1 - 0x0a) : '0' + nybble1);
+        const escape_t& escape(escape_table_k[static_cast<unsigned char>(*next)]);
 
-            result.push_back(nybble2 >= 0x0a ? 'A' + (nybble2 - 0x0a) : '0' + nybble2);
+        result.append(escape.text_m, escape.size_m);
 
-            result.push_back(';');
-        } else
-            result.push_back(c);
+        first = next + 1;
     }
-
-    return result;
 }
 
 /**************************************************************************************************/
@@ -580,46 +585,46 @@ bool needs_entity_unescape(const string& value) {
         followed by a semicolon, which will return true in this case but the
         string does not need unescaping.
     */
-    string::const_iterator first(find(value, '&'));
-    string::const_iterator next(std::find(first, value.end(), ';'));
+    const char* last(value.data() + value.size());
+    const char* first(implementation::find_first_of_bytes<'&'>(value.data(), last));
 
-    return next != value.end();
+    return first != last && memchr(first, ';', last - first);
 }
 
 /**************************************************************************************************/
 
 string entity_unescape(const string& value) {
     string result;
-    string::const_iterator iter(value.begin());
 
     result.reserve(value.size());
 
-    while (iter != value.end()) {
-        string::const_iterator next(copy_until(iter, value.end(), std::back_inserter(result),
-                                               std::bind(std::not_equal_to<char>(), _1, '&'))
-                                        .first);
+    const char* first(value.data());
+    const char* const last(first + value.size());
 
-        if (next == value.end())
+    while (true) {
+        const char* next(implementation::find_first_of_bytes<'&'>(first, last));
+
+        result.append(first, next - first);
+
+        if (next == last)
             return result;
 
         ++next;
 
-        string::const_iterator next_end(std::find(next, value.end(), ';'));
+        const char* next_end(static_cast<const char*>(memchr(next, ';', last - next)));
 
-        if (next_end == value.end())
+        if (!next_end)
             return result;
 
         // snip out the entity and look it up in the map
 
-        std::uint32_t code_point(entity_map_find(string(next, next_end)));
+        std::uint32_t code_point(entity_code_point(string_view(next, next_end - next)));
 
         if (code_point != 0)
             adobe::copy_utf<char>(&code_point, &code_point + 1, std::back_inserter(result));
 
-        iter = ++next_end;
+        first = next_end + 1;
     }
-
-    return result;
 }
 
 /**************************************************************************************************/
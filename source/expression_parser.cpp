@@ -135,6 +135,9 @@ public:
     implementation(std::istream& in, const line_position_t& position)
         : token_stream_m(in, position) {}
 
+    implementation(std::string_view source, const line_position_t& position)
+        : token_stream_m(source, position) {}
+
     void set_keyword_extension_lookup(const keyword_extension_lookup_proc_t& proc) {
         token_stream_m.set_keyword_extension_lookup(proc);
     }
@@ -149,6 +152,9 @@ public:
 expression_parser::expression_parser(std::istream& in, const line_position_t& position)
     : object(new implementation(in, position)) {}
 
+expression_parser::expression_parser(std::string_view source, const line_position_t& position)
+    : object(new implementation(source, position)) {}
+
 expression_parser::~expression_parser() { delete object; }
 
 /**************************************************************************************************/
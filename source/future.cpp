@@ -7,8 +7,12 @@
 
 #include <adobe/future.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <vector>
@@ -132,6 +136,43 @@ struct timed_queue {
     thread schedular_;
 };
 
+/*
+    The calls of one for_each_async(). Pool tasks which start after every call has been claimed
+    find nothing to do, so the job is shared with them and outlives the caller's wait.
+*/
+struct for_each_job_t {
+    for_each_job_t(size_t count, const function<void(size_t)>& f)
+        : count_m(count), next_m(0), failed_m(false), pending_m(count), f_m(f) {}
+
+    void run() {
+        for (size_t i; (i = next_m.fetch_add(1, memory_order_relaxed)) < count_m;) {
+            try {
+                if (!failed_m.load(memory_order_relaxed))
+                    f_m(i);
+            } catch (...) {
+                lock_guard<mutex> lock(mutex_m);
+                if (!error_m)
+                    error_m = current_exception();
+                failed_m.store(true, memory_order_relaxed);
+            }
+
+            lock_guard<mutex> lock(mutex_m);
+            if (--pending_m == 0)
+                condition_m.notify_all();
+        }
+    }
+
+    const size_t count_m;
+    atomic<size_t> next_m; // the next call to claim
+    atomic<bool> failed_m; // whether a call has thrown, so that the rest are skipped
+
+    mutex mutex_m;
+    condition_variable condition_m;
+    size_t pending_m; // the calls not yet finished
+    exception_ptr error_m;
+
+    const function<void(size_t)>& f_m; // only called before the caller's wait ends
+};
 
 } // namespace
 
@@ -153,7 +194,7 @@ void async_(any_packaged_task_&& p) {
         process.
     */
 
-    static thread_pool pool_s;
+    static thread_pool& pool_s = *new thread_pool();
 
     pool_s.async(std::move(p));
 }
@@ -167,6 +208,32 @@ void async_(const steady_clock::time_point& when, any_packaged_task_&& p) {
 
 /**************************************************************************************************/
 
+void for_each_async(size_t count, const function<void(size_t)>& f) {
+    if (count < 2) {
+        if (count)
+            f(0);
+        return;
+    }
+
+    auto job(make_shared<for_each_job_t>(count, f));
+
+    // The pool has a thread for each hardware thread, one of which this thread stands in for.
+    const size_t helpers(min<size_t>(count, thread::hardware_concurrency()));
+
+    for (size_t n(1); n < helpers; ++n)
+        detail::async_([job] { job->run(); });
+
+    job->run();
+
+    unique_lock<mutex> lock(job->mutex_m);
+    job->condition_m.wait(lock, [&] { return job->pending_m == 0; });
+
+    if (job->error_m)
+        rethrow_exception(job->error_m);
+}
+
+/**************************************************************************************************/
+
 struct shared_task_queue::task_queue_ {
     using queue_t = list<any_packaged_task_>;
     using lock_t = unique_lock<mutex>;
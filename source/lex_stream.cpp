@@ -7,18 +7,21 @@
 
 #include <adobe/implementation/lex_stream.hpp>
 
+#include <algorithm>
 #include <array>
+#include <charconv>
+#include <cstdint>
 #include <functional>
 #include <iostream>
-#include <mutex>
 #include <sstream>
+#include <string_view>
 
 #include <adobe/circular_queue.hpp>
 #include <adobe/implementation/lex_shared.hpp>
 #include <adobe/implementation/token.hpp>
 #include <adobe/istream.hpp>
 #include <adobe/name.hpp>
-#include <adobe/once.hpp>
+#include <adobe/static_hash_table.hpp>
 #include <adobe/string.hpp>
 
 /**************************************************************************************************/
@@ -43,207 +46,192 @@ namespace {
 
 /**************************************************************************************************/
 
-using keyword_table_t = std::array<adobe::name_t, 3>;
+using namespace adobe;
 
 /**************************************************************************************************/
 
-const keyword_table_t* keywords_g;
-const char* compound_match_g;
-const adobe::name_t* name_table_g;
-const int* compound_index_g;
-const int* simple_index_g;
+constexpr auto keywords_k = make_static_hash_set({empty_k, true_k, false_k});
 
 /**************************************************************************************************/
 
-void init_once() {
-    static keyword_table_t keywords_s = {{adobe::empty_k, adobe::true_k, adobe::false_k}};
-
-    /*
-        Multi-character tokens. Col + Row = ASCII value of first character in the token. Value at
-        that position in the table is the next character required in order to make a valid token.
-
-        '#' is a special character that denotes the next value could be one of many possibilities,
-        and are custom-handled within is_compound.
-    */
-    static const char compound_match_s[] = {
-        /*           0    1    2    3    4    5    6    7    8    9    A    B    C    D    E    F
-         */
-        /* 00 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* 10 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* 20 */ '0', '=', '0', '0', '0', '0', '&', '0',
-        '0',          '0', '0', '0', '0', '>', '0', '0',
-        /* 30 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '#', '=', '#', '0',
-        /* 40 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* 50 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* 60 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* 70 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '|', '0', '0', '0',
-        /* 80 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* 90 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* A0 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* B0 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* C0 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* D0 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* E0 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0',
-        /* F0 */ '0', '0', '0', '0', '0', '0', '0', '0',
-        '0',          '0', '0', '0', '0', '0', '0', '0'};
-
-    static const adobe::name_t name_table_s[] = {/* 00 */ adobe::empty_k,
-                                                 /* 01 */ adobe::equal_k,
-                                                 /* 02 */ adobe::and_k,
-                                                 /* 03 */ adobe::or_k,
-                                                 /* 04 */ adobe::less_equal_k,
-                                                 /* 05 */ adobe::greater_equal_k,
-                                                 /* 06 */ adobe::not_equal_k,
-                                                 /* 07 */ adobe::add_k,
-                                                 /* 08 */ adobe::subtract_k,
-                                                 /* 09 */ adobe::multiply_k,
-                                                 /* 0A */ adobe::divide_k,
-                                                 /* 0B */ adobe::modulus_k,
-                                                 /* 0C */ adobe::question_k,
-                                                 /* 0D */ adobe::colon_k,
-                                                 /* 0E */ adobe::semicolon_k,
-                                                 /* 0F */ adobe::assign_k,
-                                                 /* 10 */ adobe::not_k,
-                                                 /* 11 */ adobe::open_brace_k,
-                                                 /* 12 */ adobe::close_brace_k,
-                                                 /* 13 */ adobe::less_k,
-                                                 /* 14 */ adobe::greater_k,
-                                                 /* 15 */ adobe::open_parenthesis_k,
-                                                 /* 16 */ adobe::close_parenthesis_k,
-                                                 /* 17 */ adobe::at_k,
-                                                 /* 18 */ adobe::open_bracket_k,
-                                                 /* 19 */ adobe::close_bracket_k,
-                                                 /* 1A */ adobe::comma_k,
-                                                 /* 1B */ adobe::dot_k,
-                                                 /* 1C */ adobe::to_k,
-                                                 /* 1D */ adobe::bitwise_and_k,
-                                                 /* 1E */ adobe::bitwise_xor_k,
-                                                 /* 1F */ adobe::bitwise_or_k,
-                                                 /* 20 */ adobe::bitwise_rshift_k,
-                                                 /* 21 */ adobe::bitwise_lshift_k,
-                                                 /* 22 */ adobe::bitwise_negate_k};
-
-    /*
-        Multi-character tokens. Col + Row = ASCII value of first character in the token. Value at
-        that position in the table is the hex value for the token in the name table that compound
-        token represents.
-    */
-    static const int compound_index_s[] = {
-        /*           0     1     2     3     4     5     6     7     8     9     A     B     C
-           D     E     F    */
-        /* 00 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 10 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 20 */ 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
-        /* 30 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-        /* 40 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 50 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 60 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 70 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-        /* 80 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 90 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* A0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* B0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* C0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* D0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* E0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* F0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-    /*
-        Single-character tokens. Col + Row = ASCII value. Value at that position in the table is the
-        hex value for the token in the name table that ASCII character represents. Example:
-
-            "~" -> ASCII 0x7E -> 0x22 -> adobe::bitwise_negate_k
-
-        Given that this routine is executed once would it be more legible to rewrite the below a la:
-
-            simple_index_s['~'] = adobe::bitwise_negate_k ?
-    */
-    static const int simple_index_s[] = {
-        /*           0     1     2     3     4     5     6     7     8     9     A     B     C
-           D     E     F    */
-        /* 00 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 10 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 20 */ 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x1D, 0x00,
-        0x15,          0x16, 0x09, 0x07, 0x1A, 0x08, 0x1B, 0x0A,
-        /* 30 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x0D, 0x0E, 0x13, 0x0F, 0x14, 0x0C,
-        /* 40 */ 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 50 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x18, 0x00, 0x19, 0x1E, 0x00,
-        /* 60 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 70 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x11, 0x1F, 0x12, 0x22, 0x00,
-        /* 80 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* 90 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* A0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* B0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* C0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* D0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* E0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        /* F0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00,          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-    adobe::sort(keywords_s);
-
-    keywords_g = &keywords_s;
-    compound_match_g = &compound_match_s[0];
-    name_table_g = &name_table_s[0];
-    compound_index_g = &compound_index_s[0];
-    simple_index_g = &simple_index_s[0];
+/*
+    Operator and punctuation tokens by spelling. The character class table and the operator state
+    machine below are generated from this table at compile time.
+*/
+
+struct operator_token_t {
+    static_name_t name_m;
+    std::string_view spelling_m;
+};
+
+constexpr operator_token_t operator_tokens_k[] = {
+    {add_k, "+"},
+    {and_k, "&&"},
+    {assign_k, "="},
+    {at_k, "@"},
+    {bitwise_and_k, "&"},
+    {bitwise_lshift_k, "<<"},
+    {bitwise_negate_k, "~"},
+    {bitwise_or_k, "|"},
+    {bitwise_rshift_k, ">>"},
+    {bitwise_xor_k, "^"},
+    {close_brace_k, "}"},
+    {close_bracket_k, "]"},
+    {close_parenthesis_k, ")"},
+    {colon_k, ":"},
+    {comma_k, ","},
+    {divide_k, "/"},
+    {dot_k, "."},
+    {equal_k, "=="},
+    {greater_equal_k, ">="},
+    {greater_k, ">"},
+    {is_k, "<=="},
+    {less_equal_k, "<="},
+    {less_k, "<"},
+    {modulus_k, "%"},
+    {multiply_k, "*"},
+    {not_equal_k, "!="},
+    {not_k, "!"},
+    {open_brace_k, "{"},
+    {open_bracket_k, "["},
+    {open_parenthesis_k, "("},
+    {or_k, "||"},
+    {question_k, "?"},
+    {semicolon_k, ";"},
+    {subtract_k, "-"},
+    {to_k, "->"},
+};
+
+constexpr std::size_t operator_token_count_k = std::size(operator_tokens_k);
+
+/**************************************************************************************************/
+
+/*
+    A trie over the operator spellings. Each state is a prefix of some operator; transition_m[0] is
+    the start state. accept_m[state] is one plus the index in operator_tokens_k of the operator
+    spelled by that prefix, or zero if the prefix is not itself an operator.
+*/
+
+constexpr std::size_t operator_state_limit_k = [] {
+    std::size_t result(1);
+    for (const auto& token : operator_tokens_k)
+        result += token.spelling_m.size();
+    return result;
+}();
+
+struct operator_machine_t {
+    std::array<std::array<std::uint8_t, 256>, operator_state_limit_k> transition_m{};
+    std::array<std::uint8_t, operator_state_limit_k> accept_m{};
+};
+
+constexpr operator_machine_t make_operator_machine() {
+    operator_machine_t result{};
+    std::size_t state_count(1);
+
+    for (std::size_t i(0); i != operator_token_count_k; ++i) {
+        std::size_t state(0);
+
+        for (char c : operator_tokens_k[i].spelling_m) {
+            auto& next(result.transition_m[state][static_cast<unsigned char>(c)]);
+            if (!next)
+                next = static_cast<std::uint8_t>(state_count++);
+            state = next;
+        }
+
+        result.accept_m[state] = static_cast<std::uint8_t>(i + 1);
+    }
+
+    return result;
+}
+
+constexpr operator_machine_t operator_machine_k = make_operator_machine();
+
+/*
+    The lexer takes the longest operator it can by following transitions until one fails. That is
+    only correct if every prefix of an operator is itself an operator.
+*/
+constexpr bool operator_prefixes_accept() {
+    for (const auto& row : operator_machine_k.transition_m)
+        for (auto next : row)
+            if (next && !operator_machine_k.accept_m[next])
+                return false;
+    return true;
 }
 
+static_assert(operator_prefixes_accept(), "every operator prefix must be an operator.");
+
 /**************************************************************************************************/
 
-static once_flag once_flag;
-void once_instance() { call_once(once_flag, &init_once); }
+/*
+    Every token is classified by its first character.
+*/
+
+enum class char_class_t : std::uint8_t {
+    invalid,
+    space,
+    digit,
+    identifier, // may start an identifier
+    quote,
+    slash, // a comment or the divide operator
+    operator_
+};
+
+constexpr std::array<char_class_t, 256> make_char_class_table() {
+    std::array<char_class_t, 256> result{};
+
+    for (std::size_t c(0); c != result.size(); ++c)
+        if (operator_machine_k.transition_m[0][c])
+            result[c] = char_class_t::operator_;
+
+    for (char c : std::string_view(" \t\n\v\f\r"))
+        result[static_cast<unsigned char>(c)] = char_class_t::space;
+    for (char c('0'); c <= '9'; ++c)
+        result[static_cast<unsigned char>(c)] = char_class_t::digit;
+    for (char c('a'); c <= 'z'; ++c)
+        result[static_cast<unsigned char>(c)] = char_class_t::identifier;
+    for (char c('A'); c <= 'Z'; ++c)
+        result[static_cast<unsigned char>(c)] = char_class_t::identifier;
+
+    result['_'] = char_class_t::identifier;
+    result['\''] = char_class_t::quote;
+    result['"'] = char_class_t::quote;
+    result['/'] = char_class_t::slash;
+
+    return result;
+}
+
+constexpr std::array<char_class_t, 256> char_class_k = make_char_class_table();
+
+inline char_class_t char_class(char c) { return char_class_k[static_cast<unsigned char>(c)]; }
+
+inline bool is_identifier_char(char c) {
+    const char_class_t x(char_class(c));
+    return x == char_class_t::identifier || x == char_class_t::digit;
+}
+
+inline bool is_number_char(char c) { return char_class(c) == char_class_t::digit || c == '.'; }
 
 /**************************************************************************************************/
 
-} // namespace
+/*
+    name_t cannot be constructed at compile time so the operator names are converted once, in the
+    order of operator_tokens_k.
+*/
+
+const name_t& operator_name(std::size_t index) {
+    static const auto names_s = [] {
+        std::array<name_t, operator_token_count_k> result;
+        for (std::size_t i(0); i != operator_token_count_k; ++i)
+            result[i] = operator_tokens_k[i].name_m;
+        return result;
+    }();
+
+    return names_s[index];
+}
 
 /**************************************************************************************************/
 
+} // namespace
 
 /**************************************************************************************************/
 
@@ -251,63 +239,102 @@ namespace adobe {
 
 /**************************************************************************************************/
 
-struct lex_stream_t::implementation_t : stream_lex_base_t<2, std::istreambuf_iterator<char>> {
-    typedef stream_lex_base_t<2, std::istreambuf_iterator<char>> _super;
+/*
+    The lexer is parameterized on its input iterator. std::istreambuf_iterator<char> handles
+    arbitrary streams one character at a time; const char* handles an in-memory buffer, where
+    identifiers, numbers, strings, and line comments are scanned in bulk directly from the buffer.
 
-public:
-    typedef std::istream::pos_type pos_type;
+    Each token is dispatched on the character class of its first character (see char_class_k) and
+    then scanned in a single loop. Operators are matched with a state machine generated from
+    operator_tokens_k.
+*/
+
+struct lex_stream_t::implementation_t {
+    virtual ~implementation_t() = default;
+
+    virtual implementation_t* clone() const = 0;
+
+    virtual const stream_lex_token_t& get() = 0;
+    virtual void putback() = 0;
+    virtual const line_position_t& next_position() = 0;
+
+    void set_keyword_extension_lookup(const keyword_extension_lookup_proc_t& proc) {
+        keyword_proc_m = proc;
+    }
+
+    void set_comment_bypass(bool bypass) { comment_bypass_m = bypass; }
+
+    template <typename I> // I models InputIterator
+    struct lexer_t;
 
-    implementation_t(std::istream& in, const line_position_t& position);
+protected:
+    keyword_extension_lookup_proc_t keyword_proc_m;
+    bool comment_bypass_m{false};
+};
+
+/**************************************************************************************************/
+
+template <typename I>
+struct lex_stream_t::implementation_t::lexer_t final
+    : lex_stream_t::implementation_t,
+      stream_lex_base_t<2, I, lex_stream_t::implementation_t::lexer_t<I>> {
+    typedef stream_lex_base_t<2, I, lexer_t> _super;
 
-    void set_keyword_extension_lookup(const keyword_extension_lookup_proc_t& proc);
+public:
+    lexer_t(I first, I last, const line_position_t& position) : _super(first, last, position) {}
+
+    implementation_t* clone() const override { return new lexer_t(*this); }
 
-    void set_comment_bypass(bool bypass);
+    const stream_lex_token_t& get() override { return _super::get_token(); }
+    void putback() override { _super::putback_token(); }
+    const line_position_t& next_position() override { return _super::next_position(); }
 
 private:
+    friend _super;
+
     void parse_token(char c);
 
     bool is_comment(char c, stream_lex_token_t& result);
-    bool is_string(char c, stream_lex_token_t& result);
-    bool is_number(char c, stream_lex_token_t& result);
-    bool is_compound(char c, stream_lex_token_t& result);
-    bool is_simple(char c, stream_lex_token_t& result);
-    bool is_identifier_or_keyword(char c, stream_lex_token_t& result);
+    void lex_string(char c, stream_lex_token_t& result);
+    void lex_number(char c, stream_lex_token_t& result);
+    void lex_operator(char c, stream_lex_token_t& result);
+    void lex_identifier_or_keyword(char c, stream_lex_token_t& result);
 
     bool is_hex_number(char c, stream_lex_token_t& result);
-    bool is_dec_number(char c, stream_lex_token_t& result);
+    void lex_dec_number(char c, stream_lex_token_t& result);
 
     bool skip_space(char& c);
 
-    keyword_extension_lookup_proc_t keyword_proc_m;
-    bool comment_bypass_m;
+    name_t make_identifier(const char* first, const char* last);
 };
 
 /**************************************************************************************************/
 
 lex_stream_t::lex_stream_t(std::istream& in, const line_position_t& position)
-    : object_m(new lex_stream_t::implementation_t(in, position)) {
-    once_instance();
-}
+    : object_m(new implementation_t::lexer_t<std::istreambuf_iterator<char>>(
+          std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>(), position)) {}
+
+lex_stream_t::lex_stream_t(std::string_view source, const line_position_t& position)
+    : object_m(new implementation_t::lexer_t<const char*>(
+          source.data(), source.data() + source.size(), position)) {}
 
 #if !defined(ADOBE_NO_DOCUMENTATION)
 
-lex_stream_t::lex_stream_t(const lex_stream_t& rhs)
-    : object_m(new lex_stream_t::implementation_t(*rhs.object_m)) {
-    once_instance();
-}
+lex_stream_t::lex_stream_t(const lex_stream_t& rhs) : object_m(rhs.object_m->clone()) {}
 
 lex_stream_t::~lex_stream_t() { delete object_m; }
 
 lex_stream_t& lex_stream_t::operator=(const lex_stream_t& rhs) {
-    *object_m = *rhs.object_m;
+    lex_stream_t temp(rhs);
+    ::swap(*this, temp);
     return *this;
 }
 
 #endif // !defined(ADOBE_NO_DOCUMENTATION)
 
-const stream_lex_token_t& lex_stream_t::get() { return object_m->get_token(); }
+const stream_lex_token_t& lex_stream_t::get() { return object_m->get(); }
 
-void lex_stream_t::putback() { object_m->putback_token(); }
+void lex_stream_t::putback() { object_m->putback(); }
 
 const line_position_t& lex_stream_t::next_position() { return object_m->next_position(); }
 
@@ -325,35 +352,17 @@ void lex_stream_t::set_comment_bypass(bool bypass) { return object_m->set_commen
 
 /**************************************************************************************************/
 
-lex_stream_t::implementation_t::implementation_t(std::istream& in, const line_position_t& position)
-    : _super(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>(),
-             position),
-      comment_bypass_m(false) {
-
-    _super::set_parse_token_proc(
-        std::bind(&lex_stream_t::implementation_t::parse_token, std::ref(*this), _1));
-}
-
-/**************************************************************************************************/
-
-void lex_stream_t::implementation_t::set_keyword_extension_lookup(
-    const keyword_extension_lookup_proc_t& proc) {
-    keyword_proc_m = proc;
+template <typename I>
+void lex_stream_t::implementation_t::lexer_t<I>::lex_number(char c, stream_lex_token_t& result) {
+    if (!is_hex_number(c, result))
+        lex_dec_number(c, result);
 }
 
 /**************************************************************************************************/
 
-void lex_stream_t::implementation_t::set_comment_bypass(bool bypass) { comment_bypass_m = bypass; }
-
-/**************************************************************************************************/
-
-bool lex_stream_t::implementation_t::is_number(char c, stream_lex_token_t& result) {
-    return is_hex_number(c, result) || is_dec_number(c, result);
-}
-
-/**************************************************************************************************/
-
-bool lex_stream_t::implementation_t::is_hex_number(char c, stream_lex_token_t& result) {
+template <typename I>
+bool lex_stream_t::implementation_t::lexer_t<I>::is_hex_number(char c,
+                                                               stream_lex_token_t& result) {
     if (c != '0' || std::tolower(_super::peek_char()) != 'x')
         return false;
 
@@ -371,7 +380,7 @@ bool lex_stream_t::implementation_t::is_hex_number(char c, stream_lex_token_t& r
         if (!_super::get_char(c))
             break;
 
-        if (!std::isxdigit(c)) {
+        if (!std::isxdigit(static_cast<unsigned char>(c))) {
             _super::putback_char(c);
 
             break;
@@ -390,73 +399,102 @@ bool lex_stream_t::implementation_t::is_hex_number(char c, stream_lex_token_t& r
 
 /**************************************************************************************************/
 
-bool lex_stream_t::implementation_t::is_dec_number(char c, stream_lex_token_t& result) {
-    if (!std::isdigit(c))
-        return false;
-
+template <typename I>
+void lex_stream_t::implementation_t::lexer_t<I>::lex_dec_number(char c,
+                                                                stream_lex_token_t& result) {
     _super::putback_char(c);
 
+    double re(0);
+
+#if defined(__cpp_lib_to_chars)
+    if constexpr (_super::is_contiguous_k) {
+        const char* first(_super::input_first());
+        const char* last(std::find_if_not(first, _super::input_last(), &is_number_char));
+
+        // Like operator>>, ignore anything following a second decimal point.
+        (void)std::from_chars(first, last, re);
+        _super::advance_input(last);
+
+        result = stream_lex_token_t(number_k, any_regular_t(re));
+        return;
+    }
+#endif
+
     std::stringstream temp;
     temp.imbue(std::locale::classic());
 
-    while (true) {
-        if (!_super::get_char(c))
-            break;
-
-        if (!std::isdigit(c) && c != '.') {
+    while (_super::get_char(c)) {
+        if (!is_number_char(c)) {
             _super::putback_char(c);
-
             break;
         }
 
         temp << c;
     }
 
-    double re(0);
     temp >> re;
 
     result = stream_lex_token_t(number_k, any_regular_t(re));
-    return true;
 }
 
 /**************************************************************************************************/
 
-bool lex_stream_t::implementation_t::is_identifier_or_keyword(char c, stream_lex_token_t& result) {
-    if (!std::isalpha(c) && c != '_')
-        return false;
+template <typename I>
+name_t lex_stream_t::implementation_t::lexer_t<I>::make_identifier(const char* first,
+                                                                   const char* last) {
+    // The string pool requires a null terminated string.
+    _super::identifier_buffer_m.assign(first, last);
+    _super::identifier_buffer_m.push_back(0);
 
-    identifier_buffer_m.clear();
+    return name_t(&_super::identifier_buffer_m.front());
+}
 
-    do {
-        if (std::isalnum(c) || c == '_') {
-            identifier_buffer_m.push_back(c);
-        } else {
-            _super::putback_char(c);
-            break;
+/**************************************************************************************************/
+
+template <typename I>
+void lex_stream_t::implementation_t::lexer_t<I>::lex_identifier_or_keyword(
+    char c, stream_lex_token_t& result) {
+    name_t ident;
+    bool is_keyword;
+
+    if constexpr (_super::is_contiguous_k) {
+        const char* first(_super::input_first() - 1); // c has already been read
+        const char* last(
+            std::find_if_not(_super::input_first(), _super::input_last(), &is_identifier_char));
+
+        _super::advance_input(last);
+        is_keyword = keywords_k.contains(std::string_view(first, last - first));
+        ident = make_identifier(first, last);
+    } else {
+        auto& buffer(_super::identifier_buffer_m);
+        buffer.clear();
+        buffer.push_back(c);
+
+        while (_super::get_char(c)) {
+            if (!is_identifier_char(c)) {
+                _super::putback_char(c);
+                break;
+            }
+            buffer.push_back(c);
         }
-    } while (_super::get_char(c));
 
-    identifier_buffer_m.push_back(0);
+        is_keyword = keywords_k.contains(std::string_view(&buffer.front(), buffer.size()));
+        buffer.push_back(0);
 
-    name_t ident(&identifier_buffer_m.front());
-    keyword_table_t::const_iterator iter(lower_bound(*keywords_g, ident));
+        ident = name_t(&buffer.front());
+    }
 
-    if ((iter != keywords_g->end() && *iter == ident) ||
-        (keyword_proc_m && keyword_proc_m(ident))) {
+    if (is_keyword || (keyword_proc_m && keyword_proc_m(ident))) {
         result = stream_lex_token_t(keyword_k, any_regular_t(ident));
     } else {
         result = stream_lex_token_t(identifier_k, any_regular_t(ident));
     }
-
-    return true;
 }
 
 /**************************************************************************************************/
 
-bool lex_stream_t::implementation_t::is_comment(char c, stream_lex_token_t& result) {
-    if (c != '/')
-        return false;
-
+template <typename I>
+bool lex_stream_t::implementation_t::lexer_t<I>::is_comment(char c, stream_lex_token_t& result) {
     std::istream::int_type peek_c(_super::peek_char());
 
     if (peek_c == EOF || (peek_c != '/' && peek_c != '*'))
@@ -464,22 +502,35 @@ bool lex_stream_t::implementation_t::is_comment(char c, stream_lex_token_t& resu
 
     (void)_super::get_char(c);
 
-    identifier_buffer_m.clear();
+    auto& buffer(_super::identifier_buffer_m);
+    buffer.clear();
 
     if (c == '/') {
-        while (_super::get_char(c) && !is_line_end(c)) {
-            identifier_buffer_m.push_back(c);
+        if constexpr (_super::is_contiguous_k) {
+            const char* first(_super::input_first());
+            const char* last(std::find_if(first, _super::input_last(),
+                                          [](char x) { return x == '\n' || x == '\r'; }));
+
+            _super::advance_input(last);
+            if (_super::get_char(c))
+                (void)_super::is_line_end(c);
+
+            result = stream_lex_token_t(trail_comment_k, any_regular_t(std::string(first, last)));
+            return true;
+        }
+
+        while (_super::get_char(c) && !_super::is_line_end(c)) {
+            buffer.push_back(c);
         }
 
-        identifier_buffer_m.push_back(0);
+        buffer.push_back(0);
 
-        result = stream_lex_token_t(trail_comment_k,
-                                    any_regular_t(std::string(&identifier_buffer_m[0])));
+        result = stream_lex_token_t(trail_comment_k, any_regular_t(std::string(&buffer[0])));
     } else // if (c == '*')
     {
         while (true) {
             if (!_super::get_char(c))
-                throw_parser_exception("unexpected `eof` in comment.");
+                _super::throw_parser_exception("unexpected `eof` in comment.");
 
             if (c == '*') {
                 peek_c = _super::peek_char();
@@ -488,17 +539,16 @@ bool lex_stream_t::implementation_t::is_comment(char c, stream_lex_token_t& resu
                     _super::ignore_char();
                     break;
                 }
-            } else if (is_line_end(c)) {
+            } else if (_super::is_line_end(c)) {
                 c = '\n';
             }
 
-            identifier_buffer_m.push_back(c);
+            buffer.push_back(c);
         }
 
-        identifier_buffer_m.push_back(0);
+        buffer.push_back(0);
 
-        result =
-            stream_lex_token_t(lead_comment_k, any_regular_t(std::string(&identifier_buffer_m[0])));
+        result = stream_lex_token_t(lead_comment_k, any_regular_t(std::string(&buffer[0])));
     }
 
     return true;
@@ -506,11 +556,36 @@ bool lex_stream_t::implementation_t::is_comment(char c, stream_lex_token_t& resu
 
 /**************************************************************************************************/
 
-bool lex_stream_t::implementation_t::is_string(char c, stream_lex_token_t& result) {
-    if (c != '\'' && c != '\"')
-        return false;
+template <typename I>
+void lex_stream_t::implementation_t::lexer_t<I>::lex_string(char c, stream_lex_token_t& result) {
+    if constexpr (_super::is_contiguous_k) {
+        std::string value;
+
+        while (true) {
+            const char* first(_super::input_first());
+            const char* last(std::find(first, _super::input_last(), c));
+
+            if (last == _super::input_last())
+                _super::throw_parser_exception("unexpected `eof` in string.");
+
+            value.append(first, last);
+            _super::advance_input(last + 1);
+
+            if (!skip_space(c))
+                break;
+
+            if (char_class(c) != char_class_t::quote) {
+                _super::putback_char(c);
+                break;
+            }
+        }
+
+        result = stream_lex_token_t(string_k, any_regular_t(std::move(value)));
+        return;
+    }
 
-    identifier_buffer_m.clear();
+    auto& buffer(_super::identifier_buffer_m);
+    buffer.clear();
 
     while (true) {
         char end_char(c);
@@ -518,122 +593,95 @@ bool lex_stream_t::implementation_t::is_string(char c, stream_lex_token_t& resul
         while (_super::get_char(c) && c != end_char) {
             // REVISIT (sparent) : Handle quoted characters here.
             // Also handle invalid characters such as line endings.
-            identifier_buffer_m.push_back(c);
+            buffer.push_back(c);
         }
 
         if (c != end_char)
-            throw_parser_exception("unexpected `eof` in string.");
+            _super::throw_parser_exception("unexpected `eof` in string.");
 
         if (!skip_space(c))
             break;
 
-        if (c != '\'' && c != '\"') {
+        if (char_class(c) != char_class_t::quote) {
             _super::putback_char(c);
             break;
         }
     }
 
-    identifier_buffer_m.push_back(0);
-    result = stream_lex_token_t(string_k, any_regular_t(std::string(&identifier_buffer_m[0])));
-
-    return true;
+    buffer.push_back(0);
+    result = stream_lex_token_t(string_k, any_regular_t(std::string(&buffer[0])));
 }
 
 /**************************************************************************************************/
 
 /*
-    is_compound() works by noting that in most of the current compound tokens the token is unique
-    in the first character and only requires that the proper second character be present.
+    Takes the longest operator starting with c. Since every prefix of an operator is an operator
+    (see operator_prefixes_accept()) the match ends at the first character without a transition.
 */
 
-bool lex_stream_t::implementation_t::is_compound(char c, stream_lex_token_t& result) {
-    char next_char(compound_match_g[(unsigned char)c]);
-
-    if (next_char == '0')
-        return false;
-
-    int actual_char(_super::peek_char());
-
-    if (actual_char == EOF)
-        return false;
+template <typename I>
+void lex_stream_t::implementation_t::lexer_t<I>::lex_operator(char c, stream_lex_token_t& result) {
+    std::size_t state(operator_machine_k.transition_m[0][static_cast<unsigned char>(c)]);
 
-    /*
-    There are cases compound characters that conflict in the simple table lookup:
-        - >= and >>
-        - <= and << and <==
-    We special case them here rather than adding an additional table.
-    */
-    if (next_char == '#') {
-        name_t token;
-
-        if (c == '>' && actual_char == '>')
-            token = bitwise_rshift_k;
-        if (c == '>' && actual_char == '=')
-            token = greater_equal_k;
-        if (c == '<' && actual_char == '<')
-            token = bitwise_lshift_k;
-        if (c == '<' && actual_char == '=') {
-            _super::ignore_char();
-            if (_super::peek_char() == '=')
-                token = is_k;
-            else {
-                result = stream_lex_token_t(less_equal_k, any_regular_t());
-                return true;
-            }
-        }
+    while (true) {
+        const int next_c(_super::peek_char());
+        if (next_c == EOF)
+            break;
 
-        if (token) {
-            _super::ignore_char();
-            result = stream_lex_token_t(token, any_regular_t());
-            return true;
-        }
+        const std::size_t next(
+            operator_machine_k.transition_m[state][static_cast<unsigned char>(next_c)]);
+        if (!next)
+            break;
 
-        return false;
+        _super::ignore_char();
+        state = next;
     }
 
-
-    if (actual_char != next_char)
-        return false;
-
-    _super::ignore_char();
-    result = stream_lex_token_t(name_table_g[compound_index_g[(unsigned char)c]], any_regular_t());
-    return true;
-}
-
-/**************************************************************************************************/
-
-bool lex_stream_t::implementation_t::is_simple(char c, stream_lex_token_t& result) {
-    int index(simple_index_g[(unsigned char)c]);
-
-    if (index == 0)
-        return false;
-
-    result = stream_lex_token_t(name_table_g[index], any_regular_t());
-    return true;
+    result = stream_lex_token_t(operator_name(operator_machine_k.accept_m[state] - 1u),
+                                any_regular_t());
 }
 
 /**************************************************************************************************/
 
-bool lex_stream_t::implementation_t::skip_space(char& c) {
-    skip_white_space();
+template <typename I>
+bool lex_stream_t::implementation_t::lexer_t<I>::skip_space(char& c) {
+    _super::skip_white_space();
 
-    return get_char(c);
+    return _super::get_char(c);
 }
 
 /**************************************************************************************************/
 
-void lex_stream_t::implementation_t::parse_token(char c) {
+template <typename I>
+void lex_stream_t::implementation_t::lexer_t<I>::parse_token(char c) {
     stream_lex_token_t result;
 
-    bool found_comment = is_comment(c, result);
-
-    if (!(is_number(c, result) || is_identifier_or_keyword(c, result) || found_comment ||
-          is_string(c, result) || is_compound(c, result) || is_simple(c, result))) {
-        throw_parser_exception("unexpected character `"s + c + "`.");
+    switch (char_class(c)) {
+    case char_class_t::digit:
+        lex_number(c, result);
+        break;
+    case char_class_t::identifier:
+        lex_identifier_or_keyword(c, result);
+        break;
+    case char_class_t::quote:
+        lex_string(c, result);
+        break;
+    case char_class_t::slash:
+        if (is_comment(c, result)) {
+            if (!comment_bypass_m)
+                _super::put_token(std::move(result));
+            return;
+        }
+        lex_operator(c, result);
+        break;
+    case char_class_t::operator_:
+        lex_operator(c, result);
+        break;
+    default:
+        _super::throw_parser_exception("unexpected character `"s + c + "`.");
     }
 
-    if (!found_comment || !comment_bypass_m)
-        put_token(std::move(result));
+    _super::put_token(std::move(result));
 }
 
 
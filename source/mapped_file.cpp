@@ -0,0 +1,152 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/mapped_file.hpp>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#if ADOBE_PLATFORM_WIN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+[[noreturn]] void throw_mapping_error(const std::filesystem::path& path) {
+#if ADOBE_PLATFORM_WIN
+    std::error_code error(static_cast<int>(::GetLastError()), std::system_category());
+#else
+    std::error_code error(errno, std::generic_category());
+#endif
+    const auto name(path.u8string()); // std::u8string from C++20
+    throw std::system_error(error, "mapped_file_t: " + std::string(name.begin(), name.end()));
+}
+
+/**************************************************************************************************/
+
+#if ADOBE_PLATFORM_WIN
+
+struct handle_t {
+    explicit handle_t(HANDLE handle) : handle_m(handle) {}
+    ~handle_t() {
+        if (handle_m && handle_m != INVALID_HANDLE_VALUE)
+            ::CloseHandle(handle_m);
+    }
+    handle_t(const handle_t&) = delete;
+    handle_t& operator=(const handle_t&) = delete;
+
+    HANDLE handle_m;
+};
+
+#endif
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+#if ADOBE_PLATFORM_WIN
+
+mapped_file_t::mapped_file_t(const std::filesystem::path& path) {
+    handle_t file(::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+    if (file.handle_m == INVALID_HANDLE_VALUE)
+        throw_mapping_error(path);
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file.handle_m, &size))
+        throw_mapping_error(path);
+    if (size.QuadPart == 0)
+        return;
+
+    handle_t mapping(::CreateFileMappingW(file.handle_m, nullptr, PAGE_READONLY, 0, 0, nullptr));
+    if (!mapping.handle_m)
+        throw_mapping_error(path);
+
+    // The view keeps the mapping alive after the handles are closed.
+    void* view(::MapViewOfFile(mapping.handle_m, FILE_MAP_READ, 0, 0, 0));
+    if (!view)
+        throw_mapping_error(path);
+
+    data_m = static_cast<const char*>(view);
+    size_m = static_cast<std::size_t>(size.QuadPart);
+}
+
+mapped_file_t::~mapped_file_t() {
+    if (data_m)
+        ::UnmapViewOfFile(data_m);
+}
+
+#else
+
+mapped_file_t::mapped_file_t(const std::filesystem::path& path) {
+    int file(::open(path.c_str(), O_RDONLY));
+    if (file == -1)
+        throw_mapping_error(path);
+
+    struct stat status;
+    if (::fstat(file, &status) == -1) {
+        int error(errno);
+        ::close(file);
+        errno = error;
+        throw_mapping_error(path);
+    }
+
+    if (status.st_size == 0) {
+        ::close(file);
+        return;
+    }
+
+    // The mapping remains valid after the descriptor is closed.
+    void* view(::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE,
+                      file, 0));
+    int error(errno);
+    ::close(file);
+
+    if (view == MAP_FAILED) {
+        errno = error;
+        throw_mapping_error(path);
+    }
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+    (void)::posix_madvise(view, static_cast<std::size_t>(status.st_size), POSIX_MADV_SEQUENTIAL);
+#endif
+
+    data_m = static_cast<const char*>(view);
+    size_m = static_cast<std::size_t>(status.st_size);
+}
+
+mapped_file_t::~mapped_file_t() {
+    if (data_m)
+        ::munmap(const_cast<char*>(data_m), size_m);
+}
+
+#endif
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <cstring>
 
+#include <adobe/implementation/sha_x86.hpp>
+
 /**************************************************************************************************/
 
 /*
@@ -76,16 +78,19 @@ namespace {
 
 /**************************************************************************************************/
 
-void MD5Transform(std::uint32_t[4], std::uint8_t[64]);
-void Encode(std::uint8_t*, std::uint32_t*, std::uint16_t);
-void Decode(std::uint32_t*, std::uint8_t*, std::uint16_t);
+void MD5Transform(std::uint32_t[4], const std::uint8_t*, std::size_t);
+void Encode(std::uint8_t*, const std::uint32_t*, std::uint16_t);
+std::uint32_t Decode(const std::uint8_t*);
 
 /**************************************************************************************************/
 
-/* F, G, H and I are basic MD5 functions. */
+/*
+    F, G, H and I are basic MD5 functions. F and G are the equivalent forms of RFC 1321's
+    (x & y) | (~x & z) and (x & z) | (y & ~z) which take one operation less.
+*/
 
-#define F(x, y, z) (((x) & (y)) | ((~x) & (z)))
-#define G(x, y, z) (((x) & (z)) | ((y) & (~z)))
+#define F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define G(x, y, z) ((y) ^ ((z) & ((x) ^ (y))))
 #define H(x, y, z) ((x) ^ (y) ^ (z))
 #define I(x, y, z) ((y) ^ ((x) | (~z)))
 
@@ -127,92 +132,103 @@ Rotation is separate from addition to prevent recomputation. */
 
 /**************************************************************************************************/
 
-/* MD5 basic transformation. Transforms state based on block. */
-
-void MD5Transform(std::uint32_t state[4], std::uint8_t block[64]) {
-    std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3], x[16];
-
-    Decode(x, block, 64);
-
-    /* Round 1 */
-    FF(a, b, c, d, x[0], S11, 0xd76aa478);  /* 1 */
-    FF(d, a, b, c, x[1], S12, 0xe8c7b756);  /* 2 */
-    FF(c, d, a, b, x[2], S13, 0x242070db);  /* 3 */
-    FF(b, c, d, a, x[3], S14, 0xc1bdceee);  /* 4 */
-    FF(a, b, c, d, x[4], S11, 0xf57c0faf);  /* 5 */
-    FF(d, a, b, c, x[5], S12, 0x4787c62a);  /* 6 */
-    FF(c, d, a, b, x[6], S13, 0xa8304613);  /* 7 */
-    FF(b, c, d, a, x[7], S14, 0xfd469501);  /* 8 */
-    FF(a, b, c, d, x[8], S11, 0x698098d8);  /* 9 */
-    FF(d, a, b, c, x[9], S12, 0x8b44f7af);  /* 10 */
-    FF(c, d, a, b, x[10], S13, 0xffff5bb1); /* 11 */
-    FF(b, c, d, a, x[11], S14, 0x895cd7be); /* 12 */
-    FF(a, b, c, d, x[12], S11, 0x6b901122); /* 13 */
-    FF(d, a, b, c, x[13], S12, 0xfd987193); /* 14 */
-    FF(c, d, a, b, x[14], S13, 0xa679438e); /* 15 */
-    FF(b, c, d, a, x[15], S14, 0x49b40821); /* 16 */
-
-    /* Round 2 */
-    GG(a, b, c, d, x[1], S21, 0xf61e2562);  /* 17 */
-    GG(d, a, b, c, x[6], S22, 0xc040b340);  /* 18 */
-    GG(c, d, a, b, x[11], S23, 0x265e5a51); /* 19 */
-    GG(b, c, d, a, x[0], S24, 0xe9b6c7aa);  /* 20 */
-    GG(a, b, c, d, x[5], S21, 0xd62f105d);  /* 21 */
-    GG(d, a, b, c, x[10], S22, 0x2441453);  /* 22 */
-    GG(c, d, a, b, x[15], S23, 0xd8a1e681); /* 23 */
-    GG(b, c, d, a, x[4], S24, 0xe7d3fbc8);  /* 24 */
-    GG(a, b, c, d, x[9], S21, 0x21e1cde6);  /* 25 */
-    GG(d, a, b, c, x[14], S22, 0xc33707d6); /* 26 */
-    GG(c, d, a, b, x[3], S23, 0xf4d50d87);  /* 27 */
-    GG(b, c, d, a, x[8], S24, 0x455a14ed);  /* 28 */
-    GG(a, b, c, d, x[13], S21, 0xa9e3e905); /* 29 */
-    GG(d, a, b, c, x[2], S22, 0xfcefa3f8);  /* 30 */
-    GG(c, d, a, b, x[7], S23, 0x676f02d9);  /* 31 */
-    GG(b, c, d, a, x[12], S24, 0x8d2a4c8a); /* 32 */
-
-    /* Round 3 */
-    HH(a, b, c, d, x[5], S31, 0xfffa3942);  /* 33 */
-    HH(d, a, b, c, x[8], S32, 0x8771f681);  /* 34 */
-    HH(c, d, a, b, x[11], S33, 0x6d9d6122); /* 35 */
-    HH(b, c, d, a, x[14], S34, 0xfde5380c); /* 36 */
-    HH(a, b, c, d, x[1], S31, 0xa4beea44);  /* 37 */
-    HH(d, a, b, c, x[4], S32, 0x4bdecfa9);  /* 38 */
-    HH(c, d, a, b, x[7], S33, 0xf6bb4b60);  /* 39 */
-    HH(b, c, d, a, x[10], S34, 0xbebfbc70); /* 40 */
-    HH(a, b, c, d, x[13], S31, 0x289b7ec6); /* 41 */
-    HH(d, a, b, c, x[0], S32, 0xeaa127fa);  /* 42 */
-    HH(c, d, a, b, x[3], S33, 0xd4ef3085);  /* 43 */
-    HH(b, c, d, a, x[6], S34, 0x4881d05);   /* 44 */
-    HH(a, b, c, d, x[9], S31, 0xd9d4d039);  /* 45 */
-    HH(d, a, b, c, x[12], S32, 0xe6db99e5); /* 46 */
-    HH(c, d, a, b, x[15], S33, 0x1fa27cf8); /* 47 */
-    HH(b, c, d, a, x[2], S34, 0xc4ac5665);  /* 48 */
-
-    /* Round 4 */
-    II(a, b, c, d, x[0], S41, 0xf4292244);  /* 49 */
-    II(d, a, b, c, x[7], S42, 0x432aff97);  /* 50 */
-    II(c, d, a, b, x[14], S43, 0xab9423a7); /* 51 */
-    II(b, c, d, a, x[5], S44, 0xfc93a039);  /* 52 */
-    II(a, b, c, d, x[12], S41, 0x655b59c3); /* 53 */
-    II(d, a, b, c, x[3], S42, 0x8f0ccc92);  /* 54 */
-    II(c, d, a, b, x[10], S43, 0xffeff47d); /* 55 */
-    II(b, c, d, a, x[1], S44, 0x85845dd1);  /* 56 */
-    II(a, b, c, d, x[8], S41, 0x6fa87e4f);  /* 57 */
-    II(d, a, b, c, x[15], S42, 0xfe2ce6e0); /* 58 */
-    II(c, d, a, b, x[6], S43, 0xa3014314);  /* 59 */
-    II(b, c, d, a, x[13], S44, 0x4e0811a1); /* 60 */
-    II(a, b, c, d, x[4], S41, 0xf7537e82);  /* 61 */
-    II(d, a, b, c, x[11], S42, 0xbd3af235); /* 62 */
-    II(c, d, a, b, x[2], S43, 0x2ad7d2bb);  /* 63 */
-    II(b, c, d, a, x[9], S44, 0xeb86d391);  /* 64 */
-
-    state[0] += a;
-    state[1] += b;
-    state[2] += c;
-    state[3] += d;
-
-    /* Zeroize sensitive information. */
-    std::memset(x, 0, sizeof(x));
+/*
+    MD5 basic transformation. Transforms state based on the n 64 byte blocks at block, read in
+    place. The state is kept in registers from one block to the next.
+*/
+
+void MD5Transform(std::uint32_t state[4], const std::uint8_t* block, std::size_t n) {
+    std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+
+    for (; n != 0; --n, block += 64) {
+        const std::uint32_t aa = a, bb = b, cc = c, dd = d;
+        std::uint32_t x[16];
+
+        for (std::size_t i = 0; i != 16; ++i)
+            x[i] = Decode(block + 4 * i);
+
+        /* Round 1 */
+        FF(a, b, c, d, x[0], S11, 0xd76aa478);  /* 1 */
+        FF(d, a, b, c, x[1], S12, 0xe8c7b756);  /* 2 */
+        FF(c, d, a, b, x[2], S13, 0x242070db);  /* 3 */
+        FF(b, c, d, a, x[3], S14, 0xc1bdceee);  /* 4 */
+        FF(a, b, c, d, x[4], S11, 0xf57c0faf);  /* 5 */
+        FF(d, a, b, c, x[5], S12, 0x4787c62a);  /* 6 */
+        FF(c, d, a, b, x[6], S13, 0xa8304613);  /* 7 */
+        FF(b, c, d, a, x[7], S14, 0xfd469501);  /* 8 */
+        FF(a, b, c, d, x[8], S11, 0x698098d8);  /* 9 */
+        FF(d, a, b, c, x[9], S12, 0x8b44f7af);  /* 10 */
+        FF(c, d, a, b, x[10], S13, 0xffff5bb1); /* 11 */
+        FF(b, c, d, a, x[11], S14, 0x895cd7be); /* 12 */
+        FF(a, b, c, d, x[12], S11, 0x6b901122); /* 13 */
+        FF(d, a, b, c, x[13], S12, 0xfd987193); /* 14 */
+        FF(c, d, a, b, x[14], S13, 0xa679438e); /* 15 */
+        FF(b, c, d, a, x[15], S14, 0x49b40821); /* 16 */
+
+        /* Round 2 */
+        GG(a, b, c, d, x[1], S21, 0xf61e2562);  /* 17 */
+        GG(d, a, b, c, x[6], S22, 0xc040b340);  /* 18 */
+        GG(c, d, a, b, x[11], S23, 0x265e5a51); /* 19 */
+        GG(b, c, d, a, x[0], S24, 0xe9b6c7aa);  /* 20 */
+        GG(a, b, c, d, x[5], S21, 0xd62f105d);  /* 21 */
+        GG(d, a, b, c, x[10], S22, 0x2441453);  /* 22 */
+        GG(c, d, a, b, x[15], S23, 0xd8a1e681); /* 23 */
+        GG(b, c, d, a, x[4], S24, 0xe7d3fbc8);  /* 24 */
+        GG(a, b, c, d, x[9], S21, 0x21e1cde6);  /* 25 */
+        GG(d, a, b, c, x[14], S22, 0xc33707d6); /* 26 */
+        GG(c, d, a, b, x[3], S23, 0xf4d50d87);  /* 27 */
+        GG(b, c, d, a, x[8], S24, 0x455a14ed);  /* 28 */
+        GG(a, b, c, d, x[13], S21, 0xa9e3e905); /* 29 */
+        GG(d, a, b, c, x[2], S22, 0xfcefa3f8);  /* 30 */
+        GG(c, d, a, b, x[7], S23, 0x676f02d9);  /* 31 */
+        GG(b, c, d, a, x[12], S24, 0x8d2a4c8a); /* 32 */
+
+        /* Round 3 */
+        HH(a, b, c, d, x[5], S31, 0xfffa3942);  /* 33 */
+        HH(d, a, b, c, x[8], S32, 0x8771f681);  /* 34 */
+        HH(c, d, a, b, x[11], S33, 0x6d9d6122); /* 35 */
+        HH(b, c, d, a, x[14], S34, 0xfde5380c); /* 36 */
+        HH(a, b, c, d, x[1], S31, 0xa4beea44);  /* 37 */
+        HH(d, a, b, c, x[4], S32, 0x4bdecfa9);  /* 38 */
+        HH(c, d, a, b, x[7], S33, 0xf6bb4b60);  /* 39 */
+        HH(b, c, d, a, x[10], S34, 0xbebfbc70); /* 40 */
+        HH(a, b, c, d, x[13], S31, 0x289b7ec6); /* 41 */
+        HH(d, a, b, c, x[0], S32, 0xeaa127fa);  /* 42 */
+        HH(c, d, a, b, x[3], S33, 0xd4ef3085);  /* 43 */
+        HH(b, c, d, a, x[6], S34, 0x4881d05);   /* 44 */
+        HH(a, b, c, d, x[9], S31, 0xd9d4d039);  /* 45 */
+        HH(d, a, b, c, x[12], S32, 0xe6db99e5); /* 46 */
+        HH(c, d, a, b, x[15], S33, 0x1fa27cf8); /* 47 */
+        HH(b, c, d, a, x[2], S34, 0xc4ac5665);  /* 48 */
+
+        /* Round 4 */
+        II(a, b, c, d, x[0], S41, 0xf4292244);  /* 49 */
+        II(d, a, b, c, x[7], S42, 0x432aff97);  /* 50 */
+        II(c, d, a, b, x[14], S43, 0xab9423a7); /* 51 */
+        II(b, c, d, a, x[5], S44, 0xfc93a039);  /* 52 */
+        II(a, b, c, d, x[12], S41, 0x655b59c3); /* 53 */
+        II(d, a, b, c, x[3], S42, 0x8f0ccc92);  /* 54 */
+        II(c, d, a, b, x[10], S43, 0xffeff47d); /* 55 */
+        II(b, c, d, a, x[1], S44, 0x85845dd1);  /* 56 */
+        II(a, b, c, d, x[8], S41, 0x6fa87e4f);  /* 57 */
+        II(d, a, b, c, x[15], S42, 0xfe2ce6e0); /* 58 */
+        II(c, d, a, b, x[6], S43, 0xa3014314);  /* 59 */
+        II(b, c, d, a, x[13], S44, 0x4e0811a1); /* 60 */
+        II(a, b, c, d, x[4], S41, 0xf7537e82);  /* 61 */
+        II(d, a, b, c, x[11], S42, 0xbd3af235); /* 62 */
+        II(c, d, a, b, x[2], S43, 0x2ad7d2bb);  /* 63 */
+        II(b, c, d, a, x[9], S44, 0xeb86d391);  /* 64 */
+
+        a += aa;
+        b += bb;
+        c += cc;
+        d += dd;
+    }
+
+    state[0] = a;
+    state[1] = b;
+    state[2] = c;
+    state[3] = d;
 }
 
 /**************************************************************************************************/
@@ -220,7 +236,7 @@ void MD5Transform(std::uint32_t state[4], std::uint8_t block[64]) {
 /* Encodes input (std::uint32_t) into output (std::uint8_t). Assumes len is a multiple of 4.
  */
 
-void Encode(std::uint8_t* output, std::uint32_t* input, std::uint16_t len) {
+void Encode(std::uint8_t* output, const std::uint32_t* input, std::uint16_t len) {
     std::uint16_t i, j;
 
     for (i = 0, j = 0; j < len; i++, j += 4) {
@@ -233,17 +249,237 @@ void Encode(std::uint8_t* output, std::uint32_t* input, std::uint16_t len) {
 
 /**************************************************************************************************/
 
-/* Decodes input (std::uint8_t) into output (std::uint32_t). Assumes len is a multiple of 4.
- */
+/* Decodes the little endian std::uint32_t at input. Compilers turn this into a single load. */
 
-void Decode(std::uint32_t* output, std::uint8_t* input, std::uint16_t len) {
-    std::uint16_t i, j;
+std::uint32_t Decode(const std::uint8_t* input) {
+    return ((std::uint32_t)input[0]) | (((std::uint32_t)input[1]) << 8) |
+           (((std::uint32_t)input[2]) << 16) | (((std::uint32_t)input[3]) << 24);
+}
+
+/**************************************************************************************************/
 
-    for (i = 0, j = 0; j < len; i++, j += 4)
-        output[i] = ((std::uint32_t)input[j]) | (((std::uint32_t)input[j + 1]) << 8) |
-                    (((std::uint32_t)input[j + 2]) << 16) | (((std::uint32_t)input[j + 3]) << 24);
+const std::uint8_t padding_s[64] = {0x80};
+
+/**************************************************************************************************/
+
+#if ADOBE_SHA_X86
+
+/**************************************************************************************************/
+
+/*
+    The MD5 rounds on eight messages at once, one in each 32 bit lane of the AVX2 registers. Each
+    step is the scalar one with the shift amount s, constant k, and the word x of the block.
+*/
+
+const std::uint32_t md5_k[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+const int md5_s[4][4] = {
+    {S11, S12, S13, S14}, {S21, S22, S23, S24}, {S31, S32, S33, S34}, {S41, S42, S43, S44}};
+
+template <int Round>
+ADOBE_SHA_X86_TARGET("avx2")
+inline void md5_avx2_round(__m256i& a, __m256i& b, __m256i& c, __m256i& d, const __m256i* x) {
+    using namespace implementation;
+
+    for (std::size_t t(16 * Round); t != 16 * Round + 16; ++t) {
+        __m256i f;
+        std::size_t g;
+
+        if constexpr (Round == 0) {
+            f = sha_avx2_xor(d, _mm256_and_si256(b, sha_avx2_xor(c, d)));
+            g = t;
+        } else if constexpr (Round == 1) {
+            f = sha_avx2_xor(c, _mm256_and_si256(d, sha_avx2_xor(b, c)));
+            g = (5 * t + 1) & 15;
+        } else if constexpr (Round == 2) {
+            f = sha_avx2_xor(sha_avx2_xor(b, c), d);
+            g = (3 * t + 5) & 15;
+        } else {
+            f = sha_avx2_xor(c, _mm256_or_si256(b, sha_avx2_xor(d, _mm256_set1_epi32(-1))));
+            g = (7 * t) & 15;
+        }
+
+        const __m256i sum(sha_avx2_add(
+            sha_avx2_add(a, f),
+            sha_avx2_add(x[g], _mm256_set1_epi32(static_cast<int>(md5_k[t])))));
+        const int s(md5_s[Round][t & 3]);
+        const __m256i rotated(_mm256_or_si256(_mm256_sll_epi32(sum, _mm_cvtsi32_si128(s)),
+                                              _mm256_srl_epi32(sum, _mm_cvtsi32_si128(32 - s))));
+
+        a = d;
+        d = c;
+        c = b;
+        b = sha_avx2_add(b, rotated);
+    }
 }
 
+/*
+    Digests one 64 byte block of each of eight messages. state[i][lane] is word i of the MD5
+    state of the lane's message, p[lane] its block.
+*/
+ADOBE_SHA_X86_TARGET("avx2")
+void md5_avx2_digest_lanes(std::uint32_t (*state)[8], const std::uint8_t* const* p) {
+    using namespace implementation;
+
+    __m256i x[16];
+
+    for (std::size_t half(0); half != 2; ++half) {
+        for (std::size_t lane(0); lane != 8; ++lane) {
+            x[half * 8 + lane] =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p[lane] + half * 32));
+        }
+        sha_avx2_transpose(x + half * 8);
+    }
+
+    __m256i a(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[0])));
+    __m256i b(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[1])));
+    __m256i c(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[2])));
+    __m256i d(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[3])));
+    const __m256i aa(a), bb(b), cc(c), dd(d);
+
+    md5_avx2_round<0>(a, b, c, d, x);
+    md5_avx2_round<1>(a, b, c, d, x);
+    md5_avx2_round<2>(a, b, c, d, x);
+    md5_avx2_round<3>(a, b, c, d, x);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[0]), sha_avx2_add(a, aa));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[1]), sha_avx2_add(b, bb));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[2]), sha_avx2_add(c, cc));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[3]), sha_avx2_add(d, dd));
+}
+
+/**************************************************************************************************/
+
+/*
+    Multi-buffer digest of count messages, eight lanes at a time. The final block(s) of each
+    message, with the padding and the length, are prepared up front in the lane's tail buffer.
+    When a lane finishes its message it picks up the next one; a lone message left at the end is
+    finished with the scalar transform.
+*/
+void md5_digest_lanes(const std::uint8_t* const* data, const std::size_t* size, std::size_t count,
+                      md5_t::digest_t* result) {
+    struct lane_t {
+        const std::uint8_t* data_m; // the next block to digest
+        std::size_t blocks_m;       // the blocks left at data_m
+        std::size_t tail_blocks_m;  // the blocks in tail_m, once data_m is done
+        std::size_t index_m;        // of the message
+        std::uint8_t tail_m[128];
+    };
+
+    std::uint32_t state[4][8];
+    lane_t lanes[8] = {};
+    const std::uint8_t* blocks[8];
+    std::size_t next(0);
+    std::size_t active(0);
+
+    auto start = [&](lane_t& lane, std::size_t n) {
+        if (next == count) {
+            lane.blocks_m = 0;
+            return;
+        }
+
+        const std::uint64_t length(size[next]);
+        const std::size_t remainder(static_cast<std::size_t>(length % 64));
+
+        std::memset(lane.tail_m, 0, sizeof(lane.tail_m));
+        if (remainder)
+            std::memcpy(lane.tail_m, data[next] + (length - remainder), remainder);
+        lane.tail_m[remainder] = 0x80;
+
+        lane.tail_blocks_m = remainder < 56 ? 1 : 2;
+
+        std::uint8_t* bits(lane.tail_m + lane.tail_blocks_m * 64 - 8);
+        for (std::uint64_t x(length << 3); x != 0; x >>= 8)
+            *bits++ = static_cast<std::uint8_t>(x);
+
+        lane.data_m = data[next];
+        lane.blocks_m = static_cast<std::size_t>(length / 64);
+        if (lane.blocks_m == 0) {
+            lane.data_m = lane.tail_m;
+            lane.blocks_m = lane.tail_blocks_m;
+            lane.tail_blocks_m = 0;
+        }
+        lane.index_m = next++;
+
+        state[0][n] = 0x67452301;
+        state[1][n] = 0xefcdab89;
+        state[2][n] = 0x98badcfe;
+        state[3][n] = 0x10325476;
+
+        ++active;
+    };
+
+    auto finish = [&](const std::uint32_t digest[4], std::size_t i) {
+        Encode(&result[i][0], digest, 16);
+    };
+
+    for (std::size_t n(0); n != 8; ++n)
+        start(lanes[n], n);
+
+    while (active != 0) {
+        if (active == 1 && next == count) {
+            for (std::size_t n(0); n != 8; ++n) {
+                lane_t& lane(lanes[n]);
+
+                if (lane.blocks_m == 0)
+                    continue;
+
+                std::uint32_t digest[4] = {state[0][n], state[1][n], state[2][n], state[3][n]};
+
+                MD5Transform(digest, lane.data_m, lane.blocks_m);
+                if (lane.tail_blocks_m)
+                    MD5Transform(digest, lane.tail_m, lane.tail_blocks_m);
+
+                finish(digest, lane.index_m);
+            }
+            break;
+        }
+
+        // Idle lanes digest their stale tail, the result is never used.
+        for (std::size_t n(0); n != 8; ++n)
+            blocks[n] = lanes[n].blocks_m ? lanes[n].data_m : lanes[n].tail_m;
+
+        md5_avx2_digest_lanes(state, blocks);
+
+        for (std::size_t n(0); n != 8; ++n) {
+            lane_t& lane(lanes[n]);
+
+            if (lane.blocks_m == 0)
+                continue;
+
+            lane.data_m += 64;
+
+            if (--lane.blocks_m != 0)
+                continue;
+
+            if (lane.tail_blocks_m) {
+                lane.data_m = lane.tail_m;
+                lane.blocks_m = lane.tail_blocks_m;
+                lane.tail_blocks_m = 0;
+                continue;
+            }
+
+            const std::uint32_t digest[4] = {state[0][n], state[1][n], state[2][n], state[3][n]};
+
+            finish(digest, lane.index_m);
+            --active;
+            start(lane, n);
+        }
+    }
+}
+
+/**************************************************************************************************/
+
+#endif
+
 /**************************************************************************************************/
 
 } // namespace
@@ -275,7 +511,8 @@ void md5_t::reset() {
     processing another message block, and updating the context.
 */
 
-void md5_t::update(void* input_block, std::size_t input_length) {
+void md5_t::update(const void* input_block, std::size_t input_length) {
+    const std::uint8_t* input(static_cast<const std::uint8_t*>(input_block));
 
     /* Compute number of bytes mod 64 */
     std::size_t index((count_m[0] >> 3) & 0x3f);
@@ -287,23 +524,28 @@ void md5_t::update(void* input_block, std::size_t input_length) {
     count_m[1] += count_m[0] < lsb_length;                        // add cary bit
     count_m[1] += static_cast<std::uint32_t>(input_length >> 29); // high order bits.
 
-    std::size_t partLen(64 - index);
-
-    /* Transform as many times as possible. */
-    std::size_t i(0);
+    /* Complete a buffered block first. */
+    if (index != 0) {
+        std::size_t partLen(64 - index);
 
-    if (input_length >= partLen) {
-        std::memcpy(&buffer_m[index], input_block, partLen);
-        MD5Transform(state_m, buffer_m);
+        if (input_length < partLen) {
+            std::memcpy(&buffer_m[index], input, input_length);
+            return;
+        }
 
-        for (i = partLen; i + 63 < input_length; i += 64)
-            MD5Transform(state_m, &static_cast<std::uint8_t*>(input_block)[i]);
+        std::memcpy(&buffer_m[index], input, partLen);
+        MD5Transform(state_m, buffer_m, 1);
 
-        index = 0;
+        input += partLen;
+        input_length -= partLen;
     }
 
+    /* Transform the whole blocks in place. */
+    MD5Transform(state_m, input, input_length / 64);
+
     /* Buffer remaining input */
-    std::memcpy(&buffer_m[index], &static_cast<std::uint8_t*>(input_block)[i], input_length - i);
+    if (input_length % 64)
+        std::memcpy(buffer_m, input + (input_length - input_length % 64), input_length % 64);
 }
 
 /**************************************************************************************************/
@@ -314,11 +556,6 @@ void md5_t::update(void* input_block, std::size_t input_length) {
 */
 
 md5_t::digest_t md5_t::final() {
-    static std::uint8_t padding_s[64] = {0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                         0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                         0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                         0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
     digest_t digest;
 
     std::uint8_t bits[8];
@@ -346,6 +583,23 @@ md5_t::digest_t md5_t::final() {
 
 /**************************************************************************************************/
 
+void md5_t::digest_batch(const std::uint8_t* const* data, const std::size_t* size,
+                         std::size_t count, digest_t* result) {
+#if ADOBE_SHA_X86
+    if (count > 1 && implementation::sha_x86_features().avx2_m)
+        return md5_digest_lanes(data, size, count, result);
+#endif
+
+    for (std::size_t i(0); i != count; ++i) {
+        md5_t m;
+
+        m.update(data[i], size[i]);
+        result[i] = m.final();
+    }
+}
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
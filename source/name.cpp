@@ -31,6 +31,21 @@ struct str_name_hash {
 
 /**************************************************************************************************/
 
+struct name_cache_t {
+    static constexpr std::size_t size_k = 1024;
+
+    struct entry_t {
+        std::size_t hash_m{0};
+        const char* str_m{nullptr};
+    };
+
+    entry_t& operator[](std::size_t index) { return table_m[index]; }
+
+    entry_t table_m[size_k];
+};
+
+/**************************************************************************************************/
+
 } // namespace
 
 /**************************************************************************************************/
@@ -55,10 +70,6 @@ const char* name_t::map_string(const char* str) {
     if (!str || !*str)
         return map_string(detail::empty_string_s(), empty_hash_s, true);
 
-    // Revisit, fnv1a is in main but not constexpr???
-
-    // Once fnv1a is in main we can make the hash faster
-    // with a call to the sentinel variant.
     std::size_t hash(detail::name_hash(str, std::strlen(str)));
 
     return map_string(str, hash, false);
@@ -68,7 +79,25 @@ const char* name_t::map_string(const char* str) {
 
 const char* name_t::map_string(const char* str, std::size_t hash, bool is_static) {
     static adobe::unique_string_pool_t pool_s;
-    return pool_s.add(str, hash, is_static);
+
+    /*
+        Pooled strings are never released, so each thread keeps a small direct-mapped cache of
+        recently mapped names. Parsers and the VM map the same few names over and over; a hit
+        never touches the shared pool or its locks.
+    */
+    thread_local name_cache_t cache_s;
+
+    name_cache_t::entry_t& entry(cache_s[hash % name_cache_t::size_k]);
+
+    if (entry.str_m && entry.hash_m == hash && std::strcmp(entry.str_m, str) == 0)
+        return entry.str_m;
+
+    const char* result(pool_s.add(str, hash, is_static));
+
+    entry.hash_m = hash;
+    entry.str_m = result;
+
+    return result;
 }
 
 /**************************************************************************************************/
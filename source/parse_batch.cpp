@@ -0,0 +1,341 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/parse_batch.hpp>
+
+#include <any>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <adobe/future.hpp>
+
+/**************************************************************************************************/
+
+using namespace std;
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+using namespace adobe;
+
+/**************************************************************************************************/
+
+/*
+    The position handed to the parser for a recorded view, the index of its call in the record.
+*/
+struct recorded_view_t {
+    size_t index_m;
+};
+
+/**************************************************************************************************/
+
+adam_callback_suite_t recording_callbacks(adam_parse_record_t& record) {
+    using record_t = adam_parse_record_t;
+    using suite_t = adam_callback_suite_t;
+
+    auto& calls(record.calls_m);
+    suite_t result;
+
+    result.add_cell_proc_m = [&calls](suite_t::cell_type_t type, name_t cell_name,
+                                      const line_position_t& position, const array_t& expr_or_init,
+                                      const string& brief, const string& detailed) {
+        calls.push_back(record_t::cell_t{type, cell_name, position, expr_or_init, brief, detailed});
+    };
+
+    result.add_relation_proc_m = [&calls](const line_position_t& position,
+                                          const array_t& conditional,
+                                          const suite_t::relation_t* first,
+                                          const suite_t::relation_t* last, const string& brief,
+                                          const string& detailed) {
+        calls.push_back(
+            record_t::relation_t{position, conditional, {first, last}, brief, detailed});
+    };
+
+    result.add_interface_proc_m = [&calls](name_t cell_name, bool linked,
+                                           const line_position_t& position1,
+                                           const array_t& initializer,
+                                           const line_position_t& position2,
+                                           const array_t& expression, const string& brief,
+                                           const string& detailed) {
+        calls.push_back(record_t::interface_t{cell_name, linked, position1, initializer, position2,
+                                              expression, brief, detailed});
+    };
+
+    result.add_external_proc_m = [&calls](name_t cell_name, const line_position_t& position,
+                                          const string& brief, const string& detailed) {
+        calls.push_back(record_t::external_t{cell_name, position, brief, detailed});
+    };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+eve_callback_suite_t recording_callbacks(eve_parse_record_t& record) {
+    using record_t = eve_parse_record_t;
+    using suite_t = eve_callback_suite_t;
+    using position_t = suite_t::position_t;
+
+    auto& calls(record.calls_m);
+    suite_t result;
+
+    result.add_view_proc_m = [&calls](const position_t& parent,
+                                      const line_position_t& parse_location, name_t name,
+                                      const array_t& parameters, const string& brief,
+                                      const string& detailed) {
+        size_t index(calls.size());
+
+        calls.push_back(record_t::view_t{any_cast<recorded_view_t>(parent).index_m,
+                                         parse_location, name, parameters, brief, detailed});
+
+        return position_t(recorded_view_t{index});
+    };
+
+    result.add_cell_proc_m = [&calls](suite_t::cell_type_t type, name_t cell_name,
+                                      const line_position_t& position, const array_t& initializer,
+                                      const string& brief, const string& detailed) {
+        calls.push_back(record_t::cell_t{type, cell_name, position, initializer, brief, detailed});
+    };
+
+    result.add_relation_proc_m = [&calls](const line_position_t& position,
+                                          const array_t& conditional,
+                                          const suite_t::relation_t* first,
+                                          const suite_t::relation_t* last, const string& brief,
+                                          const string& detailed) {
+        calls.push_back(
+            record_t::relation_t{position, conditional, {first, last}, brief, detailed});
+    };
+
+    result.add_interface_proc_m = [&calls](name_t cell_name, bool linked,
+                                           const line_position_t& position1,
+                                           const array_t& initializer,
+                                           const line_position_t& position2,
+                                           const array_t& expression, const string& brief,
+                                           const string& detailed) {
+        calls.push_back(record_t::interface_t{cell_name, linked, position1, initializer, position2,
+                                              expression, brief, detailed});
+    };
+
+    result.finalize_sheet_proc_m = [&calls] { calls.push_back(record_t::finalize_t{}); };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+template <typename F>
+void record_parse(adam_parse_record_t& record, const F& parse) {
+    try {
+        parse(recording_callbacks(record));
+    } catch (...) {
+        record.error_m = current_exception();
+    }
+}
+
+template <typename F>
+void record_parse(eve_parse_record_t& record, const F& parse) {
+    try {
+        record.end_position_m = parse(eve_callback_suite_t::position_t(recorded_view_t{
+                                          eve_parse_record_t::root_view_k}),
+                                      recording_callbacks(record));
+    } catch (...) {
+        record.error_m = current_exception();
+    }
+}
+
+/**************************************************************************************************/
+
+/*
+    Errors thrown by the client during replay are reported at the position of the call, as the
+    parser would have reported them.
+*/
+template <typename F>
+void report(const line_position_t& position, F&& f) {
+    try {
+        std::forward<F>(f)();
+    } catch (const stream_error_t&) {
+        throw;
+    } catch (const exception& error) {
+        throw stream_error_t(error, position);
+    }
+}
+
+/**************************************************************************************************/
+
+template <class... Fs>
+struct overloaded : Fs... {
+    using Fs::operator()...;
+};
+
+template <class... Fs>
+overloaded(Fs...) -> overloaded<Fs...>;
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+void adam_parse_record_t::replay(const adam_callback_suite_t& callbacks) const {
+    for (const auto& call : calls_m) {
+        visit(overloaded{
+                  [&](const cell_t& x) {
+                      report(x.position_m, [&] {
+                          callbacks.add_cell_proc_m(x.type_m, x.name_m, x.position_m,
+                                                    x.expression_m, x.brief_m, x.detailed_m);
+                      });
+                  },
+                  [&](const relation_t& x) {
+                      report(x.position_m, [&] {
+                          callbacks.add_relation_proc_m(
+                              x.position_m, x.conditional_m, x.relations_m.data(),
+                              x.relations_m.data() + x.relations_m.size(), x.brief_m,
+                              x.detailed_m);
+                      });
+                  },
+                  [&](const interface_t& x) {
+                      report(x.initializer_position_m, [&] {
+                          callbacks.add_interface_proc_m(x.name_m, x.linked_m,
+                                                         x.initializer_position_m, x.initializer_m,
+                                                         x.expression_position_m, x.expression_m,
+                                                         x.brief_m, x.detailed_m);
+                      });
+                  },
+                  [&](const external_t& x) {
+                      report(x.position_m, [&] {
+                          callbacks.add_external_proc_m(x.name_m, x.position_m, x.brief_m,
+                                                        x.detailed_m);
+                      });
+                  },
+              },
+              call);
+    }
+
+    if (error_m)
+        rethrow_exception(error_m);
+}
+
+/**************************************************************************************************/
+
+line_position_t eve_parse_record_t::replay(const eve_callback_suite_t::position_t& position,
+                                           const eve_callback_suite_t& callbacks) const {
+    // The position returned for each view, indexed by the view's call.
+    vector<eve_callback_suite_t::position_t> views(calls_m.size());
+
+    for (size_t i = 0; i != calls_m.size(); ++i) {
+        visit(overloaded{
+                  [&](const view_t& x) {
+                      report(x.position_m, [&] {
+                          views[i] = callbacks.add_view_proc_m(
+                              x.parent_m == root_view_k ? position : views[x.parent_m],
+                              x.position_m, x.name_m, x.parameters_m, x.brief_m, x.detailed_m);
+                      });
+                  },
+                  [&](const cell_t& x) {
+                      report(x.position_m, [&] {
+                          callbacks.add_cell_proc_m(x.type_m, x.name_m, x.position_m,
+                                                    x.initializer_m, x.brief_m, x.detailed_m);
+                      });
+                  },
+                  [&](const relation_t& x) {
+                      report(x.position_m, [&] {
+                          callbacks.add_relation_proc_m(
+                              x.position_m, x.conditional_m, x.relations_m.data(),
+                              x.relations_m.data() + x.relations_m.size(), x.brief_m,
+                              x.detailed_m);
+                      });
+                  },
+                  [&](const interface_t& x) {
+                      report(x.initializer_position_m, [&] {
+                          callbacks.add_interface_proc_m(x.name_m, x.linked_m,
+                                                         x.initializer_position_m, x.initializer_m,
+                                                         x.expression_position_m, x.expression_m,
+                                                         x.brief_m, x.detailed_m);
+                      });
+                  },
+                  [&](const finalize_t&) {
+                      if (callbacks.finalize_sheet_proc_m)
+                          report(end_position_m, callbacks.finalize_sheet_proc_m);
+                  },
+              },
+              calls_m[i]);
+    }
+
+    if (error_m)
+        rethrow_exception(error_m);
+
+    return end_position_m;
+}
+
+/**************************************************************************************************/
+
+adam_parse_record_t parse_adam_record(const parse_source_t& source) {
+    adam_parse_record_t result;
+    record_parse(result, [&](const adam_callback_suite_t& callbacks) {
+        parse(source.text_m, source.position_m, callbacks);
+    });
+    return result;
+}
+
+eve_parse_record_t parse_eve_record(const parse_source_t& source) {
+    eve_parse_record_t result;
+    record_parse(result, [&](const any& root, const eve_callback_suite_t& callbacks) {
+        return parse(source.text_m, source.position_m, root, callbacks);
+    });
+    return result;
+}
+
+/**************************************************************************************************/
+
+vector<adam_parse_record_t> parse_adam_batch(const vector<parse_source_t>& sources) {
+    vector<adam_parse_record_t> result(sources.size());
+    for_each_async(sources.size(), [&](size_t i) { result[i] = parse_adam_record(sources[i]); });
+    return result;
+}
+
+vector<adam_parse_record_t> parse_adam_batch(const vector<filesystem::path>& paths) {
+    vector<adam_parse_record_t> result(paths.size());
+    for_each_async(paths.size(), [&](size_t i) {
+        record_parse(result[i], [&](const adam_callback_suite_t& callbacks) {
+            parse_file(paths[i], callbacks);
+        });
+    });
+    return result;
+}
+
+/**************************************************************************************************/
+
+vector<eve_parse_record_t> parse_eve_batch(const vector<parse_source_t>& sources) {
+    vector<eve_parse_record_t> result(sources.size());
+    for_each_async(sources.size(), [&](size_t i) { result[i] = parse_eve_record(sources[i]); });
+    return result;
+}
+
+vector<eve_parse_record_t> parse_eve_batch(const vector<filesystem::path>& paths) {
+    vector<eve_parse_record_t> result(paths.size());
+    for_each_async(paths.size(), [&](size_t i) {
+        record_parse(result[i], [&](const any& root, const eve_callback_suite_t& callbacks) {
+            return parse_file(paths[i], root, callbacks);
+        });
+    });
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
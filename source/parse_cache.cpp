@@ -0,0 +1,746 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/parse_cache.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include <adobe/any_regular.hpp>
+#include <adobe/array.hpp>
+#include <adobe/dictionary.hpp>
+#include <adobe/empty.hpp>
+#include <adobe/future.hpp>
+#include <adobe/mapped_file.hpp>
+#include <adobe/name.hpp>
+
+/**************************************************************************************************/
+
+using namespace std;
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+using namespace adobe;
+
+/**************************************************************************************************/
+
+/*
+    Image layout, all integers in native byte order:
+
+        header_t
+        name table: name_count_m x (u32 length, bytes)
+        body:       u32 call count, then each call as a u8 variant index followed by its fields
+
+    Values are a u8 value_tag_t followed by the value. The byte order mark rejects images written
+    on a machine of the other endianness.
+*/
+
+constexpr char image_magic_k[8] = {'A', 'S', 'L', 'P', 'A', 'R', 'S', 'E'};
+constexpr uint32_t image_version_k = 1;
+constexpr uint32_t byte_order_mark_k = 0x01020304;
+
+enum class image_kind_t : uint32_t { adam = 1, eve = 2 };
+
+struct header_t {
+    char magic_m[8];
+    uint32_t version_m;
+    uint32_t kind_m;
+    uint32_t byte_order_m;
+    uint32_t name_count_m;
+    uint64_t body_size_m;
+    parse_cache_key_t key_m;
+};
+
+enum class value_tag_t : uint8_t { empty, false_, true_, number, string, name, array, dictionary };
+
+/**************************************************************************************************/
+
+class image_writer_t {
+public:
+    void write_u8(uint8_t x) { body_m.push_back(static_cast<char>(x)); }
+    void write_u32(uint32_t x) { append(&x, sizeof(x)); }
+    void write_u64(uint64_t x) { append(&x, sizeof(x)); }
+
+    void write(bool x) { write_u8(x); }
+
+    void write(const string& x) {
+        write_u32(static_cast<uint32_t>(x.size()));
+        append(x.data(), x.size());
+    }
+
+    void write(name_t x) {
+        auto inserted(index_m.emplace(x, static_cast<uint32_t>(names_m.size())));
+        if (inserted.second)
+            names_m.push_back(x);
+        write_u32(inserted.first->second);
+    }
+
+    void write(const line_position_t& x) {
+        write(name_t(x.stream_name()));
+        write_u32(static_cast<uint32_t>(x.line_number_m));
+        write_u64(static_cast<uint64_t>(static_cast<streamoff>(x.line_start_m)));
+        write_u64(static_cast<uint64_t>(static_cast<streamoff>(x.position_m)));
+    }
+
+    void write(const array_t& x) {
+        write_u32(static_cast<uint32_t>(x.size()));
+        for (const auto& e : x)
+            write(e);
+    }
+
+    void write(const dictionary_t& x) {
+        write_u32(static_cast<uint32_t>(x.size()));
+        for (const auto& e : x) {
+            write(e.first);
+            write(e.second);
+        }
+    }
+
+    void write(const any_regular_t& x) {
+        const type_info& type(x.type_info());
+
+        if (type == typeid(empty_t)) {
+            write_u8(uint8_t(value_tag_t::empty));
+        } else if (type == typeid(bool)) {
+            write_u8(uint8_t(x.cast<bool>() ? value_tag_t::true_ : value_tag_t::false_));
+        } else if (type == typeid(double)) {
+            double value(x.cast<double>());
+            write_u8(uint8_t(value_tag_t::number));
+            append(&value, sizeof(value));
+        } else if (type == typeid(string)) {
+            write_u8(uint8_t(value_tag_t::string));
+            write(x.cast<string>());
+        } else if (type == typeid(name_t)) {
+            write_u8(uint8_t(value_tag_t::name));
+            write(x.cast<name_t>());
+        } else if (type == typeid(array_t)) {
+            write_u8(uint8_t(value_tag_t::array));
+            write(x.cast<array_t>());
+        } else if (type == typeid(dictionary_t)) {
+            write_u8(uint8_t(value_tag_t::dictionary));
+            write(x.cast<dictionary_t>());
+        } else {
+            throw invalid_argument(string("parse image: cannot store value of type ") +
+                                   type.name());
+        }
+    }
+
+    template <typename Relation>
+    void write(const vector<Relation>& x) {
+        write_u32(static_cast<uint32_t>(x.size()));
+        for (const auto& e : x) {
+            write_u32(static_cast<uint32_t>(e.name_set_m.size()));
+            for (name_t name : e.name_set_m)
+                write(name);
+            write(e.position_m);
+            write(e.expression_m);
+            write(e.detailed_m);
+            write(e.brief_m);
+        }
+    }
+
+    template <typename... Args>
+    void write_all(const Args&... args) {
+        (write(args), ...);
+    }
+
+    string finish(image_kind_t kind, const parse_cache_key_t& key) const {
+        header_t header;
+        memcpy(header.magic_m, image_magic_k, sizeof(image_magic_k));
+        header.version_m = image_version_k;
+        header.kind_m = uint32_t(kind);
+        header.byte_order_m = byte_order_mark_k;
+        header.name_count_m = static_cast<uint32_t>(names_m.size());
+        header.body_size_m = body_m.size();
+        header.key_m = key;
+
+        string result(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (name_t name : names_m) {
+            const uint32_t size(static_cast<uint32_t>(strlen(name.c_str())));
+            result.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            result.append(name.c_str(), size);
+        }
+
+        return result += body_m;
+    }
+
+private:
+    void append(const void* data, size_t size) {
+        body_m.append(static_cast<const char*>(data), size);
+    }
+
+    string body_m;
+    vector<name_t> names_m;
+    unordered_map<name_t, uint32_t> index_m;
+};
+
+/**************************************************************************************************/
+
+struct image_error_t {};
+
+class image_reader_t {
+public:
+    /*
+        Validates the header and reads the name table. Returns false if the image is not of the
+        given kind and key.
+    */
+    bool open(string_view image, image_kind_t kind, const parse_cache_key_t& key) {
+        first_m = image.data();
+        last_m = first_m + image.size();
+
+        header_t header;
+        read_raw(&header, sizeof(header));
+
+        if (memcmp(header.magic_m, image_magic_k, sizeof(image_magic_k)) != 0 ||
+            header.version_m != image_version_k || header.kind_m != uint32_t(kind) ||
+            header.byte_order_m != byte_order_mark_k || header.key_m != key)
+            return false;
+
+        names_m.reserve(header.name_count_m);
+
+        for (uint32_t n = 0; n != header.name_count_m; ++n) {
+            string_view text(read_text());
+            // The name pool requires a null terminated string.
+            names_m.emplace_back(string(text).c_str());
+        }
+
+        return header.body_size_m == uint64_t(last_m - first_m);
+    }
+
+    bool at_end() const { return first_m == last_m; }
+
+    uint8_t read_u8() {
+        uint8_t result;
+        read_raw(&result, sizeof(result));
+        return result;
+    }
+
+    uint32_t read_u32() {
+        uint32_t result;
+        read_raw(&result, sizeof(result));
+        return result;
+    }
+
+    uint64_t read_u64() {
+        uint64_t result;
+        read_raw(&result, sizeof(result));
+        return result;
+    }
+
+    void read(bool& x) { x = read_u8() != 0; }
+
+    void read(string& x) { x = string(read_text()); }
+
+    void read(name_t& x) {
+        uint32_t index(read_u32());
+        if (index >= names_m.size())
+            throw image_error_t();
+        x = names_m[index];
+    }
+
+    void read(line_position_t& x) {
+        name_t file;
+        read(file);
+        int line_number(static_cast<int>(read_u32()));
+        streamoff line_start(static_cast<streamoff>(read_u64()));
+        streamoff position(static_cast<streamoff>(read_u64()));
+
+        x = line_position_t(file, line_position_t::getline_proc_t(), line_number, line_start,
+                            position);
+    }
+
+    void read(array_t& x) {
+        uint32_t count(read_count());
+        x.clear();
+        x.reserve(count);
+        for (uint32_t n = 0; n != count; ++n) {
+            x.emplace_back();
+            read(x.back());
+        }
+    }
+
+    void read(dictionary_t& x) {
+        uint32_t count(read_count());
+        x.clear();
+        for (uint32_t n = 0; n != count; ++n) {
+            name_t key;
+            read(key);
+            read(x[key]);
+        }
+    }
+
+    void read(any_regular_t& x) {
+        switch (value_tag_t(read_u8())) {
+        case value_tag_t::empty:
+            x = any_regular_t(empty_t());
+            break;
+        case value_tag_t::false_:
+            x = any_regular_t(false);
+            break;
+        case value_tag_t::true_:
+            x = any_regular_t(true);
+            break;
+        case value_tag_t::number: {
+            double value;
+            read_raw(&value, sizeof(value));
+            x = any_regular_t(value);
+        } break;
+        case value_tag_t::string:
+            x = any_regular_t(string(read_text()));
+            break;
+        case value_tag_t::name: {
+            name_t value;
+            read(value);
+            x = any_regular_t(value);
+        } break;
+        case value_tag_t::array: {
+            array_t value;
+            read(value);
+            x = any_regular_t(std::move(value));
+        } break;
+        case value_tag_t::dictionary: {
+            dictionary_t value;
+            read(value);
+            x = any_regular_t(std::move(value));
+        } break;
+        default:
+            throw image_error_t();
+        }
+    }
+
+    template <typename Relation>
+    void read(vector<Relation>& x) {
+        x.resize(read_count());
+        for (auto& e : x) {
+            e.name_set_m.resize(read_count());
+            for (name_t& name : e.name_set_m)
+                read(name);
+            read(e.position_m);
+            read(e.expression_m);
+            read(e.detailed_m);
+            read(e.brief_m);
+        }
+    }
+
+    template <typename... Args>
+    void read_all(Args&... args) {
+        (read(args), ...);
+    }
+
+    /*
+        Reads an element count. Every element takes at least one byte, so a count larger than the
+        rest of the image is corrupt and would otherwise cause a huge allocation.
+    */
+    uint32_t read_count() {
+        uint32_t result(read_u32());
+        if (result > size_t(last_m - first_m))
+            throw image_error_t();
+        return result;
+    }
+
+private:
+    void read_raw(void* x, size_t size) {
+        if (size > size_t(last_m - first_m))
+            throw image_error_t();
+        memcpy(x, first_m, size);
+        first_m += size;
+    }
+
+    string_view read_text() {
+        uint32_t size(read_u32());
+        if (size > size_t(last_m - first_m))
+            throw image_error_t();
+        string_view result(first_m, size);
+        first_m += size;
+        return result;
+    }
+
+    const char* first_m{nullptr};
+    const char* last_m{nullptr};
+    vector<name_t> names_m;
+};
+
+/**************************************************************************************************/
+
+template <class... Fs>
+struct overloaded : Fs... {
+    using Fs::operator()...;
+};
+
+template <class... Fs>
+overloaded(Fs...) -> overloaded<Fs...>;
+
+/**************************************************************************************************/
+
+/*
+    Each call is written as the index of its alternative followed by its fields, and read back
+    into a default constructed alternative of that index.
+*/
+
+template <typename Record>
+struct call_codec;
+
+template <>
+struct call_codec<adam_parse_record_t> {
+    using record_t = adam_parse_record_t;
+
+    static constexpr image_kind_t kind_k = image_kind_t::adam;
+
+    static void write(image_writer_t& out, const record_t::call_t& call) {
+        out.write_u8(static_cast<uint8_t>(call.index()));
+        visit(overloaded{
+                  [&](const record_t::cell_t& x) {
+                      out.write_u8(static_cast<uint8_t>(x.type_m));
+                      out.write_all(x.name_m, x.position_m, x.expression_m, x.brief_m,
+                                    x.detailed_m);
+                  },
+                  [&](const record_t::relation_t& x) {
+                      out.write_all(x.position_m, x.conditional_m, x.relations_m, x.brief_m,
+                                    x.detailed_m);
+                  },
+                  [&](const record_t::interface_t& x) {
+                      out.write_all(x.name_m, x.linked_m, x.initializer_position_m,
+                                    x.initializer_m, x.expression_position_m, x.expression_m,
+                                    x.brief_m, x.detailed_m);
+                  },
+                  [&](const record_t::external_t& x) {
+                      out.write_all(x.name_m, x.position_m, x.brief_m, x.detailed_m);
+                  },
+              },
+              call);
+    }
+
+    static void read(image_reader_t& in, record_t::call_t& call) {
+        switch (in.read_u8()) {
+        case 0: {
+            record_t::cell_t x;
+            x.type_m = static_cast<adam_callback_suite_t::cell_type_t>(in.read_u8());
+            in.read_all(x.name_m, x.position_m, x.expression_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 1: {
+            record_t::relation_t x;
+            in.read_all(x.position_m, x.conditional_m, x.relations_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 2: {
+            record_t::interface_t x;
+            in.read_all(x.name_m, x.linked_m, x.initializer_position_m, x.initializer_m,
+                        x.expression_position_m, x.expression_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 3: {
+            record_t::external_t x;
+            in.read_all(x.name_m, x.position_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        default:
+            throw image_error_t();
+        }
+    }
+
+    static void write_end(image_writer_t&, const record_t&) {}
+    static void read_end(image_reader_t&, record_t&) {}
+};
+
+template <>
+struct call_codec<eve_parse_record_t> {
+    using record_t = eve_parse_record_t;
+
+    static constexpr image_kind_t kind_k = image_kind_t::eve;
+
+    static void write(image_writer_t& out, const record_t::call_t& call) {
+        out.write_u8(static_cast<uint8_t>(call.index()));
+        visit(overloaded{
+                  [&](const record_t::view_t& x) {
+                      out.write_u64(x.parent_m);
+                      out.write_all(x.position_m, x.name_m, x.parameters_m, x.brief_m,
+                                    x.detailed_m);
+                  },
+                  [&](const record_t::cell_t& x) {
+                      out.write_u8(static_cast<uint8_t>(x.type_m));
+                      out.write_all(x.name_m, x.position_m, x.initializer_m, x.brief_m,
+                                    x.detailed_m);
+                  },
+                  [&](const record_t::relation_t& x) {
+                      out.write_all(x.position_m, x.conditional_m, x.relations_m, x.brief_m,
+                                    x.detailed_m);
+                  },
+                  [&](const record_t::interface_t& x) {
+                      out.write_all(x.name_m, x.linked_m, x.initializer_position_m,
+                                    x.initializer_m, x.expression_position_m, x.expression_m,
+                                    x.brief_m, x.detailed_m);
+                  },
+                  [&](const record_t::finalize_t&) {},
+              },
+              call);
+    }
+
+    static void read(image_reader_t& in, record_t::call_t& call) {
+        switch (in.read_u8()) {
+        case 0: {
+            record_t::view_t x;
+            x.parent_m = static_cast<size_t>(in.read_u64());
+            in.read_all(x.position_m, x.name_m, x.parameters_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 1: {
+            record_t::cell_t x;
+            x.type_m = static_cast<eve_callback_suite_t::cell_type_t>(in.read_u8());
+            in.read_all(x.name_m, x.position_m, x.initializer_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 2: {
+            record_t::relation_t x;
+            in.read_all(x.position_m, x.conditional_m, x.relations_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 3: {
+            record_t::interface_t x;
+            in.read_all(x.name_m, x.linked_m, x.initializer_position_m, x.initializer_m,
+                        x.expression_position_m, x.expression_m, x.brief_m, x.detailed_m);
+            call = std::move(x);
+        } break;
+        case 4:
+            call = record_t::finalize_t{};
+            break;
+        default:
+            throw image_error_t();
+        }
+    }
+
+    static void write_end(image_writer_t& out, const record_t& record) {
+        out.write(record.end_position_m);
+    }
+    static void read_end(image_reader_t& in, record_t& record) { in.read(record.end_position_m); }
+};
+
+/**************************************************************************************************/
+
+template <typename Record>
+string make_image(const Record& record, const parse_cache_key_t& key) {
+    using codec_t = call_codec<Record>;
+
+    if (record.failed())
+        throw invalid_argument("parse image: cannot store a failed parse");
+
+    image_writer_t out;
+    out.write_u32(static_cast<uint32_t>(record.calls_m.size()));
+    for (const auto& call : record.calls_m)
+        codec_t::write(out, call);
+    codec_t::write_end(out, record);
+
+    return out.finish(codec_t::kind_k, key);
+}
+
+template <typename Record>
+bool read_image(string_view image, const parse_cache_key_t& key, Record& result) {
+    using codec_t = call_codec<Record>;
+
+    try {
+        image_reader_t in;
+        if (!in.open(image, codec_t::kind_k, key))
+            return false;
+
+        result = Record();
+        result.calls_m.resize(in.read_count());
+        for (auto& call : result.calls_m)
+            codec_t::read(in, call);
+        codec_t::read_end(in, result);
+
+        return in.at_end();
+    } catch (const image_error_t&) {
+        return false;
+    }
+}
+
+/**************************************************************************************************/
+
+string to_hex(const parse_cache_key_t& key) {
+    constexpr char digits_k[] = "0123456789abcdef";
+    string result;
+
+    for (uint32_t word : key) {
+        for (int shift = 28; shift >= 0; shift -= 4)
+            result += digits_k[(word >> shift) & 0xF];
+    }
+
+    return result;
+}
+
+/*
+    A suffix for a temporary file, unique to one write: a random number drawn once for the
+    process, so that processes sharing a cache directory do not collide, and a count of the
+    writes made by this process.
+*/
+string temp_suffix() {
+    static const uint64_t process_s = [] {
+        random_device device;
+        return uint64_t(device()) << 32 | device();
+    }();
+    static atomic<uint64_t> count_s{0};
+
+    return "." + to_string(process_s) + "." + to_string(count_s++) + ".tmp";
+}
+
+/*
+    Images are written to a temporary file and renamed into place so a concurrent reader never
+    sees a partial image.
+*/
+void write_image_file(const filesystem::path& path, const string& image) {
+    filesystem::create_directories(path.parent_path());
+
+    filesystem::path temp(path);
+    temp += temp_suffix();
+
+    {
+        ofstream out(temp, ios::binary | ios::trunc);
+        out.write(image.data(), static_cast<streamsize>(image.size()));
+        if (!out)
+            throw system_error(make_error_code(errc::io_error), "parse cache: write failed");
+    }
+
+    filesystem::rename(temp, path);
+}
+
+/**************************************************************************************************/
+
+template <typename Record, typename Parse>
+Record parse_cached(const filesystem::path& path, const filesystem::path& cache_directory,
+                    const char* extension, const Parse& parse) {
+    mapped_file_t source(path);
+    const auto u8_name(path.u8string()); // std::u8string from C++20
+    const string stream_name(reinterpret_cast<const char*>(u8_name.c_str()));
+    const parse_cache_key_t key(parse_cache_key(stream_name, source.view()));
+    const filesystem::path image_path(cache_directory / (to_hex(key) + extension));
+
+    Record result;
+
+    error_code error;
+    if (filesystem::exists(image_path, error)) {
+        try {
+            mapped_file_t image(image_path);
+            if (read_image(image.view(), key, result))
+                return result;
+        } catch (const system_error&) {
+            // An unreadable image is treated as missing.
+        }
+    }
+
+    result = parse(parse_source_t{source.view(), line_position_t(stream_name.c_str())});
+
+    if (!result.failed()) {
+        try {
+            write_image_file(image_path, make_image(result, key));
+        } catch (const exception&) {
+            // The cache is an optimization, a record that cannot be stored is still returned.
+        }
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+parse_cache_key_t parse_cache_key(string_view stream_name, string_view source) {
+    sha256_t sha;
+    const char separator('\0');
+
+    sha.update(static_cast<const void*>(stream_name.data()), stream_name.size());
+    sha.update(static_cast<const void*>(&separator), 1);
+    sha.update(static_cast<const void*>(source.data()), source.size());
+
+    return sha.finalize();
+}
+
+/**************************************************************************************************/
+
+string make_parse_image(const adam_parse_record_t& record, const parse_cache_key_t& key) {
+    return make_image(record, key);
+}
+
+string make_parse_image(const eve_parse_record_t& record, const parse_cache_key_t& key) {
+    return make_image(record, key);
+}
+
+bool read_parse_image(string_view image, const parse_cache_key_t& key,
+                      adam_parse_record_t& result) {
+    return read_image(image, key, result);
+}
+
+bool read_parse_image(string_view image, const parse_cache_key_t& key,
+                      eve_parse_record_t& result) {
+    return read_image(image, key, result);
+}
+
+/**************************************************************************************************/
+
+adam_parse_record_t parse_adam_cached(const filesystem::path& path,
+                                      const filesystem::path& cache_directory) {
+    return parse_cached<adam_parse_record_t>(path, cache_directory, ".adm.bin",
+                                             &parse_adam_record);
+}
+
+eve_parse_record_t parse_eve_cached(const filesystem::path& path,
+                                    const filesystem::path& cache_directory) {
+    return parse_cached<eve_parse_record_t>(path, cache_directory, ".eve.bin", &parse_eve_record);
+}
+
+/**************************************************************************************************/
+
+vector<adam_parse_record_t> parse_adam_batch(const vector<filesystem::path>& paths,
+                                             const filesystem::path& cache_directory) {
+    vector<adam_parse_record_t> result(paths.size());
+    for_each_async(paths.size(), [&](size_t i) {
+        try {
+            result[i] = parse_adam_cached(paths[i], cache_directory);
+        } catch (...) {
+            result[i].error_m = current_exception();
+        }
+    });
+    return result;
+}
+
+vector<eve_parse_record_t> parse_eve_batch(const vector<filesystem::path>& paths,
+                                           const filesystem::path& cache_directory) {
+    vector<eve_parse_record_t> result(paths.size());
+    for_each_async(paths.size(), [&](size_t i) {
+        try {
+            result[i] = parse_eve_cached(paths[i], cache_directory);
+        } catch (...) {
+            result[i].error_m = current_exception();
+        }
+    });
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
@@ -0,0 +1,219 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/sha256_tree.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <adobe/cassert.hpp>
+#include <adobe/future.hpp>
+
+/**************************************************************************************************/
+
+using namespace std;
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+using namespace adobe;
+
+using digest_type = sha256_tree_t::digest_type;
+
+enum : uint8_t { leaf_tag_k = 0x00, node_tag_k = 0x01, tree_tag_k = 0x02 };
+
+/**************************************************************************************************/
+
+uint8_t* store_digest(const digest_type& digest, uint8_t* p) {
+    for (auto e : digest) {
+        implementation::store_big_endian(e, p);
+        p += sizeof(e);
+    }
+    return p;
+}
+
+digest_type node_digest(const digest_type& left, const digest_type& right) {
+    uint8_t buffer[1 + 2 * sizeof(digest_type)];
+
+    buffer[0] = node_tag_k;
+    store_digest(right, store_digest(left, buffer + 1));
+
+    sha256_t hash;
+    hash.update(static_cast<const void*>(buffer), sizeof(buffer));
+    return hash.finalize();
+}
+
+digest_type tree_digest(uint64_t size, size_t leaf_size, const digest_type& root) {
+    uint8_t buffer[1 + 2 * sizeof(uint64_t) + sizeof(digest_type)];
+
+    buffer[0] = tree_tag_k;
+    implementation::store_big_endian(size, buffer + 1);
+    implementation::store_big_endian(static_cast<uint64_t>(leaf_size), buffer + 9);
+    store_digest(root, buffer + 17);
+
+    sha256_t hash;
+    hash.update(static_cast<const void*>(buffer), sizeof(buffer));
+    return hash.finalize();
+}
+
+size_t count_leaves(uint64_t size, size_t leaf_size) {
+    return size == 0 ? 1 : static_cast<size_t>((size - 1) / leaf_size + 1);
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+sha256_tree_t::sha256_tree_t(size_t leaf_size) : leaf_size_m(leaf_size) {
+    ADOBE_ASSERT(leaf_size != 0 && "sha256_tree_t: leaf size must not be zero");
+
+    levels_m.emplace_back(1, leaf_digest(nullptr, 0));
+}
+
+/**************************************************************************************************/
+
+void sha256_tree_t::assign(const void* data, size_t size) {
+    const size_t count(count_leaves(size, leaf_size_m));
+    vector<digest_type> leaves(count);
+
+    const uint8_t* first(static_cast<const uint8_t*>(data));
+
+    for_each_async(count, [&](size_t i) {
+        const uint64_t offset(static_cast<uint64_t>(i) * leaf_size_m);
+        const size_t n(static_cast<size_t>(min<uint64_t>(leaf_size_m, size - offset)));
+
+        leaves[i] = leaf_digest(first + offset, n);
+    });
+
+    size_m = size;
+    levels_m.resize(1);
+    levels_m.front() = move(leaves);
+    build_nodes();
+}
+
+/**************************************************************************************************/
+
+void sha256_tree_t::build_nodes() {
+    while (levels_m.back().size() != 1) {
+        const vector<digest_type>& below(levels_m.back());
+        vector<digest_type> level((below.size() + 1) / 2);
+
+        for (size_t i(0); i != level.size(); ++i) {
+            level[i] = 2 * i + 1 == below.size() ? below[2 * i]
+                                                 : node_digest(below[2 * i], below[2 * i + 1]);
+        }
+
+        levels_m.push_back(move(level));
+    }
+}
+
+/**************************************************************************************************/
+
+sha256_tree_t::digest_type sha256_tree_t::digest() const {
+    return tree_digest(size_m, leaf_size_m, levels_m.back().front());
+}
+
+/**************************************************************************************************/
+
+bool sha256_tree_t::verify_leaf(size_t i, const void* data, size_t size) const {
+    return i < leaf_count() && leaf_digest(data, size) == leaf(i);
+}
+
+/**************************************************************************************************/
+
+void sha256_tree_t::update_leaf(size_t i, const void* data, size_t size) {
+    const size_t count(leaf_count());
+
+    if (i >= count)
+        throw out_of_range("sha256_tree_t: leaf index out of range");
+
+    const bool last(i + 1 == count);
+
+    if (last ? size > leaf_size_m || (size == 0 && count != 1) : size != leaf_size_m)
+        throw invalid_argument("sha256_tree_t: leaf size mismatch");
+
+    if (last)
+        size_m = static_cast<uint64_t>(i) * leaf_size_m + size;
+
+    levels_m.front()[i] = leaf_digest(data, size);
+
+    for (size_t n(1); n != levels_m.size(); ++n, i /= 2) {
+        const vector<digest_type>& below(levels_m[n - 1]);
+        const size_t left(i & ~size_t(1));
+
+        levels_m[n][i / 2] =
+            left + 1 == below.size() ? below[left] : node_digest(below[left], below[left + 1]);
+    }
+}
+
+/**************************************************************************************************/
+
+vector<sha256_tree_t::digest_type> sha256_tree_t::proof(size_t i) const {
+    vector<digest_type> result;
+
+    for (size_t n(0); n + 1 < levels_m.size(); ++n, i /= 2) {
+        if ((i ^ 1) < levels_m[n].size())
+            result.push_back(levels_m[n][i ^ 1]);
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+sha256_tree_t::digest_type sha256_tree_t::leaf_digest(const void* data, size_t size) {
+    const uint8_t tag(leaf_tag_k);
+    sha256_t hash;
+
+    hash.update(static_cast<const void*>(&tag), 1);
+    hash.update(data, size);
+    return hash.finalize();
+}
+
+/**************************************************************************************************/
+
+bool sha256_tree_t::verify_proof(const digest_type& digest, uint64_t size, size_t leaf_size,
+                                 size_t i, const digest_type& leaf,
+                                 const vector<digest_type>& proof) {
+    if (leaf_size == 0)
+        return false;
+
+    size_t count(count_leaves(size, leaf_size));
+
+    if (i >= count)
+        return false;
+
+    digest_type node(leaf);
+    auto sibling(proof.begin());
+
+    for (; count != 1; count = (count + 1) / 2, i /= 2) {
+        if ((i ^ 1) >= count)
+            continue; // carried up unchanged
+        if (sibling == proof.end())
+            return false;
+
+        node = i & 1 ? node_digest(*sibling, node) : node_digest(node, *sibling);
+        ++sibling;
+    }
+
+    return sibling == proof.end() && tree_digest(size, leaf_size, node) == digest;
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
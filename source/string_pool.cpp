@@ -23,11 +23,17 @@ namespace {
 
 /**************************************************************************************************/
 
-constexpr std::size_t empty_hash_s = adobe::detail::name_hash("");
+/*
+    The name_t hash is called directly, so it can be inlined into the probes; a hash function given
+    to the pool is called through its pointer.
+*/
+struct str_hash_t {
+    adobe::unique_string_pool_t::hash_function_t hash_m{nullptr}; // null for the name_t hash
 
-struct str_name_hash {
     std::size_t operator()(const char* str) const {
-        return adobe::detail::name_hash(str, std::strlen(str));
+        const std::size_t n(std::strlen(str));
+
+        return hash_m ? hash_m(str, n) : adobe::detail::name_hash(str, n);
     }
 };
 
@@ -96,12 +102,18 @@ namespace adobe {
 struct unique_string_pool_t::implementation_t {
 public:
     using lock_t = std::scoped_lock<std::mutex>;
-    using index_t = closed_hash_set<const char*, identity<>, str_name_hash, str_equal_to_t>;
+    using index_t = closed_hash_set<const char*, identity<>, str_hash_t, str_equal_to_t>;
 
-    implementation_t() {}
+    explicit implementation_t(str_hash_t hash) : hash_m(hash) {
+        for (auto& shard : _shards)
+            shard._index = index_t(0, hash);
+    }
 
     const char* add(const char* str) {
-        return add(str, adobe::detail::name_hash(str, std::strlen(str)), false);
+        if (!str || !*str)
+            return detail::empty_string_s();
+
+        return add(str, hash_m(str), false);
     }
 
     const char* add(const char* str, std::size_t hash, bool is_static) {
@@ -135,12 +147,16 @@ private:
         string_pool_t _pool;
     };
 
+    str_hash_t hash_m;
     shard _shards[shard_count];
 };
 
 /**************************************************************************************************/
 
-unique_string_pool_t::unique_string_pool_t() : object_m(new implementation_t()) {}
+unique_string_pool_t::unique_string_pool_t() : object_m(new implementation_t(str_hash_t())) {}
+
+unique_string_pool_t::unique_string_pool_t(hash_function_t hash)
+    : object_m(new implementation_t(str_hash_t{hash})) {}
 
 unique_string_pool_t::~unique_string_pool_t() { delete object_m; }
 
@@ -26,7 +26,7 @@
 #include <adobe/implementation/token.hpp>
 #include <adobe/localization.hpp>
 #include <adobe/name.hpp>
-#include <adobe/once.hpp>
+#include <adobe/static_hash_table.hpp>
 #include <adobe/static_table.hpp>
 #include <adobe/string.hpp>
 #include <adobe/virtual_machine.hpp>
@@ -82,14 +82,11 @@ using namespace adobe::literals;
 using stack_type = vector<adobe::any_regular_t>; // REVISIT (sparent) : GCC 3.1 the symbol `stack_t`
                                                  // conflicts with a symbol in signal.h
 using operator_t = void (adobe::virtual_machine_t::implementation_t::*)();
-using array_function_t = std::function<adobe::any_regular_t(const adobe::array_t&)>;
-using dictionary_function_t = std::function<adobe::any_regular_t(const adobe::dictionary_t&)>;
+using array_function_t = adobe::any_regular_t (*)(const adobe::array_t&);
+using dictionary_function_t = adobe::any_regular_t (*)(const adobe::dictionary_t&);
 
 #if !defined(ADOBE_NO_DOCUMENTATION)
 
-using operator_table_t = adobe::static_table<adobe::name_t, operator_t, 27>;
-using array_function_table_t = adobe::static_table<adobe::name_t, array_function_t, 7>;
-using dictionary_function_table_t = adobe::static_table<adobe::name_t, dictionary_function_t, 1>;
 using type_table_t = adobe::static_table<const std::type_info*, adobe::name_t, 7>;
 
 #endif // !defined(ADOBE_NO_DOCUMENTATION)
@@ -142,8 +139,7 @@ adobe::name_t type_name(const adobe::any_regular_t& val) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t xml_escape_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t xml_escape_function(const adobe::array_t& parameters) {
     if (parameters.size() != 1 || parameters[0].type_info() != typeid(string))
         throw std::runtime_error("xml_escape: parameter error");
 
@@ -152,8 +148,7 @@ adobe::any_regular_t xml_escape_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t xml_unescape_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t xml_unescape_function(const adobe::array_t& parameters) {
     if (parameters.size() != 1 || parameters[0].type_info() != typeid(string))
         throw std::runtime_error("xml_unescape: parameter error");
 
@@ -162,8 +157,7 @@ adobe::any_regular_t xml_unescape_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t localize_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t localize_function(const adobe::array_t& parameters) {
     if (parameters.size() != 1)
         throw std::runtime_error("localize: parameter error");
 
@@ -175,8 +169,7 @@ adobe::any_regular_t localize_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t round_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t round_function(const adobe::array_t& parameters) {
     if (parameters.size() == 0)
         throw std::runtime_error("round: parameter error");
 
@@ -185,8 +178,7 @@ adobe::any_regular_t round_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t min_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t min_function(const adobe::array_t& parameters) {
     if (parameters.size() == 0)
         throw std::runtime_error("min: parameter error");
 
@@ -198,8 +190,7 @@ adobe::any_regular_t min_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t max_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t max_function(const adobe::array_t& parameters) {
     if (parameters.size() == 0)
         throw std::runtime_error("max: parameter error");
 
@@ -211,8 +202,7 @@ adobe::any_regular_t max_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t typeof_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::array_t>(arg)};
+adobe::any_regular_t typeof_function(const adobe::array_t& parameters) {
     if (parameters.size() == 0)
         throw std::runtime_error("typeof: parameter error");
 
@@ -227,8 +217,7 @@ adobe::any_regular_t typeof_function(const adobe::any_regular_t& arg) {
 
 /**************************************************************************************************/
 
-adobe::any_regular_t scale_function(const adobe::any_regular_t& arg) {
-    const auto& parameters{cast<adobe::dictionary_t>(arg)};
+adobe::any_regular_t scale_function(const adobe::dictionary_t& parameters) {
     double m(1.0);
     double x(0.0);
     double b(0.0);
@@ -385,20 +374,10 @@ public:
     void function_operator();
     void array_operator();
     void dictionary_operator();
-
-    static operator_table_t* operator_table_g;
-    static array_function_table_t* array_function_table_g;
-    static dictionary_function_table_t* dictionary_function_table_g;
 };
 
 /**************************************************************************************************/
 
-operator_table_t* virtual_machine_t::implementation_t::operator_table_g;
-array_function_table_t* virtual_machine_t::implementation_t::array_function_table_g;
-dictionary_function_table_t* virtual_machine_t::implementation_t::dictionary_function_table_g;
-
-/**************************************************************************************************/
-
 } // namespace adobe
 
 /**************************************************************************************************/
@@ -413,77 +392,52 @@ namespace {
 
 /**************************************************************************************************/
 
-void virtual_machine_init_() {
-    using op_entry_type = operator_table_t::entry_type;
-    using implementation_t = adobe::virtual_machine_t::implementation_t;
-
-    static operator_table_t operator_table_s = {
-        {op_entry_type(adobe::not_k, &implementation_t::unary_operator<std::logical_not, bool>),
-         op_entry_type(adobe::unary_negate_k,
-                       &implementation_t::unary_operator<std::negate, double>),
-         op_entry_type(adobe::add_k, &implementation_t::binary_operator<std::plus, double>),
-         op_entry_type(adobe::subtract_k, &implementation_t::binary_operator<std::minus, double>),
-         op_entry_type(adobe::multiply_k,
-                       &implementation_t::binary_operator<std::multiplies, double>),
-         op_entry_type(adobe::modulus_k, &implementation_t::binary_operator<std::modulus, int>),
-         op_entry_type(adobe::divide_k, &implementation_t::binary_operator<std::divides, double>),
-         op_entry_type(adobe::less_k, &implementation_t::binary_operator<std::less, double>),
-         op_entry_type(adobe::greater_k, &implementation_t::binary_operator<std::greater, double>),
-         op_entry_type(adobe::less_equal_k,
-                       &implementation_t::binary_operator<std::less_equal, double>),
-         op_entry_type(adobe::greater_equal_k,
-                       &implementation_t::binary_operator<std::greater_equal, double>),
-         op_entry_type(adobe::equal_k,
-                       &implementation_t::binary_operator<std::equal_to, adobe::any_regular_t>),
-         op_entry_type(adobe::not_equal_k,
-                       &implementation_t::binary_operator<std::not_equal_to, adobe::any_regular_t>),
-         op_entry_type(adobe::ifelse_k, &implementation_t::ifelse_operator),
-         op_entry_type(adobe::index_k, &implementation_t::index_operator),
-         op_entry_type(adobe::function_k, &implementation_t::function_operator),
-         op_entry_type(adobe::array_k, &implementation_t::array_operator),
-         op_entry_type(adobe::dictionary_k, &implementation_t::dictionary_operator),
-         op_entry_type(adobe::variable_k, &implementation_t::variable_operator),
-         op_entry_type(adobe::and_k, &implementation_t::logical_and_operator),
-         op_entry_type(adobe::or_k, &implementation_t::logical_or_operator),
-         op_entry_type(adobe::bitwise_and_k,
-                       &implementation_t::bitwise_binary_operator<bitwise_and_t>),
-         op_entry_type(adobe::bitwise_xor_k,
-                       &implementation_t::bitwise_binary_operator<bitwise_xor_t>),
-         op_entry_type(adobe::bitwise_or_k,
-                       &implementation_t::bitwise_binary_operator<bitwise_or_t>),
-         op_entry_type(adobe::bitwise_rshift_k,
-                       &implementation_t::bitwise_binary_operator<bitwise_rshift_t>),
-         op_entry_type(adobe::bitwise_lshift_k,
-                       &implementation_t::bitwise_binary_operator<bitwise_lshift_t>),
-         op_entry_type(adobe::bitwise_negate_k,
-                       &implementation_t::bitwise_unary_operator<bitwise_negate_t>)}};
-
-    static array_function_table_t array_function_table_s = {
-        {array_function_table_t::entry_type("typeof"_name, &typeof_function),
-         array_function_table_t::entry_type("min"_name, &min_function),
-         array_function_table_t::entry_type("max"_name, &max_function),
-         array_function_table_t::entry_type("round"_name, &round_function),
-         array_function_table_t::entry_type("localize"_name, &localize_function),
-         array_function_table_t::entry_type("xml_escape"_name, &xml_escape_function),
-         array_function_table_t::entry_type("xml_unescape"_name, &xml_unescape_function)}};
-
-    static dictionary_function_table_t dictionary_function_table_s = {
-        {dictionary_function_table_t::entry_type("scale"_name, &scale_function)}};
-
-    operator_table_s.sort();
-    array_function_table_s.sort();
-    dictionary_function_table_s.sort();
-
-    adobe::virtual_machine_t::implementation_t::operator_table_g = &operator_table_s;
-    adobe::virtual_machine_t::implementation_t::array_function_table_g = &array_function_table_s;
-    adobe::virtual_machine_t::implementation_t::dictionary_function_table_g =
-        &dictionary_function_table_s;
-}
-
-/**************************************************************************************************/
-
-once_flag virtual_machine_init_flag;
-void virtual_machine_init() { call_once(virtual_machine_init_flag, &virtual_machine_init_); }
+using implementation_t = adobe::virtual_machine_t::implementation_t;
+
+constexpr auto operator_table_k = adobe::make_static_hash_table<operator_t>({
+    {adobe::not_k, &implementation_t::unary_operator<std::logical_not, bool>},
+    {adobe::unary_negate_k, &implementation_t::unary_operator<std::negate, double>},
+    {adobe::add_k, &implementation_t::binary_operator<std::plus, double>},
+    {adobe::subtract_k, &implementation_t::binary_operator<std::minus, double>},
+    {adobe::multiply_k, &implementation_t::binary_operator<std::multiplies, double>},
+    {adobe::modulus_k, &implementation_t::binary_operator<std::modulus, int>},
+    {adobe::divide_k, &implementation_t::binary_operator<std::divides, double>},
+    {adobe::less_k, &implementation_t::binary_operator<std::less, double>},
+    {adobe::greater_k, &implementation_t::binary_operator<std::greater, double>},
+    {adobe::less_equal_k, &implementation_t::binary_operator<std::less_equal, double>},
+    {adobe::greater_equal_k, &implementation_t::binary_operator<std::greater_equal, double>},
+    {adobe::equal_k, &implementation_t::binary_operator<std::equal_to, adobe::any_regular_t>},
+    {adobe::not_equal_k,
+     &implementation_t::binary_operator<std::not_equal_to, adobe::any_regular_t>},
+    {adobe::ifelse_k, &implementation_t::ifelse_operator},
+    {adobe::index_k, &implementation_t::index_operator},
+    {adobe::function_k, &implementation_t::function_operator},
+    {adobe::array_k, &implementation_t::array_operator},
+    {adobe::dictionary_k, &implementation_t::dictionary_operator},
+    {adobe::variable_k, &implementation_t::variable_operator},
+    {adobe::and_k, &implementation_t::logical_and_operator},
+    {adobe::or_k, &implementation_t::logical_or_operator},
+    {adobe::bitwise_and_k, &implementation_t::bitwise_binary_operator<bitwise_and_t>},
+    {adobe::bitwise_xor_k, &implementation_t::bitwise_binary_operator<bitwise_xor_t>},
+    {adobe::bitwise_or_k, &implementation_t::bitwise_binary_operator<bitwise_or_t>},
+    {adobe::bitwise_rshift_k, &implementation_t::bitwise_binary_operator<bitwise_rshift_t>},
+    {adobe::bitwise_lshift_k, &implementation_t::bitwise_binary_operator<bitwise_lshift_t>},
+    {adobe::bitwise_negate_k, &implementation_t::bitwise_unary_operator<bitwise_negate_t>},
+});
+
+constexpr auto array_function_table_k = adobe::make_static_hash_table<array_function_t>({
+    {"typeof"_name, &typeof_function},
+    {"min"_name, &min_function},
+    {"max"_name, &max_function},
+    {"round"_name, &round_function},
+    {"localize"_name, &localize_function},
+    {"xml_escape"_name, &xml_escape_function},
+    {"xml_unescape"_name, &xml_unescape_function},
+});
+
+constexpr auto dictionary_function_table_k = adobe::make_static_hash_table<dictionary_function_t>({
+    {"scale"_name, &scale_function},
+});
 
 /**************************************************************************************************/
 
@@ -501,7 +455,7 @@ namespace adobe {
 
 /**************************************************************************************************/
 
-virtual_machine_t::implementation_t::implementation_t() { virtual_machine_init(); }
+virtual_machine_t::implementation_t::implementation_t() = default;
 
 /**************************************************************************************************/
 
@@ -537,9 +491,7 @@ void virtual_machine_t::implementation_t::pop_back() { value_stack_m.pop_back();
 /**************************************************************************************************/
 
 operator_t virtual_machine_t::implementation_t::find_operator(adobe::name_t oper) {
-    virtual_machine_init();
-
-    return (*operator_table_g)(oper);
+    return operator_table_k(oper);
 }
 
 /**************************************************************************************************/
@@ -741,32 +693,29 @@ void virtual_machine_t::implementation_t::bitwise_unary_operator() {
 /**************************************************************************************************/
 
 void virtual_machine_t::implementation_t::function_operator() {
-    virtual_machine_init();
-
     // pop the function name
     adobe::name_t function_name(back().cast<adobe::name_t>());
     pop_back();
 
     if (back().type_info() == typeid(adobe::array_t)) {
         // handle unnamed parameter functions
-        array_function_t array_func;
         adobe::array_t arguments(back().cast<adobe::array_t>());
 
         // handle function lookup
 
-        if ((*array_function_table_g)(function_name, array_func))
-            value_stack_m.back() = array_func(arguments);
+        if (const array_function_t* array_func = array_function_table_k.find(function_name))
+            value_stack_m.back() = (*array_func)(arguments);
         else if (array_function_lookup_m)
             value_stack_m.back() = array_function_lookup_m(function_name, arguments);
         else
             throw_function_not_defined(function_name);
     } else {
         // handle named parameter functions
-        dictionary_function_t dictionary_func;
         adobe::dictionary_t arguments(back().cast<adobe::dictionary_t>());
 
-        if ((*dictionary_function_table_g)(function_name, dictionary_func))
-            value_stack_m.back() = dictionary_func(arguments);
+        if (const dictionary_function_t* dictionary_func =
+                dictionary_function_table_k.find(function_name))
+            value_stack_m.back() = (*dictionary_func)(arguments);
         else if (dictionary_function_lookup_m)
             value_stack_m.back() = dictionary_function_lookup_m(function_name, arguments);
         else
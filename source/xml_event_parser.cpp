@@ -0,0 +1,159 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/xml_event_parser.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <adobe/implementation/expression_filter.hpp>
+
+/**************************************************************************************************/
+
+using namespace std;
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+size_t encode_utf8(uint32_t code_point, char* buffer) {
+    if (code_point == 0 || code_point > 0x10FFFF ||
+        (code_point >= 0xD800 && code_point <= 0xDFFF))
+        return 0;
+
+    if (code_point < 0x80) {
+        buffer[0] = static_cast<char>(code_point);
+        return 1;
+    }
+    if (code_point < 0x800) {
+        buffer[0] = static_cast<char>(0xC0 | (code_point >> 6));
+        buffer[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        buffer[0] = static_cast<char>(0xE0 | (code_point >> 12));
+        buffer[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        buffer[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+    buffer[0] = static_cast<char>(0xF0 | (code_point >> 18));
+    buffer[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    buffer[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    buffer[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+/**************************************************************************************************/
+
+// Returns the value of a character reference, "#60" or "#x3C", or zero if it is malformed.
+uint32_t character_reference(string_view reference) {
+    const bool hex(reference.size() > 1 && (reference[1] == 'x' || reference[1] == 'X'));
+    const size_t first(hex ? 2 : 1);
+
+    if (reference.size() == first || reference.size() - first > 8)
+        return 0;
+
+    uint32_t result(0);
+
+    for (char c : reference.substr(first)) {
+        uint32_t digit;
+
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (hex && c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else if (hex && c >= 'A' && c <= 'F')
+            digit = c - 'A' + 10;
+        else
+            return 0;
+
+        result = result * (hex ? 16 : 10) + digit;
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+namespace implementation {
+
+/**************************************************************************************************/
+
+size_t decode_xml_reference(string_view reference, char* buffer) {
+    if (reference.empty())
+        return 0;
+
+    if (reference[0] == '#')
+        return encode_utf8(character_reference(reference), buffer);
+
+    // The predefined entities are handled without a lookup.
+    char c(0);
+
+    if (reference == "lt")
+        c = '<';
+    else if (reference == "gt")
+        c = '>';
+    else if (reference == "amp")
+        c = '&';
+    else if (reference == "apos")
+        c = '\'';
+    else if (reference == "quot")
+        c = '"';
+
+    if (c) {
+        buffer[0] = c;
+        return 1;
+    }
+
+    try {
+        return encode_utf8(entity_map_find(string(reference)), buffer);
+    } catch (...) {
+        return 0;
+    }
+}
+
+/**************************************************************************************************/
+
+void throw_xml_event_error(const char* what, string_view text, const char* at,
+                           const line_position_t& position) {
+    const char* const first(text.data());
+    const char* const last(min(at, first + text.size()));
+    const char* line_start(first);
+    int line(position.line_number_m);
+
+    for (const char* p(first); p != last; ++p) {
+        if (*p == '\n') {
+            ++line;
+            line_start = p + 1;
+        }
+    }
+
+    throw stream_error_t(what, line_position_t(name_t(position.stream_name()),
+                                               line_position_t::getline_proc_t(), line,
+                                               line_start - first, last - first));
+}
+
+/**************************************************************************************************/
+
+} // namespace implementation
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
@@ -5,7 +5,10 @@
 */
 /**************************************************************************************************/
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <tuple>
 
@@ -48,13 +51,6 @@ adobe::token_range_t* attribute_platform_g = 0;
 
 /**************************************************************************************************/
 
-ADOBE_THREAD_LOCAL_STORAGE(adobe::implementation::context_frame_t, thread_context)
-#if 0
-{ } // REVISIT (fbrereto) : workaround for a bug in the BBEdit function menu parser
-#endif
-
-/**************************************************************************************************/
-
 #if 0
 #pragma mark -
 #endif
@@ -62,13 +58,6 @@ ADOBE_THREAD_LOCAL_STORAGE(adobe::implementation::context_frame_t, thread_contex
 /**************************************************************************************************/
 
 void init_xstr_once() {
-    // initialize the thread-specific context attribute set
-
-    ADOBE_THREAD_LOCAL_STORAGE_INITIALIZE(thread_context);
-
-    adobe::implementation::context_frame_t& context(
-        ADOBE_THREAD_LOCAL_STORAGE_ACCESS(thread_context));
-
     static adobe::token_range_t xstr_tag_s(adobe::static_token_range("xstr"));
     static adobe::token_range_t marker_tag_s(adobe::static_token_range("marker"));
     static adobe::token_range_t attribute_id_s(adobe::static_token_range("id"));
@@ -80,49 +69,101 @@ void init_xstr_once() {
     attribute_id_g = &attribute_id_s;
     attribute_lang_g = &attribute_lang_s;
     attribute_platform_g = &attribute_platform_s;
+}
+
+/**************************************************************************************************/
 
-    context.attribute_set_m.insert(std::make_pair(attribute_platform_s, adobe::static_token_range(
+void xstr_once() {
+    static once_flag flag;
+    call_once(flag, &init_xstr_once);
+}
+
+/**************************************************************************************************/
+
+adobe::implementation::context_frame_t default_frame() {
+    // initialize the thread-specific context attribute set
+
+    xstr_once();
+
+    adobe::implementation::context_frame_t context;
+
+    const char* platform =
 #if ADOBE_PLATFORM_LINUX
-                                                                            "linux"
+        "linux";
 #elif ADOBE_PLATFORM_BSD
-                                                                            "bsd"
+        "bsd";
 #elif ADOBE_PLATFORM_SOLARIS
-                                                                            "solaris"
+        "solaris";
 #elif ADOBE_PLATFORM_IRIX
-                                                                            "irix"
+        "irix";
 #elif ADOBE_PLATFORM_HPUX
-                                                                            "hpux"
+        "hpux";
 #elif ADOBE_PLATFORM_CYGWIN
-                                                                            "cygwin"
+        "cygwin";
 #elif ADOBE_PLATFORM_WIN
-                                                                            "windows"
+        "windows";
 #elif ADOBE_PLATFORM_BEOS
-                                                                            "beos"
+        "beos";
 #elif ADOBE_PLATFORM_MAC
-                                                                            "macintosh"
+        "macintosh";
 #elif ADOBE_PLATFORM_AIX
-                                                                            "aix"
+        "aix";
 #elif ADOBE_PLATFORM_AMIGA
-                                                                            "amiga"
+        "amiga";
 #elif ADOBE_PLATFORM_UNIX
-                                                                            "unix"
+        "unix";
 #else
 #error "Unknown platform - please configure and report the results to stlab.adobe.com"
 #endif
-                                                                            )));
+
+    context.attribute_set_m.insert(
+        std::make_pair(*attribute_platform_g, adobe::static_token_range(platform)));
 
     // REVISIT (fbrereto) : This language code should be runtime obtainable, not static
 
     context.attribute_set_m.insert(
-        std::make_pair(attribute_lang_s, adobe::static_token_range("en-us")));
+        std::make_pair(*attribute_lang_g, adobe::static_token_range("en-us")));
+
+    return context;
 }
 
 /**************************************************************************************************/
 
+ADOBE_THREAD_LOCAL_STORAGE_1(adobe::implementation::context_frame_t, thread_context,
+                             default_frame())
 
-void xstr_once() {
-    static once_flag flag;
-    call_once(flag, &init_xstr_once);
+/**************************************************************************************************/
+
+/*
+    The glossary shared by all threads. Each thread holds its own reference to the current
+    snapshot and only takes the mutex when the generation has changed, so lookups never contend.
+*/
+
+std::mutex shared_glossary_mutex_g;
+std::shared_ptr<const adobe::xstring_glossary_t> shared_glossary_g;
+std::atomic<std::uint64_t> shared_generation_g{0};
+
+std::shared_ptr<const adobe::xstring_glossary_t> load_shared_glossary() {
+    std::lock_guard<std::mutex> lock(shared_glossary_mutex_g);
+    return shared_glossary_g;
+}
+
+struct shared_snapshot_t {
+    std::shared_ptr<const adobe::xstring_glossary_t> glossary_m;
+    std::uint64_t generation_m{0};
+};
+
+const adobe::xstring_glossary_t* shared_glossary_snapshot() {
+    thread_local shared_snapshot_t snapshot;
+
+    const std::uint64_t generation(shared_generation_g.load(std::memory_order_acquire));
+
+    if (generation != snapshot.generation_m) {
+        snapshot.glossary_m = load_shared_glossary();
+        snapshot.generation_m = generation;
+    }
+
+    return snapshot.glossary_m.get();
 }
 
 /**************************************************************************************************/
@@ -207,6 +248,9 @@ context_frame_t::store(const store_t::key_type& key, const adobe::attribute_set_
                        const adobe::token_range_t& value, bool copy) {
     assert(std::distance(boost::begin(key), boost::end(key)));
 
+    // Any copy must be made before iterators into the glossary are taken.
+    writable_glossary();
+
     store_t::key_type to_key(key);
     adobe::attribute_set_t to_mapped_attribute_set(attribute_set);
     adobe::token_range_t to_mapped_value(value);
@@ -236,15 +280,15 @@ context_frame_t::store(const store_t::key_type& key, const adobe::attribute_set_
             to_mapped_attribute_set.insert(clone(first->first), clone(first->second));
     }
 
-    store_iterator result(glossary_m.insert(
+    store_iterator result(glossary_m->insert(
         store_value_type(to_key, element_t(to_mapped_attribute_set, to_mapped_value))));
 
-    assert(result != glossary_m.end());
+    assert(result != glossary_m->end());
 
 #if 0 && ADOBE_DOING_SERIALIZATION
-    std::cerr   << "Added value " << glossary_m.size() << " \""
+    std::cerr   << "Added value " << glossary_m->size() << " \""
                 << result->second << "\" to glossary "
-                << static_cast<void*>(&glossary_m);
+                << static_cast<void*>(glossary_m.get());
 
     if (copy)
         std::cerr << " (copied)";
@@ -252,7 +296,7 @@ context_frame_t::store(const store_t::key_type& key, const adobe::attribute_set_
     std::cerr << std::endl;
 
 #if 0
-    for (   store_t::iterator first(glossary_m.begin()), last(glossary_m.end());
+    for (   store_t::iterator first(glossary_m->begin()), last(glossary_m->end());
             first != last; ++first)
         std::cerr   << "key: \"" << first->first << "\"; value: \""
                     << first->second << "\"" << std::endl;
@@ -264,6 +308,35 @@ context_frame_t::store(const store_t::key_type& key, const adobe::attribute_set_
 
 /**************************************************************************************************/
 
+const std::string& context_frame_t::resolve(const char* xstr, std::size_t n) {
+    // Bounds the memory held by contexts that format many distinct strings.
+    constexpr std::size_t max_results_k = 4096;
+
+    const std::uint64_t generation(shared_generation_g.load(std::memory_order_acquire));
+
+    // Results may have come from a shared glossary that has since been replaced.
+    if (generation != results_generation_m) {
+        results_m.clear();
+        results_generation_m = generation;
+    }
+
+    std::string key(xstr, n);
+    auto found(results_m.find(key));
+
+    if (found != results_m.end())
+        return found->second;
+
+    std::string result;
+    parse_xml_fragment(reinterpret_cast<uchar_ptr_t>(xstr), n, std::back_inserter(result));
+
+    if (results_m.size() == max_results_k)
+        results_m.clear();
+
+    return results_m.emplace(std::move(key), std::move(result)).first->second;
+}
+
+/**************************************************************************************************/
+
 struct store_count_same_t {
     typedef std::size_t result_type;
 
@@ -333,20 +406,20 @@ context_frame_t::closest_match(store_range_pair_t /* range */,
     // of fixing it because the ROI isn't there; nobody uses xstring that I know of. If this
     // proves not to be the case, we can revisit.
 #if 1
-    return glossary_m.end();
+    return glossary_m->end();
 #else
     typedef std::iterator_traits<store_iterator>::difference_type difference_type;
 
     difference_type range_size(std::distance(boost::begin(range), boost::end(range)));
 
     if (!range_size)
-        return glossary_m.end();
+        return glossary_m->end();
 
     std::tuple<std::size_t, std::size_t, store_iterator> result_tuple =
         count_max_element_tuple(range, std::bind(store_count_same_t(), _1, boost::cref(searching)));
 
     if (boost::get<1>(result_tuple) == 0)
-        return glossary_m.end();
+        return glossary_m->end();
     else if (boost::get<0>(result_tuple) > 1) {
         std::stringstream errstr;
 
@@ -409,9 +482,24 @@ adobe::token_range_t xml_xstr_lookup(const adobe::token_range_t& entire_element_
         context_frame_t& context(top_frame());
         adobe::attribute_set_t merged(attribute_set.merge(context.attribute_set_m));
         adobe::token_range_t id(merged[*attribute_id_g]);
+
+        const xstring_glossary_t* shared(shared_glossary_snapshot());
+
+        if (context.compiled_m || shared) {
+            const name_t id_name(std::string(id.first, id.second).c_str());
+            const token_range_t* found(nullptr);
+
+            if (context.compiled_m)
+                found = context.compiled_m->find(id_name, merged);
+            if (!found && shared)
+                found = shared->find(id_name, merged);
+            if (found)
+                return *found;
+        }
+
         context_frame_t::store_iterator closest(
             context.closest_match(context.range_for_key(id), merged));
-        context_frame_t::store_iterator last(context.glossary_m.end());
+        context_frame_t::store_iterator last(context.glossary_m->end());
 
         if (closest == last) {
 #if 0 && ADOBE_DOING_SERIALIZATION
@@ -449,15 +537,28 @@ adobe::token_range_t xml_xstr_lookup(const adobe::token_range_t& entire_element_
 #ifndef NDEBUG
 
 void xstring_clear_glossary() {
-    adobe::implementation::context_frame_t::store_t& glossary(
-        adobe::implementation::top_frame().glossary_m);
-
-    glossary.erase(glossary.begin(), glossary.end());
+    adobe::implementation::top_frame().glossary_m =
+        std::make_shared<adobe::implementation::context_frame_t::store_t>();
+    adobe::implementation::top_frame().results_m.clear();
 }
 
 #endif
 /**************************************************************************************************/
 
+void xstring_set_shared_glossary(std::shared_ptr<const xstring_glossary_t> glossary) {
+    {
+        std::lock_guard<std::mutex> lock(shared_glossary_mutex_g);
+        shared_glossary_g.swap(glossary);
+    }
+    shared_generation_g.fetch_add(1, std::memory_order_release);
+}
+
+std::shared_ptr<const xstring_glossary_t> xstring_shared_glossary() {
+    return load_shared_glossary();
+}
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
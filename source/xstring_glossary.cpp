@@ -0,0 +1,425 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/xstring_glossary.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <adobe/mapped_file.hpp>
+#include <adobe/xstring.hpp>
+
+/**************************************************************************************************/
+
+using namespace std;
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+using namespace adobe;
+
+/**************************************************************************************************/
+
+/*
+    Image layout, all integers are native byte order uint32_t:
+
+        header_t
+        strings:        string_count_m x (length, bytes, '\0')
+        attribute sets: set_count_m x (pair count, pair count x (key string, value string))
+        entries:        entry_count_m x (id string, attribute set, value string)
+
+    Strings are null terminated so names can be interned directly from a mapped image.
+*/
+
+constexpr char image_magic_k[8] = {'A', 'S', 'L', 'X', 'S', 'T', 'R', '\0'};
+constexpr uint32_t image_version_k = 1;
+constexpr uint32_t byte_order_mark_k = 0x01020304;
+
+struct header_t {
+    char magic_m[8];
+    uint32_t version_m;
+    uint32_t byte_order_m;
+    uint32_t string_count_m;
+    uint32_t set_count_m;
+    uint32_t entry_count_m;
+};
+
+/**************************************************************************************************/
+
+class image_writer_t {
+public:
+    uint32_t add(string_view x) {
+        auto inserted(index_m.emplace(x, static_cast<uint32_t>(strings_m.size())));
+        if (inserted.second)
+            strings_m.push_back(x);
+        return inserted.first->second;
+    }
+
+    void write(uint32_t x) { body_m.append(reinterpret_cast<const char*>(&x), sizeof(x)); }
+
+    string finish(uint32_t set_count, uint32_t entry_count) const {
+        header_t header;
+        memcpy(header.magic_m, image_magic_k, sizeof(image_magic_k));
+        header.version_m = image_version_k;
+        header.byte_order_m = byte_order_mark_k;
+        header.string_count_m = static_cast<uint32_t>(strings_m.size());
+        header.set_count_m = set_count;
+        header.entry_count_m = entry_count;
+
+        string result(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (string_view e : strings_m) {
+            const uint32_t size(static_cast<uint32_t>(e.size()));
+            result.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            result.append(e);
+            result += '\0';
+        }
+
+        return result += body_m;
+    }
+
+private:
+    vector<string_view> strings_m;
+    unordered_map<string_view, uint32_t> index_m;
+    string body_m;
+};
+
+/**************************************************************************************************/
+
+class image_reader_t {
+public:
+    explicit image_reader_t(string_view image)
+        : first_m(image.data()), last_m(image.data() + image.size()) {}
+
+    void read_raw(void* x, size_t size) {
+        if (size > size_t(last_m - first_m))
+            corrupt();
+        memcpy(x, first_m, size);
+        first_m += size;
+    }
+
+    uint32_t read() {
+        uint32_t result;
+        read_raw(&result, sizeof(result));
+        return result;
+    }
+
+    /*
+        Reads an element count. Every element takes at least four bytes, so a larger count is
+        corrupt and would otherwise cause a huge allocation.
+    */
+    uint32_t read_count() {
+        uint32_t result(read());
+        if (result > size_t(last_m - first_m) / sizeof(uint32_t))
+            corrupt();
+        return result;
+    }
+
+    const char* read_string(uint32_t& size) {
+        size = read();
+        if (size >= size_t(last_m - first_m) || first_m[size] != '\0')
+            corrupt();
+        const char* result(first_m);
+        first_m += size + 1;
+        return result;
+    }
+
+    bool at_end() const { return first_m == last_m; }
+
+    [[noreturn]] static void corrupt() { throw runtime_error("xstring glossary: corrupt image"); }
+
+private:
+    const char* first_m;
+    const char* last_m;
+};
+
+/**************************************************************************************************/
+
+string_view to_string_view(const token_range_t& x) {
+    return string_view(reinterpret_cast<const char*>(x.first), token_range_size(x));
+}
+
+name_t to_name(const token_range_t& x) { return name_t(string(to_string_view(x)).c_str()); }
+
+const token_range_t& xstr_tag() {
+    static const token_range_t result(static_token_range("xstr"));
+    return result;
+}
+
+const token_range_t& id_attribute() {
+    static const token_range_t result(static_token_range("id"));
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+namespace adobe {
+
+/**************************************************************************************************/
+
+size_t xstring_glossary_t::attribute_key_hash_t::operator()(const attribute_key_t& x) const {
+    size_t result(x.size());
+    for (const auto& e : x)
+        result = (result * 31 + hash<name_t>()(e.first)) * 31 + hash<name_t>()(e.second);
+    return result;
+}
+
+/**************************************************************************************************/
+
+xstring_glossary_t::attribute_key_t
+xstring_glossary_t::make_key(const attribute_set_t& attributes) {
+    attribute_key_t result;
+
+    for (const auto& e : attributes) {
+        if (!token_range_equal(e.first, id_attribute()))
+            result.emplace_back(to_name(e.first), to_name(e.second));
+    }
+
+    // attribute_set_t is already sorted by key, this keeps the key independent of that.
+    sort(result.begin(), result.end());
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+xstring_glossary_t::attribute_set_id_t xstring_glossary_t::intern(attribute_key_t key) {
+    auto inserted(set_index_m.emplace(key, static_cast<attribute_set_id_t>(set_index_m.size())));
+    if (inserted.second)
+        attribute_sets_m.push_back(std::move(key));
+    return inserted.first->second;
+}
+
+void xstring_glossary_t::insert(name_t id, attribute_set_id_t attributes,
+                                const token_range_t& value) {
+    const uint32_t index(static_cast<uint32_t>(entries_m.size()));
+
+    if (!index_m.emplace(make_pair(id, attributes), index).second)
+        return;
+
+    entries_m.push_back(entry_t{id, attributes, value});
+    by_id_m[id].push_back(index);
+}
+
+/**************************************************************************************************/
+
+xstring_glossary_t xstring_glossary_t::compile(string_view xml, const line_position_t& position) {
+    // The entries refer into xml until the glossary is reloaded from its own image.
+    xstring_glossary_t result;
+
+    auto store = [&](const token_range_t&, const token_range_t& name,
+                     const attribute_set_t& attributes, const token_range_t& value) {
+        if (token_range_equal(name, xstr_tag())) {
+            const token_range_t id(attributes[id_attribute()]);
+
+            if (!token_range_size(id))
+                throw runtime_error("xstring glossary: xstr element without an id");
+
+            result.insert(to_name(id), result.intern(make_key(attributes)), value);
+        }
+        return token_range_t();
+    };
+
+    const uchar_ptr_t first(reinterpret_cast<uchar_ptr_t>(xml.data()));
+
+    make_xml_parser(first, first + xml.size(), position,
+                    implementation::xstring_preorder_predicate, store,
+                    implementation::null_output_t())
+        .parse_element_sequence();
+
+    return load(result.image());
+}
+
+/**************************************************************************************************/
+
+xstring_glossary_t xstring_glossary_t::load(string_view image) {
+    auto storage(make_shared<const string>(image));
+
+    xstring_glossary_t result;
+    result.read_image(*storage);
+    result.storage_m = std::move(storage);
+
+    return result;
+}
+
+xstring_glossary_t xstring_glossary_t::load_file(const filesystem::path& path) {
+    auto storage(make_shared<const mapped_file_t>(path));
+
+    xstring_glossary_t result;
+    result.read_image(storage->view());
+    result.storage_m = std::move(storage);
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+void xstring_glossary_t::read_image(string_view image) {
+    image_reader_t in(image);
+    header_t header;
+    in.read_raw(&header, sizeof(header));
+
+    if (memcmp(header.magic_m, image_magic_k, sizeof(image_magic_k)) != 0 ||
+        header.version_m != image_version_k || header.byte_order_m != byte_order_mark_k)
+        image_reader_t::corrupt();
+
+    vector<token_range_t> strings;
+    vector<name_t> names(header.string_count_m);
+    strings.reserve(header.string_count_m);
+
+    for (uint32_t n = 0; n != header.string_count_m; ++n) {
+        uint32_t size;
+        const char* text(in.read_string(size));
+        strings.emplace_back(reinterpret_cast<uchar_ptr_t>(text),
+                             reinterpret_cast<uchar_ptr_t>(text) + size);
+    }
+
+    // Only strings used as ids or attributes are interned, values are referred to in place.
+    auto name = [&](uint32_t index) {
+        if (index >= strings.size())
+            image_reader_t::corrupt();
+        if (!names[index])
+            names[index] = name_t(reinterpret_cast<const char*>(strings[index].first));
+        return names[index];
+    };
+
+    for (uint32_t n = 0; n != header.set_count_m; ++n) {
+        attribute_key_t key(in.read_count());
+        for (auto& e : key) {
+            e.first = name(in.read());
+            e.second = name(in.read());
+        }
+        if (intern(std::move(key)) != n)
+            image_reader_t::corrupt();
+    }
+
+    for (uint32_t n = 0; n != header.entry_count_m; ++n) {
+        const name_t id(name(in.read()));
+        const uint32_t attributes(in.read());
+        const uint32_t value(in.read());
+
+        if (attributes >= attribute_sets_m.size() || value >= strings.size())
+            image_reader_t::corrupt();
+
+        insert(id, attributes, strings[value]);
+    }
+
+    if (!in.at_end() || entries_m.size() != header.entry_count_m)
+        image_reader_t::corrupt();
+}
+
+/**************************************************************************************************/
+
+string xstring_glossary_t::image() const {
+    image_writer_t out;
+
+    for (const auto& set : attribute_sets_m) {
+        out.write(static_cast<uint32_t>(set.size()));
+        for (const auto& e : set) {
+            out.write(out.add(e.first.c_str()));
+            out.write(out.add(e.second.c_str()));
+        }
+    }
+
+    for (const auto& e : entries_m) {
+        out.write(out.add(e.id_m.c_str()));
+        out.write(e.attributes_m);
+        out.write(out.add(to_string_view(e.value_m)));
+    }
+
+    return out.finish(static_cast<uint32_t>(attribute_sets_m.size()),
+                      static_cast<uint32_t>(entries_m.size()));
+}
+
+/**************************************************************************************************/
+
+xstring_glossary_t::attribute_set_id_t
+xstring_glossary_t::attribute_set_id(const attribute_set_t& attributes) const {
+    auto found(set_index_m.find(make_key(attributes)));
+    return found == set_index_m.end() ? npos : found->second;
+}
+
+/**************************************************************************************************/
+
+const token_range_t* xstring_glossary_t::find(name_t id, const attribute_set_t& attributes) const {
+    const attribute_key_t key(make_key(attributes));
+
+    auto set(set_index_m.find(key));
+    if (set != set_index_m.end()) {
+        auto found(index_m.find(make_pair(id, set->second)));
+        if (found != index_m.end())
+            return &entries_m[found->second].value_m;
+    }
+
+    auto candidates(by_id_m.find(id));
+    if (candidates == by_id_m.end())
+        return nullptr;
+
+    /*
+        Closest match: the entry with the most attributes equal to those searched for, among the
+        entries with no attribute that has a different value.
+    */
+    const entry_t* best(nullptr);
+    size_t best_score(0);
+    size_t ties(0);
+
+    for (uint32_t index : candidates->second) {
+        const attribute_key_t& entry(attribute_sets_m[entries_m[index].attributes_m]);
+        size_t score(0);
+        bool collision(false);
+
+        for (auto x(entry.begin()), y(key.begin()); x != entry.end() && y != key.end();) {
+            if (x->first < y->first) {
+                ++x;
+            } else if (y->first < x->first) {
+                ++y;
+            } else {
+                if (x->second != y->second) {
+                    collision = true;
+                    break;
+                }
+                ++score, ++x, ++y;
+            }
+        }
+
+        if (collision)
+            continue;
+
+        if (!best || score > best_score) {
+            best = &entries_m[index];
+            best_score = score;
+            ties = 1;
+        } else if (score == best_score) {
+            ++ties;
+        }
+    }
+
+    if (ties > 1) {
+        stringstream error;
+        error << "xstr: ambiguous closest match; found " << ties
+              << " glossary entries that matched " << best_score << " attribute(s) for id \""
+              << id << "\"";
+        throw runtime_error(error.str());
+    }
+
+    return best ? &best->value_m : nullptr;
+}
+
+/**************************************************************************************************/
+
+} // namespace adobe
+
+/**************************************************************************************************/
@@ -6,6 +6,7 @@
 
 /**************************************************************************************************/
 
+#include <adobe/cassert.hpp>
 #include <adobe/config.hpp>
 #include <adobe/implementation/zuid_sys_dep.hpp>
 #include <adobe/implementation/zuid_uuid.hpp>
@@ -13,11 +14,15 @@
 #include <adobe/zuid.hpp>
 
 #include <array>
+#include <chrono>
 #include <cstdint>
-#include <cstdio>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 /**************************************************************************************************/
@@ -105,16 +110,157 @@ void init_zuid_once() { call_once(init_zuid_flag, &init_zuid_once_); }
 /**************************************************************************************************/
 
 void format_uuid(zuid_char_buffer_t& buffer, const adobe::uuid_t& uuid) {
-    std::uint32_t temp_data1{uuid.data1_m};
+    adobe::to_chars(&buffer[0], &buffer[0] + buffer.size(), adobe::zuid_t(uuid));
+}
+
+/**************************************************************************************************/
 
-    std::snprintf(&buffer[0], std::size(buffer), "%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x",
-                  temp_data1, uuid.data2_m, uuid.data3_m, uuid.data4_m[0], uuid.data4_m[1],
-                  uuid.data4_m[2], uuid.data4_m[3], uuid.data4_m[4], uuid.data4_m[5],
-                  uuid.data4_m[6], uuid.data4_m[7]);
+/*
+    The fields of a zuid in its string form: the number of hex digits in each, and whether a '-'
+    follows.
+*/
+constexpr struct {
+    int digits_m;
+    bool dash_m;
+} zuid_fields_k[] = {{8, true},  {4, true},  {4, true},  {2, false}, {2, true},  {2, false},
+                     {2, false}, {2, false}, {2, false}, {2, false}, {2, false}};
+
+constexpr char hex_digits_k[] = "0123456789abcdef";
+
+int hex_value(char c) {
+    if ('0' <= c && c <= '9')
+        return c - '0';
+    if ('a' <= c && c <= 'f')
+        return c - 'a' + 10;
+    if ('A' <= c && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/*
+    Parses the fields of a zuid from [first, last) into uuid. If strict, each field must have all
+    its digits and the whole zuid must be present; returns nullptr otherwise. If not, as with the
+    scanf pattern this replaces, a field may have fewer digits and parsing stops at the first
+    field which cannot be read, leaving it and those which follow zero.
+*/
+const char* parse_uuid(const char* first, const char* last, adobe::uuid_t& uuid, bool strict) {
+    std::uint32_t values[std::size(zuid_fields_k)] = {0};
+    std::size_t n(0);
+
+    for (; n != std::size(values); ++n) {
+        if (n != 0 && zuid_fields_k[n - 1].dash_m) {
+            if (first == last || *first != '-')
+                break;
+            ++first;
+        }
+
+        int digits(0);
+        int value;
+
+        for (; digits != zuid_fields_k[n].digits_m && first != last &&
+               (value = hex_value(*first)) != -1;
+             ++digits, ++first) {
+            values[n] = values[n] << 4 | static_cast<std::uint32_t>(value);
+        }
+
+        if (digits == 0 || (strict && digits != zuid_fields_k[n].digits_m))
+            break;
+    }
+
+    if (strict && n != std::size(values))
+        return nullptr;
+
+    uuid.data1_m = values[0];
+    uuid.data2_m = static_cast<std::uint16_t>(values[1]);
+    uuid.data3_m = static_cast<std::uint16_t>(values[2]);
+
+    for (std::size_t i(0); i != 8; ++i)
+        uuid.data4_m[i] = static_cast<std::uint8_t>(values[i + 3]);
+
+    return first;
 }
 
 /**************************************************************************************************/
 
+/*
+    xoshiro256** by David Blackman and Sebastiano Vigna, released into the public domain
+    (https://prng.di.unimi.it). Each thread has its own, seeded with splitmix64 from true_random(),
+    the random device, and the thread id, so no two threads share a sequence.
+*/
+class zuid_random_t {
+public:
+    zuid_random_t() {
+        std::uint64_t seed(adobe::true_random() ^
+                           std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        try {
+            std::random_device device;
+            seed ^= std::uint64_t(device()) << 32 | device();
+        } catch (...) {
+            // true_random() alone will do
+        }
+
+        for (auto& e : state_m) {
+            seed += 0x9e3779b97f4a7c15ULL;
+            std::uint64_t z(seed);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            e = z ^ (z >> 31);
+        }
+    }
+
+    std::uint64_t operator()() {
+        const std::uint64_t result(rotl(state_m[1] * 5, 7) * 9);
+        const std::uint64_t t(state_m[1] << 17);
+
+        state_m[2] ^= state_m[0];
+        state_m[3] ^= state_m[1];
+        state_m[1] ^= state_m[2];
+        state_m[0] ^= state_m[3];
+        state_m[2] ^= t;
+        state_m[3] = rotl(state_m[3], 45);
+
+        return result;
+    }
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t state_m[4];
+};
+
+/*
+    The per thread generator state. last_ms_m and counter_m order the time ordered zuids of the
+    thread: counter_m, the 12 bits of rand_a and the top 30 of rand_b, starts at a random value
+    below half its range each millisecond and counts up from there.
+*/
+struct zuid_generator_t {
+    zuid_random_t random_m;
+    std::uint64_t last_ms_m{0};
+    std::uint64_t counter_m{0};
+};
+
+constexpr int counter_bits_k = 42;
+
+zuid_generator_t& zuid_generator() {
+    thread_local zuid_generator_t generator_s;
+    return generator_s;
+}
+
+void assign_uuid(adobe::uuid_t& uuid, std::uint64_t high, std::uint64_t low) {
+    uuid.data1_m = static_cast<std::uint32_t>(high >> 32);
+    uuid.data2_m = static_cast<std::uint16_t>(high >> 16);
+    uuid.data3_m = static_cast<std::uint16_t>(high);
+
+    for (std::size_t i(0); i != 8; ++i)
+        uuid.data4_m[i] = static_cast<std::uint8_t>(low >> (56 - 8 * i));
+}
+
+constexpr std::uint64_t variant_mask_k = 0x3fffffffffffffffULL;
+constexpr std::uint64_t variant_k = 0x8000000000000000ULL;
+
+/**************************************************************************************************/
+
 const adobe::uuid_t& empty_uuid() {
     static adobe::uuid_t uuid_s = {0};
 
@@ -146,41 +292,13 @@ zuid_t::zuid_t(const uuid_t& uuid) : uuid_m(uuid) {}
 /**************************************************************************************************/
 
 zuid_t::zuid_t(const std::string& zuid) : uuid_m(empty_uuid()) {
-    /*
-    Initially this constructor was written using streams. It was overly
-    complicated because the zuid_t is formatted well to be read directly with an
-    istream. It was rewritten to ensure it wouldn't fail.
-    */
-
-    char buffer[zuid_t::string_size_k + 1] = {
-        0}; // Buffer large enough for a null terminated zuid_t
-
-    zuid.copy(buffer, zuid_t::string_size_k);
-
-    uuid_m = zuid_t(&buffer[0]).uuid_m;
+    parse_uuid(zuid.data(), zuid.data() + zuid.size(), uuid_m, false);
 }
 
 /**************************************************************************************************/
 
-zuid_t::zuid_t(const char* zuid_t) : uuid_m(empty_uuid()) {
-    unsigned long temp_data1;
-    int temp_data[8];
-
-// Secure versions of sscanf is used on MSVC to avoid warnings.
-#ifdef _MSC_VER
-    ::sscanf_s(zuid_t, "%8lx-%4hx-%4hx-%2x%2x-%2x%2x%2x%2x%2x%2x", &temp_data1, &uuid_m.data2_m,
-               &uuid_m.data3_m, &temp_data[0], &temp_data[1], &temp_data[2], &temp_data[3],
-               &temp_data[4], &temp_data[5], &temp_data[6], &temp_data[7]);
-#else
-    std::sscanf(zuid_t, "%8lx-%4hx-%4hx-%2x%2x-%2x%2x%2x%2x%2x%2x", &temp_data1, &uuid_m.data2_m,
-                &uuid_m.data3_m, &temp_data[0], &temp_data[1], &temp_data[2], &temp_data[3],
-                &temp_data[4], &temp_data[5], &temp_data[6], &temp_data[7]);
-#endif
-
-    uuid_m.data1_m = static_cast<std::int32_t>(temp_data1);
-
-    for (int i = 0; i < 8; ++i)
-        uuid_m.data4_m[i] = static_cast<std::uint8_t>(temp_data[i]);
+zuid_t::zuid_t(const char* zuid) : uuid_m(empty_uuid()) {
+    parse_uuid(zuid, zuid + std::strlen(zuid), uuid_m, false);
 }
 
 /**************************************************************************************************/
@@ -217,13 +335,11 @@ zuid_t& zuid_t::operator=(const uuid_t& uuid) {
 /**************************************************************************************************/
 
 std::string zuid_t::str() const {
-    zuid_char_buffer_t buffer = {{0}};
+    std::string result(string_size_k, '\0');
 
-    format_uuid(buffer, uuid_m);
-
-    buffer[buffer.size() - 1] = 0;
+    to_chars(&result[0], &result[0] + result.size(), *this);
 
-    return std::string(&buffer[0]);
+    return result;
 }
 
 /**************************************************************************************************/
@@ -242,6 +358,69 @@ char* zuid_t::c_str() const {
 
 /**************************************************************************************************/
 
+zuid_t zuid_t::random() {
+    uuid_t result;
+
+    generate(&result, 1, random_k);
+
+    return zuid_t(result);
+}
+
+/**************************************************************************************************/
+
+zuid_t zuid_t::time_ordered() {
+    uuid_t result;
+
+    generate(&result, 1, time_ordered_k);
+
+    return zuid_t(result);
+}
+
+/**************************************************************************************************/
+
+void zuid_t::generate(uuid_t* first, std::size_t n, version_t version) {
+    zuid_generator_t& generator(zuid_generator());
+    zuid_random_t& random(generator.random_m);
+
+    if (version == random_k) {
+        for (uuid_t* last(first + n); first != last; ++first) {
+            assign_uuid(*first, (random() & ~0xf000ULL) | 0x4000ULL,
+                        (random() & variant_mask_k) | variant_k);
+        }
+        return;
+    }
+
+    ADOBE_ASSERT(version == time_ordered_k && "zuid_t::generate: unknown version");
+
+    using namespace std::chrono;
+
+    const std::uint64_t now(static_cast<std::uint64_t>(
+        duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count()));
+
+    // The clock may step back; the order of the zuids of this thread is kept regardless.
+    if (now > generator.last_ms_m) {
+        generator.last_ms_m = now;
+        generator.counter_m = random() >> (64 - counter_bits_k + 1);
+    }
+
+    for (uuid_t* last(first + n); first != last; ++first) {
+        if (++generator.counter_m >> counter_bits_k) {
+            ++generator.last_ms_m; // counter exhausted, borrow from the next millisecond
+            generator.counter_m = random() >> (64 - counter_bits_k + 1);
+        }
+
+        const std::uint64_t counter(generator.counter_m);
+
+        assign_uuid(*first,
+                    (generator.last_ms_m & 0xffffffffffffULL) << 16 | 0x7000ULL |
+                        counter >> (counter_bits_k - 12),
+                    variant_k | (counter & ((1ULL << (counter_bits_k - 12)) - 1)) << 32 |
+                        (random() & 0xffffffffULL));
+    }
+}
+
+/**************************************************************************************************/
+
 bool operator==(const zuid_t& a, const zuid_t& b) {
     return uuid_compare(&a.uuid_m, &b.uuid_m) == 0;
 }
@@ -258,6 +437,43 @@ const zuid_t zuid_t::null = zuid_t(zeroed());
 
 /**************************************************************************************************/
 
+std::to_chars_result to_chars(char* first, char* last, const zuid_t& x) {
+    if (last - first < zuid_t::string_size_k)
+        return {last, std::errc::value_too_large};
+
+    const uuid_t& uuid(x.uuid_m);
+    const std::uint32_t values[std::size(zuid_fields_k)] = {
+        uuid.data1_m,    uuid.data2_m,    uuid.data3_m,    uuid.data4_m[0],
+        uuid.data4_m[1], uuid.data4_m[2], uuid.data4_m[3], uuid.data4_m[4],
+        uuid.data4_m[5], uuid.data4_m[6], uuid.data4_m[7]};
+
+    for (std::size_t n(0); n != std::size(values); ++n) {
+        for (int shift(4 * (zuid_fields_k[n].digits_m - 1)); shift >= 0; shift -= 4)
+            *first++ = hex_digits_k[(values[n] >> shift) & 0xf];
+
+        if (zuid_fields_k[n].dash_m)
+            *first++ = '-';
+    }
+
+    return {first, std::errc()};
+}
+
+/**************************************************************************************************/
+
+std::from_chars_result from_chars(const char* first, const char* last, zuid_t& x) {
+    uuid_t uuid;
+    const char* end(parse_uuid(first, last, uuid, true));
+
+    if (!end)
+        return {first, std::errc::invalid_argument};
+
+    x.uuid_m = uuid;
+
+    return {end, std::errc()};
+}
+
+/**************************************************************************************************/
+
 } // namespace adobe
 
 /**************************************************************************************************/
@@ -0,0 +1,143 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+/*
+    Compares the sequenced and parallel overloads of sort with a projection, reduce, transform and
+    for_each on ranges of 1e6 to 1e8 elements, or of the sizes given as arguments.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <adobe/algorithm/for_each.hpp>
+#include <adobe/algorithm/reduce.hpp>
+#include <adobe/algorithm/sort.hpp>
+#include <adobe/algorithm/transform.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t repeat_count_k = 3;
+
+struct record_t {
+    std::uint32_t key_m;
+    float weight_m;
+};
+
+std::vector<record_t> records(std::size_t n) {
+    std::mt19937 generator(42);
+    std::vector<record_t> result(n);
+
+    for (record_t& e : result)
+        e = record_t{static_cast<std::uint32_t>(generator()), float(generator() % 1000) / 10};
+
+    return result;
+}
+
+/*
+    The fastest of repeat_count_k runs of f, in milliseconds, each on a fresh copy of the records
+    when f modifies them.
+*/
+template <typename F>
+double time(const std::vector<record_t>& source, F f) {
+    adobe::timer_t timer;
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        std::vector<record_t> records(source);
+
+        timer.reset();
+        f(records);
+        timer.accrue();
+    }
+
+    return timer.accrued_min();
+}
+
+/// Times the algorithm under both policies, checking that they agree.
+template <typename F>
+void report(const std::string& name, const std::vector<record_t>& source, F f) {
+    decltype(f(adobe::execution::seq, std::declval<std::vector<record_t>&>())) serial, parallel;
+
+    const double serial_time(time(source, [&](std::vector<record_t>& records) {
+        serial = f(adobe::execution::seq, records);
+    }));
+    const double parallel_time(time(source, [&](std::vector<record_t>& records) {
+        parallel = f(adobe::execution::par, records);
+    }));
+
+    if (serial != parallel)
+        throw std::runtime_error(name + ": the policies disagree");
+
+    std::cout << source.size() << " " << name << ": seq " << serial_time << " ms, par "
+              << parallel_time << " ms (" << serial_time / parallel_time << "x)\n";
+}
+
+void benchmark(std::size_t n) {
+    const std::vector<record_t> source(records(n));
+
+    report("sort", source, [](const auto& policy, std::vector<record_t>& records) {
+        adobe::sort(policy, records, std::less<>(), &record_t::key_m);
+        return records[records.size() / 2].key_m;
+    });
+
+    report("reduce", source, [](const auto& policy, std::vector<record_t>& records) {
+        return adobe::reduce(policy, records, std::plus<std::uint64_t>(), &record_t::key_m);
+    });
+
+    report("transform", source, [](const auto& policy, std::vector<record_t>& records) {
+        std::vector<std::uint32_t> keys(records.size());
+
+        adobe::transform(policy, records, keys.begin(),
+                         [](const record_t& x) { return x.key_m * 2654435761u >> 7; });
+        return keys.back();
+    });
+
+    report("for_each", source, [](const auto& policy, std::vector<record_t>& records) {
+        adobe::for_each(policy, records, [](record_t& x) { x.weight_m = x.weight_m * 1.5f + 1; });
+        return records.back().weight_m;
+    });
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main(int argc, char* argv[]) try {
+    std::vector<std::size_t> sizes{1000000, 10000000, 100000000};
+
+    if (argc > 1) {
+        sizes.clear();
+        for (int i(1); i != argc; ++i)
+            sizes.push_back(std::stoul(argv[i]));
+    }
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads\n";
+
+    for (std::size_t n : sizes)
+        benchmark(n);
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+}
+
+/**************************************************************************************************/
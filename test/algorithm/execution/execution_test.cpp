@@ -0,0 +1,158 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/algorithm/for_each.hpp>
+#include <adobe/algorithm/reduce.hpp>
+#include <adobe/algorithm/sort.hpp>
+#include <adobe/algorithm/transform.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+// Large enough to be split into several chunks.
+constexpr std::size_t size_k = adobe::execution::grain_size_k * 16 + 7;
+
+struct record_t {
+    int key_m;
+    std::size_t index_m;
+
+    friend bool operator==(const record_t& x, const record_t& y) {
+        return x.key_m == y.key_m && x.index_m == y.index_m;
+    }
+};
+
+/// Records with few distinct keys, numbered in order, so that a stable sort can be checked.
+std::vector<record_t> records() {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> key(0, 999);
+    std::vector<record_t> result;
+
+    for (std::size_t i(0); i != size_k; ++i)
+        result.push_back(record_t{key(generator), i});
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(execution_sort) {
+    std::vector<record_t> serial(records()), parallel(serial), sequenced(serial);
+
+    adobe::stable_sort(serial, [](const record_t& x, const record_t& y) {
+        return x.key_m > y.key_m;
+    });
+    adobe::stable_sort(adobe::execution::par, parallel, std::greater<>(), &record_t::key_m);
+    adobe::stable_sort(adobe::execution::seq, sequenced, std::greater<>(), &record_t::key_m);
+
+    BOOST_CHECK(parallel == serial);
+    BOOST_CHECK(sequenced == serial);
+
+    std::vector<int> keys, sorted;
+
+    for (const record_t& e : records())
+        keys.push_back(e.key_m);
+
+    sorted = keys;
+    adobe::sort(sorted);
+    adobe::sort(adobe::execution::par, keys);
+
+    BOOST_CHECK(keys == sorted);
+
+    std::vector<record_t> by_key(records());
+
+    adobe::sort(adobe::execution::par, by_key, std::less<>(), &record_t::key_m);
+
+    BOOST_CHECK(std::is_sorted(by_key.begin(), by_key.end(),
+                               [](const record_t& x, const record_t& y) {
+                                   return x.key_m < y.key_m;
+                               }));
+}
+
+BOOST_AUTO_TEST_CASE(execution_reduce) {
+    std::vector<long long> values(size_k);
+
+    for (std::size_t i(0); i != size_k; ++i)
+        values[i] = static_cast<long long>(i);
+
+    const long long n(size_k);
+
+    BOOST_CHECK_EQUAL(adobe::reduce(adobe::execution::par, values, std::plus<long long>()),
+                      n * (n - 1) / 2);
+    BOOST_CHECK_EQUAL(adobe::reduce(adobe::execution::seq, values, std::plus<long long>()),
+                      n * (n - 1) / 2);
+    BOOST_CHECK_EQUAL(adobe::reduce(adobe::execution::par, values.begin(), values.begin() + 10,
+                                    std::multiplies<long long>()),
+                      0);
+
+    // The identity element of the operation starts each chunk.
+
+    BOOST_CHECK_EQUAL(adobe::reduce(adobe::execution::par, values, std::multiplies<long long>(),
+                                    [](long long x) { return x % 2 ? -1 : 1; }),
+                      size_k / 2 % 2 ? -1 : 1);
+
+    // The chunks are combined in order, so the operation need not be commutative.
+
+    std::vector<char> letters(size_k);
+
+    for (std::size_t i(0); i != size_k; ++i)
+        letters[i] = char('a' + i % 26);
+
+    const auto concatenate = [](std::string x, const std::string& y) { return x + y; };
+    const auto to_string = [](char c) { return std::string(1, c); };
+
+    BOOST_CHECK(adobe::reduce(adobe::execution::par, letters.begin(), letters.end(), concatenate,
+                              to_string, std::string()) ==
+                std::string(letters.begin(), letters.end()));
+}
+
+BOOST_AUTO_TEST_CASE(execution_transform) {
+    std::vector<record_t> source(records());
+    std::vector<int> serial(size_k), parallel(size_k);
+
+    adobe::transform(source, serial.begin(), [](const record_t& x) { return x.key_m; });
+
+    BOOST_CHECK(adobe::transform(adobe::execution::par, source, parallel.begin(),
+                                 &record_t::key_m) == parallel.end());
+    BOOST_CHECK(parallel == serial);
+}
+
+BOOST_AUTO_TEST_CASE(execution_for_each) {
+    std::vector<int> values(size_k, 1);
+    std::atomic<long long> sum(0);
+
+    adobe::for_each(adobe::execution::par, values, [](int& x) { x *= 3; });
+    adobe::for_each(adobe::execution::par, values, [&](int x) { sum += x; });
+
+    BOOST_CHECK_EQUAL(sum.load(), static_cast<long long>(size_k) * 3);
+
+    // The first exception is rethrown once the chunks started have finished.
+
+    BOOST_CHECK_THROW(adobe::for_each(adobe::execution::par, values,
+                                      [](int) { throw std::runtime_error("for_each"); }),
+                      std::runtime_error);
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,232 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#define BOOST_TEST_MAIN
+
+// File being tested is included first
+#include <adobe/circular_queue.hpp>
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+typedef adobe::circular_queue<int> queue_t;
+typedef adobe::circular_queue_options_t options_t;
+
+/// Pops every element of the queue, front first.
+template <typename T>
+std::vector<T> drain(adobe::circular_queue<T>& queue) {
+    std::vector<T> result;
+
+    while (!queue.empty()) {
+        result.push_back(std::move(queue.front()));
+        queue.pop_front();
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(circular_queue_overwrite) {
+    queue_t queue(3);
+
+    for (int i(0); i != 5; ++i)
+        queue.push_back(i);
+
+    BOOST_CHECK(queue.full());
+    BOOST_CHECK(drain(queue) == (std::vector<int>{2, 3, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_putback) {
+    queue_t queue(4);
+
+    queue.push_back(1);
+    queue.push_back(2);
+    queue.pop_front();
+    queue.pop_front();
+    queue.putback();
+    queue.putback();
+
+    BOOST_CHECK(drain(queue) == (std::vector<int>{1, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_power_of_two) {
+    queue_t queue(5, options_t::power_of_two);
+
+    BOOST_CHECK_EQUAL(queue.capacity(), 8u);
+
+    // Wrap around several times, through the mask.
+
+    for (int i(0); i != 20; ++i) {
+        queue.push_back(i);
+        if (i % 3 == 0)
+            queue.pop_front();
+    }
+
+    BOOST_CHECK(drain(queue) == (std::vector<int>{12, 13, 14, 15, 16, 17, 18, 19}));
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_emplace) {
+    adobe::circular_queue<std::string> queue(2);
+
+    BOOST_CHECK_EQUAL(queue.emplace_back(3, 'x'), "xxx");
+    queue.emplace_back("y");
+
+    BOOST_CHECK(drain(queue) == (std::vector<std::string>{"xxx", "y"}));
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_push_pop_n) {
+    const int source[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    for (std::size_t capacity : {std::size_t(7), std::size_t(8)}) {
+        queue_t queue(capacity);
+
+        // Start part way round, so that the runs wrap.
+
+        std::vector<int> popped;
+
+        queue.push_n(source, 5);
+        queue.pop_n(std::back_inserter(popped), 4);
+        BOOST_CHECK(popped == (std::vector<int>{0, 1, 2, 3}));
+
+        BOOST_CHECK(queue.push_n(source + 5, 5) == source + 10);
+        BOOST_CHECK_EQUAL(queue.size(), 6u);
+
+        popped.clear();
+        queue.pop_n(std::back_inserter(popped), 6);
+        BOOST_CHECK(popped == (std::vector<int>{4, 5, 6, 7, 8, 9}));
+        BOOST_CHECK(queue.empty());
+
+        // More than the capacity keeps the last elements.
+
+        queue.push_back(-1);
+        queue.push_n(source, 10);
+        BOOST_CHECK(drain(queue) == std::vector<int>(source + 10 - capacity, source + 10));
+
+        // Filling past the front loses the front.
+
+        queue.push_n(source, 5);
+        queue.push_n(source + 5, 5);
+        BOOST_CHECK(drain(queue) == std::vector<int>(source + 10 - capacity, source + 10));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_growable) {
+    queue_t queue(3, options_t::growable | options_t::power_of_two);
+
+    BOOST_CHECK_EQUAL(queue.capacity(), 4u);
+
+    queue.push_back(-2);
+    queue.push_back(-1);
+    queue.pop_front();
+    queue.pop_front();
+
+    for (int i(0); i != 6; ++i)
+        queue.push_back(i);
+
+    BOOST_CHECK_EQUAL(queue.capacity(), 8u);
+
+    const int source[] = {6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    queue.push_n(source, 11);
+
+    BOOST_CHECK_EQUAL(queue.capacity(), 32u);
+
+    std::vector<int> expected;
+
+    for (int i(0); i != 17; ++i)
+        expected.push_back(i);
+
+    BOOST_CHECK(drain(queue) == expected);
+
+    queue_t empty(0, options_t::growable);
+
+    empty.push_back(1);
+
+    BOOST_CHECK_EQUAL(empty.capacity(), 1u);
+    BOOST_CHECK_EQUAL(empty.front(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_grow_self_reference) {
+    // Pushing an element of a full growable queue copies it before the queue grows.
+
+    adobe::circular_queue<std::string> queue(2, options_t::growable);
+    const std::string a(40, 'a'), b(40, 'b');
+
+    queue.push_back(a);
+    queue.push_back(b);
+    queue.push_back(queue.front());
+    queue.push_back(b);
+    queue.emplace_back(queue.front());
+
+    BOOST_CHECK_EQUAL(queue.capacity(), 8u);
+
+    std::vector<std::string> popped;
+
+    queue.pop_n(std::back_inserter(popped), 5);
+
+    BOOST_CHECK(popped == (std::vector<std::string>{a, b, a, b, a}));
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_move_only) {
+    adobe::circular_queue<std::unique_ptr<int>> queue(2, options_t::growable);
+
+    for (int i(0); i != 5; ++i)
+        queue.push_back(std::make_unique<int>(i));
+
+    std::vector<std::unique_ptr<int>> popped;
+
+    queue.pop_n(std::back_inserter(popped), 5);
+
+    for (int i(0); i != 5; ++i)
+        BOOST_CHECK_EQUAL(*popped[i], i);
+
+    adobe::circular_queue<std::unique_ptr<int>> moved(std::move(queue));
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(moved.capacity(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(circular_queue_equality) {
+    queue_t x(4), y(5);
+
+    for (int i(0); i != 6; ++i)
+        x.push_back(i);
+
+    for (int i(2); i != 6; ++i)
+        y.push_back(i);
+
+    BOOST_CHECK(x == y);
+
+    y.pop_front();
+
+    BOOST_CHECK(x != y);
+
+    queue_t z(x);
+
+    BOOST_CHECK(z == x);
+
+    z = y;
+
+    BOOST_CHECK(z == y);
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,116 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#define BOOST_TEST_MAIN
+
+// File being tested is included first
+#include <adobe/spsc_queue.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(spsc_queue_single_thread) {
+    adobe::spsc_queue<std::string> queue(3);
+
+    BOOST_CHECK_EQUAL(queue.capacity(), 4u);
+    BOOST_CHECK(queue.empty());
+
+    for (int i(0); i != 4; ++i)
+        BOOST_CHECK(queue.try_push(std::to_string(i)));
+
+    BOOST_CHECK(!queue.try_emplace(1, 'x'));
+    BOOST_CHECK_EQUAL(queue.size(), 4u);
+
+    std::string x;
+
+    BOOST_CHECK(queue.try_pop(x));
+    BOOST_CHECK_EQUAL(x, "0");
+    BOOST_CHECK(queue.try_emplace(2, 'x'));
+
+    std::vector<std::string> popped(5);
+
+    BOOST_CHECK_EQUAL(queue.try_pop_n(popped.begin(), 5), 4u);
+    BOOST_CHECK(popped == (std::vector<std::string>{"1", "2", "3", "xx", ""}));
+    BOOST_CHECK(!queue.try_pop(x));
+
+    // Elements left in the queue are destroyed with it.
+
+    const std::string source[] = {"a", "b", "c", "d", "e"};
+
+    BOOST_CHECK_EQUAL(queue.try_push_n(source, 5), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(spsc_queue_move_only) {
+    adobe::spsc_queue<std::unique_ptr<int>> queue(2);
+    std::unique_ptr<int> x;
+
+    BOOST_CHECK(queue.try_push(std::make_unique<int>(1)));
+    BOOST_CHECK(queue.try_pop(x));
+    BOOST_CHECK_EQUAL(*x, 1);
+}
+
+BOOST_AUTO_TEST_CASE(spsc_queue_threads) {
+    // A producer streams ints, singly and in runs, to a consumer which checks their order.
+
+    const std::size_t count(1 << 20);
+    adobe::spsc_queue<std::size_t> queue(64);
+    bool in_order(true);
+
+    std::thread consumer([&] {
+        std::size_t buffer[16];
+
+        for (std::size_t next(0); next != count;) {
+            std::size_t n(0);
+
+            if (next % 2)
+                n = queue.try_pop_n(buffer, 16);
+            else if (queue.try_pop(buffer[0]))
+                n = 1;
+
+            for (std::size_t i(0); i != n; ++i)
+                in_order = in_order && buffer[i] == next++;
+
+            if (n == 0)
+                std::this_thread::yield();
+        }
+    });
+
+    for (std::size_t next(0); next != count;) {
+        if (next % 3) {
+            std::size_t buffer[8];
+
+            for (std::size_t i(0); i != 8; ++i)
+                buffer[i] = next + i;
+
+            const std::size_t n(queue.try_push_n(buffer, std::min<std::size_t>(8, count - next)));
+
+            if (n == 0)
+                std::this_thread::yield();
+
+            next += n;
+        } else if (queue.try_push(next)) {
+            ++next;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    BOOST_CHECK(in_order);
+    BOOST_CHECK(queue.empty());
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,318 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+/*
+    Lays out .eve descriptions with stub placeables and writes, as CSV on std::cout, the time taken
+    by evaluate(), adjust() and each phase of the layout so that changes in performance can be
+    tracked. With no arguments the descriptions are generated in a range of shapes and sizes;
+    otherwise each argument names an .eve file to lay out.
+*/
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <adobe/dictionary.hpp>
+#include <adobe/eve.hpp>
+#include <adobe/eve_evaluate.hpp>
+#include <adobe/eve_parser.hpp>
+#include <adobe/name.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+using namespace adobe::literals;
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t repeat_count_k = 5;
+
+/*
+    A placeable with fixed measurements: labels carry a guide at their trailing edge so that
+    labels in sibling rows align, and every view carries a baseline.
+*/
+struct stub_placeable_t {
+    int width_m;
+    int height_m;
+    bool label_m;
+
+    void measure(adobe::extents_t& x) {
+        x.width() = width_m;
+        x.height() = height_m;
+        if (label_m)
+            x.horizontal().guide_set_m.push_back(width_m);
+        if (height_m)
+            x.vertical().guide_set_m.push_back(height_m - 4);
+    }
+
+    void place(const adobe::place_data_t&) {}
+};
+
+/**************************************************************************************************/
+
+/*
+    An eve_t built from an .eve description. Views named after containers are containers, placed
+    as their name suggests unless their parameters say otherwise; every other view is a leaf
+    measured from its name and parameters, the same way on every run.
+*/
+class layout_t {
+public:
+    typedef adobe::eve_t::iterator iterator;
+
+    layout_t(std::istream& stream, const std::string& path) {
+        adobe::parse(stream, adobe::line_position_t(path.c_str()),
+                     adobe::eve_callback_suite_t::position_t(),
+                     adobe::bind_layout(std::bind(&layout_t::add, this, std::placeholders::_1,
+                                                  std::placeholders::_2, std::placeholders::_3),
+                                        sheet_m, sheet_m.machine_m));
+    }
+
+    std::size_t size() const { return placeables_m.size(); }
+
+    adobe::eve_t eve_m;
+
+private:
+    std::any add(const std::any& parent, adobe::name_t name,
+                 const adobe::dictionary_t& parameters) {
+        adobe::layout_attributes_t attributes;
+        stub_placeable_t placeable{80, 22, false};
+        bool container(true);
+        std::string text;
+
+        adobe::get_value(parameters, "name"_name, text);
+
+        const int characters(static_cast<int>(text.size()));
+
+        if (name == "row"_name) {
+            attributes.placement_m = adobe::eve_t::place_row;
+        } else if (name == "overlay"_name) {
+            attributes.placement_m = adobe::eve_t::place_overlay;
+        } else if (name == "column"_name || name == "dialog"_name || name == "group"_name ||
+                   name == "panel"_name) {
+            attributes.placement_m = adobe::eve_t::place_column;
+        } else {
+            container = false;
+        }
+
+        if (container) {
+            adobe::set_margin(attributes, 4);
+            placeable = stub_placeable_t{0, 0, false};
+        } else if (name == "label"_name) {
+            placeable = stub_placeable_t{7 * characters + 6, 16, true};
+        } else if (name == "edit_text"_name) {
+            double width(0);
+            adobe::get_value(parameters, "characters"_name, width);
+            placeable = stub_placeable_t{7 * static_cast<int>(width) + 8, 22, false};
+        } else if (name == "button"_name) {
+            placeable = stub_placeable_t{std::max(70, 7 * characters + 20), 22, false};
+        }
+
+        adobe::apply_layout_parameters(attributes, parameters);
+
+        placeables_m.emplace_back(placeable);
+
+        return eve_m.add_placeable(parent.has_value() ? std::any_cast<iterator>(parent)
+                                                      : iterator(),
+                                   attributes, container, placeables_m.back());
+    }
+
+    adobe::sheet_t sheet_m;
+    std::deque<adobe::poly_placeable_t> placeables_m;
+};
+
+/**************************************************************************************************/
+
+/// A row of a label, aligned with the labels of the rows around it, and an edit field.
+void labeled_row(std::ostream& out, std::size_t n) {
+    out << "row() { label(name: \"" << std::string(4 + n * 7 % 9, 'x') << "\"); "
+        << "edit_text(characters: " << 12 + n * 13 % 7 << "); }\n";
+}
+
+/// A single column of labeled rows.
+void wide(std::ostream& out, std::size_t rows) {
+    for (std::size_t n(0); n != rows; ++n)
+        labeled_row(out, n);
+}
+
+/// Columns nested depth deep, each holding a labeled row and the next column.
+void deep(std::ostream& out, std::size_t depth) {
+    for (std::size_t n(0); n != depth; ++n) {
+        labeled_row(out, n);
+        out << "column() {\n";
+    }
+
+    labeled_row(out, depth);
+
+    for (std::size_t n(0); n != depth; ++n)
+        out << "}\n";
+}
+
+/// A balanced tree, alternating columns and rows, with labeled rows at its leaves.
+void bushy(std::ostream& out, std::size_t depth, std::size_t fan_out, std::size_t& n) {
+    if (depth == 0) {
+        labeled_row(out, n++);
+        return;
+    }
+
+    out << (depth % 2 ? "column() {\n" : "row() {\n");
+
+    for (std::size_t i(0); i != fan_out; ++i)
+        bushy(out, depth - 1, fan_out, n);
+
+    out << "}\n";
+}
+
+void bushy(std::ostream& out, std::size_t depth, std::size_t fan_out) {
+    std::size_t n(0);
+    bushy(out, depth, fan_out, n);
+}
+
+/// The .eve description of a dialog holding the views written by body.
+template <typename F>
+std::string generate(F body) {
+    std::ostringstream result;
+
+    result << "layout benchmark {\nview dialog() {\n";
+    body(result);
+    result << "button(name: \"OK\");\n}\n}\n";
+
+    return result.str();
+}
+
+/**************************************************************************************************/
+
+typedef adobe::eve_t::statistics_t statistics_t;
+
+constexpr std::array<std::pair<const char*, statistics_t::duration_t statistics_t::*>, 5>
+    phases_k{{{"calculate", &statistics_t::calculate_time_m},
+              {"solve", &statistics_t::solve_time_m},
+              {"layout", &statistics_t::layout_time_m},
+              {"flatten", &statistics_t::flatten_time_m},
+              {"place", &statistics_t::place_time_m}}};
+
+double milliseconds(statistics_t::duration_t x) {
+    return std::chrono::duration<double, std::milli>(x).count();
+}
+
+void write_header() {
+    std::cout << "shape,placeables,width,height,load ms,evaluate ms,adjust ms";
+    for (const auto& e : phases_k)
+        std::cout << ',' << e.first << " ms";
+    std::cout << ",solve passes,containers visited\n";
+}
+
+/*
+    Loads the description, then lays it out with evaluate() and with adjust() repeat_count_k times
+    each. Reports the fastest of each, the fastest of each phase of evaluate(), and the work the
+    guide solver did for each evaluate().
+*/
+
+void report(const std::string& shape, std::istream& description) {
+    adobe::timer_t timer;
+    layout_t layout(description, shape);
+    const double load(timer.split());
+
+    adobe::timer_t evaluate_timer;
+    std::array<double, phases_k.size()> phases;
+    phases.fill(-1);
+    std::pair<int, int> size;
+    statistics_t before(layout.eve_m.statistics());
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        const statistics_t start(layout.eve_m.statistics());
+
+        evaluate_timer.reset();
+        size = layout.eve_m.evaluate(adobe::eve_t::evaluate_flat);
+        evaluate_timer.accrue();
+
+        const statistics_t& end(layout.eve_m.statistics());
+
+        for (std::size_t i(0); i != phases.size(); ++i) {
+            const double x(milliseconds(end.*phases_k[i].second - start.*phases_k[i].second));
+            phases[i] = phases[i] < 0 ? x : std::min(phases[i], x);
+        }
+    }
+
+    const statistics_t after(layout.eve_m.statistics());
+
+    if (size.first <= 0 || size.second <= 0)
+        throw std::runtime_error(shape + ": empty layout");
+
+    adobe::timer_t adjust_timer;
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        adjust_timer.reset();
+        layout.eve_m.adjust(adobe::eve_t::evaluate_flat, size.first + 50, size.second + 50);
+        adjust_timer.accrue();
+    }
+
+    std::cout << shape << ',' << layout.size() << ',' << size.first << ',' << size.second << ','
+              << load << ',' << evaluate_timer.accrued_min() << ',' << adjust_timer.accrued_min();
+    for (double e : phases)
+        std::cout << ',' << e;
+    std::cout << ',' << double(after.solve_passes_m - before.solve_passes_m) / repeat_count_k
+              << ',' << double(after.solve_visits_m - before.solve_visits_m) / repeat_count_k
+              << '\n';
+}
+
+template <typename F>
+void report_generated(const std::string& shape, F body) {
+    std::istringstream description(generate(body));
+    report(shape, description);
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main(int argc, char* argv[]) try {
+    write_header();
+
+    if (argc > 1) {
+        for (int n(1); n != argc; ++n) {
+            std::ifstream description(argv[n]);
+
+            if (!description.is_open())
+                throw std::runtime_error(std::string("Could not open file: ") + argv[n]);
+
+            report(argv[n], description);
+        }
+
+        return 0;
+    }
+
+    report_generated("wide 500 rows", [](std::ostream& x) { wide(x, 500); });
+    report_generated("wide 5000 rows", [](std::ostream& x) { wide(x, 5000); });
+    report_generated("deep 300 columns", [](std::ostream& x) { deep(x, 300); });
+    report_generated("deep 2500 columns", [](std::ostream& x) { deep(x, 2500); });
+    report_generated("bushy 4^4", [](std::ostream& x) { bushy(x, 4, 4); });
+    report_generated("bushy 4^6", [](std::ostream& x) { bushy(x, 6, 4); });
+    report_generated("bushy 2^13", [](std::ostream& x) { bushy(x, 13, 2); });
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,458 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/eve.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+/// The measurements of a stub view and a record of what the layout did with it.
+struct view_state_t {
+    int width_m{0};
+    int height_m{0};
+    adobe::guide_set_t horizontal_guides_m;
+    adobe::guide_set_t vertical_guides_m;
+    bool thread_safe_m{false};
+
+    std::size_t measure_count_m{0};
+    std::size_t place_count_m{0};
+    adobe::place_data_t place_m;
+};
+
+struct stub_placeable_t {
+    view_state_t* state_m;
+
+    void measure(adobe::extents_t& x) {
+        ++state_m->measure_count_m;
+        x.width() = state_m->width_m;
+        x.height() = state_m->height_m;
+        x.horizontal().guide_set_m = state_m->horizontal_guides_m;
+        x.vertical().guide_set_m = state_m->vertical_guides_m;
+    }
+
+    void place(const adobe::place_data_t& x) {
+        ++state_m->place_count_m;
+        state_m->place_m = x;
+    }
+
+    bool measure_is_thread_safe() const { return state_m->thread_safe_m; }
+};
+
+/**************************************************************************************************/
+
+/*
+    A dialog of rows, each a label aligned on a common guide followed by an edit field, and a row
+    of buttons aligned right.
+*/
+class dialog_t {
+public:
+    typedef adobe::eve_t::iterator iterator;
+
+    explicit dialog_t(std::size_t rows) {
+        adobe::layout_attributes_t column;
+        column.placement_m = adobe::eve_t::place_column;
+        adobe::set_margin(column, 10);
+
+        root_m = add(iterator(), column, true, 0, 0);
+
+        adobe::layout_attributes_t row;
+        row.placement_m = adobe::eve_t::place_row;
+
+        for (std::size_t n(0); n != rows; ++n) {
+            const iterator parent(add(root_m, row, true, 0, 0));
+            const int label_width(40 + static_cast<int>(n % 7) * 9);
+
+            labels_m.push_back(add(parent, adobe::layout_attributes_t(), false, label_width, 20,
+                                   {label_width}, {15}));
+            add(parent, adobe::layout_attributes_t(), false, 100 + static_cast<int>(n % 5) * 13,
+                24, {}, {18});
+            rows_m.push_back(parent);
+        }
+
+        row.horizontal().alignment_m = adobe::layout_attributes_t::align_right;
+        const iterator buttons(add(root_m, row, true, 0, 0));
+
+        add(buttons, adobe::layout_attributes_t(), false, 80, 22, {}, {16});
+        add(buttons, adobe::layout_attributes_t(), false, 80, 22, {}, {16});
+    }
+
+    iterator add(iterator parent, const adobe::layout_attributes_t& attributes, bool container,
+                 int width, int height, adobe::guide_set_t horizontal = {},
+                 adobe::guide_set_t vertical = {}) {
+        states_m.emplace_back();
+        view_state_t& state(states_m.back());
+
+        state.width_m = width;
+        state.height_m = height;
+        state.horizontal_guides_m = std::move(horizontal);
+        state.vertical_guides_m = std::move(vertical);
+
+        placeables_m.emplace_back(stub_placeable_t{&state});
+        attributes_m.push_back(attributes);
+
+        views_m.push_back(
+            eve_m.add_placeable(parent, attributes, container, placeables_m.back()));
+
+        return views_m.back();
+    }
+
+    view_state_t& state(iterator i) { return states_m[index(i)]; }
+
+    std::size_t index(iterator i) const {
+        return static_cast<std::size_t>(std::find(views_m.begin(), views_m.end(), i) -
+                                        views_m.begin());
+    }
+
+    std::size_t measure_count() const {
+        std::size_t result(0);
+        for (const auto& e : states_m)
+            result += e.measure_count_m;
+        return result;
+    }
+
+    std::size_t place_count() const {
+        std::size_t result(0);
+        for (const auto& e : states_m)
+            result += e.place_count_m;
+        return result;
+    }
+
+    void reset_counts() {
+        for (auto& e : states_m)
+            e.measure_count_m = e.place_count_m = 0;
+    }
+
+    adobe::eve_t eve_m;
+    std::deque<view_state_t> states_m;
+    std::deque<adobe::poly_placeable_t> placeables_m;
+    std::vector<adobe::layout_attributes_t> attributes_m;
+    std::vector<iterator> views_m;
+    iterator root_m;
+    std::vector<iterator> rows_m;
+    std::vector<iterator> labels_m;
+};
+
+/*
+    Checks the views of x were last placed where a full layout of the same dialog places them.
+*/
+void check_same_placement(dialog_t& x, const dialog_t& expected) {
+    BOOST_REQUIRE_EQUAL(x.states_m.size(), expected.states_m.size());
+
+    for (std::size_t n(0); n != x.states_m.size(); ++n)
+        BOOST_CHECK(x.states_m[n].place_m == expected.states_m[n].place_m);
+}
+
+constexpr std::size_t row_count_k = 12;
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_incremental_unchanged) {
+    dialog_t dialog(row_count_k);
+    const std::size_t view_count(dialog.states_m.size());
+
+    const std::pair<int, int> size(dialog.eve_m.evaluate(adobe::eve_t::evaluate_flat));
+
+    BOOST_CHECK_EQUAL(dialog.measure_count(), view_count);
+    BOOST_CHECK_EQUAL(dialog.place_count(), view_count);
+
+    dialog.reset_counts();
+
+    BOOST_CHECK(dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_flat) == size);
+    BOOST_CHECK_EQUAL(dialog.measure_count(), 0u);
+    BOOST_CHECK_EQUAL(dialog.place_count(), 0u);
+
+    // A full evaluation measures and places everything again.
+    BOOST_CHECK(dialog.eve_m.evaluate(adobe::eve_t::evaluate_flat) == size);
+    BOOST_CHECK_EQUAL(dialog.measure_count(), view_count);
+    BOOST_CHECK_EQUAL(dialog.place_count(), view_count);
+
+    // Growing the dialog moves the right aligned buttons but measures nothing.
+    dialog.reset_counts();
+
+    const std::pair<int, int> larger(
+        dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_flat, size.first + 50, 0));
+
+    BOOST_CHECK_EQUAL(larger.first, size.first + 50);
+    BOOST_CHECK_EQUAL(dialog.measure_count(), 0u);
+    BOOST_CHECK(dialog.place_count() != 0);
+
+    dialog_t expected(row_count_k);
+    expected.eve_m.evaluate(adobe::eve_t::evaluate_flat, size.first + 50, 0);
+
+    check_same_placement(dialog, expected);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_incremental_invalidate) {
+    dialog_t dialog(row_count_k);
+    dialog_t expected(row_count_k);
+
+    dialog.eve_m.evaluate(adobe::eve_t::evaluate_flat);
+    dialog.reset_counts();
+
+    // A label narrower than the widest moves only itself.
+    const auto narrow = [](dialog_t& x) {
+        view_state_t& state(x.state(x.labels_m[3]));
+        state.width_m = 30;
+        state.horizontal_guides_m = {30};
+        x.eve_m.invalidate(x.labels_m[3]);
+    };
+
+    narrow(dialog);
+    narrow(expected);
+    dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_flat);
+    expected.eve_m.evaluate(adobe::eve_t::evaluate_flat);
+
+    BOOST_CHECK_EQUAL(dialog.measure_count(), 1u);
+    BOOST_CHECK_EQUAL(dialog.place_count(), 1u);
+    check_same_placement(dialog, expected);
+
+    // The widest label moves the guide, and with it every edit field.
+    const auto widen = [](dialog_t& x) {
+        view_state_t& state(x.state(x.labels_m[5]));
+        state.width_m = 150;
+        state.horizontal_guides_m = {150};
+        x.eve_m.invalidate(x.labels_m[5]);
+    };
+
+    dialog.reset_counts();
+    widen(dialog);
+    widen(expected);
+    dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_flat);
+    expected.eve_m.evaluate(adobe::eve_t::evaluate_flat);
+
+    BOOST_CHECK_EQUAL(dialog.measure_count(), 1u);
+    BOOST_CHECK(dialog.place_count() > row_count_k);
+    check_same_placement(dialog, expected);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_incremental_visibility_and_attributes) {
+    dialog_t dialog(row_count_k);
+
+    dialog.eve_m.evaluate(adobe::eve_t::evaluate_nested);
+
+    for (bool visible : {false, true}) {
+        dialog_t expected(row_count_k);
+
+        dialog.reset_counts();
+        dialog.eve_m.set_visible(dialog.rows_m[4], visible);
+        expected.eve_m.set_visible(expected.rows_m[4], visible);
+
+        dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_nested);
+        expected.eve_m.evaluate(adobe::eve_t::evaluate_nested);
+
+        // Hiding a row measures nothing; showing it measures the row alone.
+        BOOST_CHECK_EQUAL(dialog.measure_count(), visible ? 1u : 0u);
+
+        const std::size_t hidden_first(dialog.index(dialog.rows_m[4]));
+        const std::size_t hidden_last(dialog.index(dialog.rows_m[5]));
+
+        for (std::size_t n(0); n != dialog.states_m.size(); ++n) {
+            // Hidden views keep their last placement.
+            if (visible || n < hidden_first || hidden_last <= n)
+                BOOST_CHECK(dialog.states_m[n].place_m == expected.states_m[n].place_m);
+        }
+    }
+
+    adobe::layout_attributes_t attributes(dialog.attributes_m[dialog.index(dialog.labels_m[2])]);
+    attributes.vertical().alignment_m = adobe::layout_attributes_t::align_bottom;
+
+    dialog_t expected(row_count_k);
+
+    dialog.reset_counts();
+    dialog.eve_m.set_layout_attributes(dialog.labels_m[2], attributes);
+    expected.eve_m.set_layout_attributes(expected.labels_m[2], attributes);
+
+    dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_nested);
+    expected.eve_m.evaluate(adobe::eve_t::evaluate_nested);
+
+    BOOST_CHECK_EQUAL(dialog.measure_count(), 1u);
+    check_same_placement(dialog, expected);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_solve_statistics) {
+    dialog_t dialog(row_count_k);
+
+    dialog.eve_m.evaluate(adobe::eve_t::evaluate_flat);
+
+    const adobe::eve_t::statistics_t first(dialog.eve_m.statistics());
+
+    // Each slice settles in a pass which aligns the guides and at most one which moves nothing.
+    BOOST_CHECK(2 <= first.solve_passes_m && first.solve_passes_m <= 4);
+    BOOST_CHECK(first.solve_visits_m != 0);
+    BOOST_CHECK(first.calculate_time_m + first.solve_time_m + first.layout_time_m +
+                    first.flatten_time_m + first.place_time_m >
+                adobe::eve_t::statistics_t::duration_t::zero());
+
+    // A layout which is reused solves nothing.
+    dialog.eve_m.evaluate_incremental(adobe::eve_t::evaluate_flat);
+
+    BOOST_CHECK_EQUAL(dialog.eve_m.statistics().solve_passes_m, first.solve_passes_m);
+    BOOST_CHECK_EQUAL(dialog.eve_m.statistics().solve_visits_m, first.solve_visits_m);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_concurrent_measure) {
+    dialog_t serial(row_count_k * 8);
+    dialog_t concurrent(row_count_k * 8);
+
+    // Every third view must still be measured in order.
+    for (std::size_t n(0); n != concurrent.states_m.size(); ++n)
+        concurrent.states_m[n].thread_safe_m = n % 3 != 0;
+
+    BOOST_CHECK(!serial.placeables_m[1].measure_is_thread_safe());
+    BOOST_CHECK(concurrent.placeables_m[1].measure_is_thread_safe());
+
+    concurrent.eve_m.set_concurrent_measure(true);
+
+    BOOST_CHECK(concurrent.eve_m.evaluate(adobe::eve_t::evaluate_nested) ==
+                serial.eve_m.evaluate(adobe::eve_t::evaluate_nested));
+    BOOST_CHECK_EQUAL(concurrent.measure_count(), concurrent.states_m.size());
+    check_same_placement(concurrent, serial);
+
+    // Only the invalidated views are measured again.
+    const auto widen = [](dialog_t& x) {
+        for (std::size_t n(0); n < x.labels_m.size(); n += 5) {
+            view_state_t& state(x.state(x.labels_m[n]));
+            state.width_m += 60;
+            state.horizontal_guides_m = {state.width_m};
+            x.eve_m.invalidate(x.labels_m[n]);
+        }
+    };
+
+    concurrent.reset_counts();
+    widen(concurrent);
+    widen(serial);
+
+    BOOST_CHECK(concurrent.eve_m.evaluate_incremental(adobe::eve_t::evaluate_nested) ==
+                serial.eve_m.evaluate(adobe::eve_t::evaluate_nested));
+    BOOST_CHECK_EQUAL(concurrent.measure_count(), (concurrent.labels_m.size() + 4) / 5);
+    check_same_placement(concurrent, serial);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_layout_cache) {
+    auto cache(std::make_shared<adobe::eve_t::layout_cache_t>(4));
+    dialog_t cached(row_count_k);
+    dialog_t expected(row_count_k);
+
+    cached.eve_m.set_layout_cache(cache);
+
+    const std::pair<int, int> size(cached.eve_m.evaluate(adobe::eve_t::evaluate_nested));
+
+    BOOST_CHECK(size == expected.eve_m.evaluate(adobe::eve_t::evaluate_nested));
+    check_same_placement(cached, expected);
+
+    // Alternating between two sizes solves each once and replays it after.
+    for (int n(0); n != 6; ++n) {
+        const int width(size.first + (n % 2 ? 120 : 40));
+        const int height(size.second + (n % 2 ? 10 : 70));
+
+        BOOST_CHECK(cached.eve_m.adjust(adobe::eve_t::evaluate_nested, width, height) ==
+                    expected.eve_m.adjust(adobe::eve_t::evaluate_nested, width, height));
+        check_same_placement(cached, expected);
+    }
+
+    BOOST_CHECK_EQUAL(cached.eve_m.statistics().layout_cache_misses_m, 3u);
+    BOOST_CHECK_EQUAL(cached.eve_m.statistics().layout_cache_hits_m, 4u);
+    BOOST_CHECK_EQUAL(cache->size(), 3u);
+
+    // The same dialog opened again is not solved.
+    dialog_t reopened(row_count_k);
+    reopened.eve_m.set_layout_cache(cache);
+
+    const std::size_t solve_passes(reopened.eve_m.statistics().solve_passes_m);
+
+    BOOST_CHECK(reopened.eve_m.evaluate(adobe::eve_t::evaluate_nested) == size);
+    BOOST_CHECK_EQUAL(reopened.eve_m.statistics().layout_cache_hits_m, 1u);
+    BOOST_CHECK_EQUAL(reopened.eve_m.statistics().solve_passes_m, solve_passes);
+
+    // A view measured differently is a different layout.
+    view_state_t& label(reopened.state(reopened.labels_m[3]));
+    label.width_m += 30;
+    label.horizontal_guides_m = {label.width_m};
+
+    dialog_t widened(row_count_k);
+    view_state_t& widened_label(widened.state(widened.labels_m[3]));
+    widened_label.width_m += 30;
+    widened_label.horizontal_guides_m = {widened_label.width_m};
+
+    BOOST_CHECK(reopened.eve_m.evaluate(adobe::eve_t::evaluate_nested) ==
+                widened.eve_m.evaluate(adobe::eve_t::evaluate_nested));
+    BOOST_CHECK_EQUAL(reopened.eve_m.statistics().layout_cache_misses_m, 1u);
+    check_same_placement(reopened, widened);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(eve_layout_cache_capacity) {
+    auto cache(std::make_shared<adobe::eve_t::layout_cache_t>(2));
+    dialog_t dialog(row_count_k);
+
+    dialog.eve_m.set_layout_cache(cache);
+
+    BOOST_CHECK_EQUAL(cache->capacity(), 2u);
+
+    const std::pair<int, int> size(dialog.eve_m.evaluate(adobe::eve_t::evaluate_flat));
+    const auto adjust = [&](int n) {
+        dialog.eve_m.adjust(adobe::eve_t::evaluate_flat, size.first + n, size.second + n);
+    };
+
+    adjust(10);
+    adjust(20);
+
+    BOOST_CHECK_EQUAL(cache->size(), 2u);
+    BOOST_CHECK_EQUAL(dialog.eve_m.statistics().layout_cache_misses_m, 3u);
+
+    // The layout at size + 10 is the most recently used, so size + 20 is discarded.
+    adjust(10);
+    adjust(30);
+    adjust(10);
+
+    BOOST_CHECK_EQUAL(dialog.eve_m.statistics().layout_cache_hits_m, 2u);
+
+    adjust(20);
+
+    BOOST_CHECK_EQUAL(dialog.eve_m.statistics().layout_cache_misses_m, 5u);
+
+    cache->clear();
+
+    BOOST_CHECK_EQUAL(cache->size(), 0u);
+
+    adjust(10);
+
+    BOOST_CHECK_EQUAL(dialog.eve_m.statistics().layout_cache_misses_m, 6u);
+    BOOST_CHECK_EQUAL(cache->size(), 1u);
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,245 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+/*
+    Compares the exact cover solvers on the sudokus in the file named by the first argument, each
+    searched for up to two solutions to prove it has one, and on counting the solutions to the
+    n-queens problem.
+*/
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <adobe/dancing_links.hpp>
+#include <adobe/exact_cover.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t repeat_count_k = 5;
+
+typedef std::string sudoku_t; // 81 cells, row by row, '1' to '9' or '.' where empty
+
+/*
+    Sets the matrix of the sudoku: a row for each digit a cell may hold, covering the cell and
+    the digit in its row, column and box.
+*/
+
+template <typename Solver>
+void set_sudoku(Solver& solver, const sudoku_t& sudoku) {
+    for (std::size_t cell(0); cell != 81; ++cell) {
+        const std::size_t row(cell / 9), column(cell % 9), box(row / 3 * 3 + column / 3);
+
+        for (std::size_t digit(0); digit != 9; ++digit) {
+            if (sudoku[cell] != '.' && sudoku[cell] != char('1' + digit))
+                continue;
+
+            const std::size_t n(cell * 9 + digit);
+
+            solver.set(n, cell);
+            solver.set(n, 81 + row * 9 + digit);
+            solver.set(n, 162 + column * 9 + digit);
+            solver.set(n, 243 + box * 9 + digit);
+        }
+    }
+}
+
+/// Fills in the sudoku from the rows of a solution, to be checked.
+struct fill_t {
+    void operator()(std::size_t n, bool) const { (*solution_m)[n / 9] = char('1' + n % 9); }
+
+    sudoku_t* solution_m;
+};
+
+bool is_solution(const sudoku_t& sudoku, const sudoku_t& solution) {
+    for (std::size_t i(0); i != 81; ++i) {
+        if (solution[i] == '.' || (sudoku[i] != '.' && sudoku[i] != solution[i]))
+            return false;
+
+        for (std::size_t j(0); j != i; ++j) {
+            const bool same_row(i / 9 == j / 9), same_column(i % 9 == j % 9);
+            const bool same_box(i / 27 == j / 27 && i % 9 / 3 == j % 9 / 3);
+
+            if ((same_row || same_column || same_box) && solution[i] == solution[j])
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**************************************************************************************************/
+
+/// Sets the matrix of the N-queens problem, the diagonals being secondary columns.
+template <typename Solver>
+void set_queens(Solver& solver, std::size_t N) {
+    const std::size_t diagonal_count(N * 2 - 1);
+
+    for (std::size_t i(0); i != N; ++i) {
+        for (std::size_t j(0); j != N; ++j) {
+            solver.set(i * N + j, i);
+            solver.set(i * N + j, N + j);
+            solver.set(i * N + j, N * 2 + i + j);
+            solver.set(i * N + j, N * 2 + diagonal_count + N - 1 - i + j);
+        }
+    }
+
+    for (std::size_t i(0); i != diagonal_count * 2; ++i)
+        solver.set_secondary_column(N * 2 + i);
+}
+
+/**************************************************************************************************/
+
+enum search_t { serial_search_k, parallel_search_k };
+
+template <typename Solver, typename Callback>
+std::size_t search(Solver& solver, search_t search, std::size_t max_solutions, Callback callback) {
+    if constexpr (std::is_same<Solver, adobe::compact_dancing_links_t>::value) {
+        if (search == parallel_search_k) {
+            return solver.parallel_search(
+                max_solutions, callback,
+                adobe::implementation::select_most_constrained_heuristic_t());
+        }
+    }
+
+    return solver.search(max_solutions, callback,
+                         adobe::implementation::select_most_constrained_heuristic_t());
+}
+
+/*
+    Solves every sudoku, looking for a second solution as a solver proving a sudoku has only one
+    would, and returns the number of solutions found.
+*/
+struct sudoku_problem_t {
+    template <typename Solver>
+    std::size_t solve(search_t how) const {
+        std::size_t result(0);
+
+        for (const sudoku_t& sudoku : sudokus_m) {
+            Solver solver(729, 324);
+            sudoku_t solution(81, '.');
+
+            set_sudoku(solver, sudoku);
+
+            const std::size_t count(search(solver, how, 2, fill_t{&solution}));
+
+            if (count == 0 || !is_solution(sudoku, solution))
+                throw std::runtime_error("sudoku not solved: " + sudoku);
+
+            result += count;
+        }
+
+        return result;
+    }
+
+    std::vector<sudoku_t> sudokus_m;
+};
+
+/// Counts the solutions to the N-queens problem.
+struct queens_problem_t {
+    template <typename Solver>
+    std::size_t solve(search_t how) const {
+        Solver solver(N_m * N_m, N_m * 6 - 2);
+
+        set_queens(solver, N_m);
+
+        return search(solver, how, std::numeric_limits<std::size_t>::max(),
+                      adobe::implementation::do_nothing_callback_t());
+    }
+
+    std::size_t N_m;
+};
+
+/**************************************************************************************************/
+
+/*
+    The fastest of repeat_count_k solutions of the problem with the Solver, in milliseconds.
+    Throws unless each finds solution_count solutions.
+*/
+
+template <typename Solver, typename Problem>
+double time(const Problem& problem, search_t how, std::size_t solution_count) {
+    adobe::timer_t timer;
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        timer.reset();
+        const std::size_t count(problem.template solve<Solver>(how));
+        timer.accrue();
+
+        if (count != solution_count)
+            throw std::runtime_error("solvers disagree on the number of solutions");
+    }
+
+    return timer.accrued_min();
+}
+
+template <typename Problem>
+void report(const std::string& name, const Problem& problem) {
+    const std::size_t count(problem.template solve<adobe::dancing_links_t>(serial_search_k));
+    const double baseline(time<adobe::dancing_links_t>(problem, serial_search_k, count));
+
+    const auto line = [&](const char* solver, double x) {
+        std::cout << name << ", " << solver << ": " << x << " ms (" << baseline / x
+                  << "x dancing_links_t)\n";
+    };
+
+    line("dancing_links_t", baseline);
+    line("compact_dancing_links_t",
+         time<adobe::compact_dancing_links_t>(problem, serial_search_k, count));
+    line("compact_dancing_links_t parallel",
+         time<adobe::compact_dancing_links_t>(problem, parallel_search_k, count));
+    line("bitset_exact_cover_t",
+         time<adobe::bitset_exact_cover_t>(problem, serial_search_k, count));
+    line("exact_cover_t", time<adobe::exact_cover_t>(problem, serial_search_k, count));
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main(int argc, char* argv[]) try {
+    if (argc < 2)
+        throw std::runtime_error("usage: exact_cover_benchmark sudokus.txt");
+
+    std::ifstream file(argv[1]);
+
+    if (!file.is_open())
+        throw std::runtime_error(std::string("Could not open file: ") + argv[1]);
+
+    sudoku_problem_t sudokus;
+
+    for (std::string line; std::getline(file, line);) {
+        if (line.size() >= 81)
+            sudokus.sudokus_m.push_back(line.substr(0, 81));
+    }
+
+    if (sudokus.sudokus_m.empty())
+        throw std::runtime_error(std::string("No sudokus in ") + argv[1]);
+
+    report(std::to_string(sudokus.sudokus_m.size()) + " sudokus", sudokus);
+    report("10-queens", queens_problem_t{10});
+    report("11-queens", queens_problem_t{11});
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,254 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/dancing_links.hpp>
+#include <adobe/exact_cover.hpp>
+#include <adobe/future.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t all_k = std::numeric_limits<std::size_t>::max();
+
+/// The number of solutions to the N-queens problem, for N up to 10 (OEIS A000170).
+const std::size_t queens_count_k[] = {1, 1, 0, 0, 2, 10, 4, 40, 92, 352, 724};
+
+/// Sets the matrix of the N-queens problem, the diagonals being secondary columns.
+template <typename Solver>
+void set_queens(Solver& solver, std::size_t N) {
+    const std::size_t diagonal_count(N * 2 - 1);
+
+    for (std::size_t i(0); i != N; ++i) {
+        for (std::size_t j(0); j != N; ++j) {
+            solver.set(i * N + j, i);
+            solver.set(i * N + j, N + j);
+            solver.set(i * N + j, N * 2 + i + j);
+            solver.set(i * N + j, N * 2 + diagonal_count + N - 1 - i + j);
+        }
+    }
+
+    for (std::size_t i(0); i != diagonal_count * 2; ++i)
+        solver.set_secondary_column(N * 2 + i);
+}
+
+template <typename Solver>
+std::size_t count_queens(std::size_t N) {
+    Solver solver(N * N, N * 6 - 2);
+
+    set_queens(solver, N);
+
+    return solver.search(all_k);
+}
+
+/// Records the rows of each solution found.
+struct record_t {
+    void operator()(std::size_t row, bool last) const {
+        rows_m->push_back(row);
+        if (last)
+            rows_m->push_back(all_k);
+    }
+
+    std::vector<std::size_t>* rows_m;
+};
+
+template <typename Solver, typename Heuristic>
+std::vector<std::size_t> queens_solutions(std::size_t N, Heuristic heuristic) {
+    Solver solver(N * N, N * 6 - 2);
+    std::vector<std::size_t> result;
+
+    set_queens(solver, N);
+    solver.search(all_k, record_t{&result}, heuristic);
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+typedef std::string sudoku_t; // 81 cells, row by row, '1' to '9' or '.' where empty
+
+const sudoku_t sudoku_k(
+    ".2.6..9.7..1...5.....3..68...7.9...8.4.....5.9...7.1...56..1.....2...3..1.8..7.9.");
+
+/// Sets the matrix of the sudoku, with a row for each digit a cell may hold.
+template <typename Solver>
+void set_sudoku(Solver& solver, const sudoku_t& sudoku) {
+    for (std::size_t cell(0); cell != 81; ++cell) {
+        const std::size_t row(cell / 9), column(cell % 9), box(row / 3 * 3 + column / 3);
+
+        for (std::size_t digit(0); digit != 9; ++digit) {
+            if (sudoku[cell] != '.' && sudoku[cell] != char('1' + digit))
+                continue;
+
+            const std::size_t n(cell * 9 + digit);
+
+            solver.set(n, cell);
+            solver.set(n, 81 + row * 9 + digit);
+            solver.set(n, 162 + column * 9 + digit);
+            solver.set(n, 243 + box * 9 + digit);
+        }
+    }
+}
+
+struct fill_t {
+    void operator()(std::size_t n, bool) const { (*solution_m)[n / 9] = char('1' + n % 9); }
+
+    sudoku_t* solution_m;
+};
+
+bool is_solution(const sudoku_t& sudoku, const sudoku_t& solution) {
+    for (std::size_t i(0); i != 81; ++i) {
+        if (solution[i] == '.' || (sudoku[i] != '.' && sudoku[i] != solution[i]))
+            return false;
+
+        for (std::size_t j(0); j != i; ++j) {
+            const bool same_row(i / 9 == j / 9), same_column(i % 9 == j % 9);
+            const bool same_box(i / 27 == j / 27 && i % 9 / 3 == j % 9 / 3);
+
+            if ((same_row || same_column || same_box) && solution[i] == solution[j])
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename Solver>
+void check_sudoku() {
+    Solver solver(729, 324);
+    sudoku_t solution(81, '.');
+
+    set_sudoku(solver, sudoku_k);
+
+    BOOST_CHECK_EQUAL(solver.search(2, fill_t{&solution},
+                                    adobe::implementation::select_most_constrained_heuristic_t()),
+                      1u);
+    BOOST_CHECK(is_solution(sudoku_k, solution));
+}
+
+/**************************************************************************************************/
+
+/*
+    Two primary columns, covered by rows 0 and 1 together or by row 3 alone, and a secondary
+    column which rows 0 and 1 give the same color and row 2 another.
+*/
+
+template <typename Solver>
+std::vector<std::size_t> colored_solutions() {
+    Solver solver(4, 3);
+    std::vector<std::size_t> result;
+
+    solver.set(0, 0);
+    solver.set(0, 2, 1);
+    solver.set(1, 1);
+    solver.set(1, 2, 1);
+    solver.set(2, 1);
+    solver.set(2, 2, 2);
+    solver.set(3, 0);
+    solver.set(3, 1);
+    solver.set_secondary_column(2);
+
+    solver.search(all_k, record_t{&result}, adobe::implementation::select_right_heuristic_t());
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(exact_cover_queens) {
+    for (std::size_t N(1); N != 11; ++N) {
+        BOOST_CHECK_EQUAL(count_queens<adobe::bitset_exact_cover_t>(N), queens_count_k[N]);
+        BOOST_CHECK_EQUAL(count_queens<adobe::exact_cover_t>(N), queens_count_k[N]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(exact_cover_solution_order) {
+    // Solutions are found in the order dancing_links_t finds them, with either heuristic.
+
+    for (std::size_t N(4); N != 9; ++N) {
+        const adobe::implementation::select_right_heuristic_t right;
+        const adobe::implementation::select_most_constrained_heuristic_t most_constrained;
+
+        BOOST_CHECK(queens_solutions<adobe::bitset_exact_cover_t>(N, right) ==
+                    queens_solutions<adobe::dancing_links_t>(N, right));
+        BOOST_CHECK(queens_solutions<adobe::bitset_exact_cover_t>(N, most_constrained) ==
+                    queens_solutions<adobe::dancing_links_t>(N, most_constrained));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(exact_cover_max_solutions) {
+    adobe::bitset_exact_cover_t solver(64, 46);
+
+    set_queens(solver, 8);
+
+    BOOST_CHECK_EQUAL(solver.search(5), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(exact_cover_sudoku) {
+    check_sudoku<adobe::bitset_exact_cover_t>();
+    check_sudoku<adobe::exact_cover_t>();
+}
+
+BOOST_AUTO_TEST_CASE(exact_cover_colors) {
+    const std::vector<std::size_t> expected{0, 1, all_k, 3, all_k};
+
+    BOOST_CHECK(colored_solutions<adobe::dancing_links_t>() == expected);
+    BOOST_CHECK(colored_solutions<adobe::bitset_exact_cover_t>() == expected);
+    BOOST_CHECK(colored_solutions<adobe::exact_cover_t>() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(exact_cover_parallel_search_in_task) {
+    /*
+        A task on the adobe::async() pool for each of its threads searches in parallel, so that no
+        thread is free to help and each must finish its search itself.
+    */
+
+    std::vector<std::future<std::size_t>> searches;
+
+    for (unsigned n(0), count(std::max(1u, std::thread::hardware_concurrency())); n != count; ++n) {
+        searches.push_back(adobe::async([] {
+            adobe::compact_dancing_links_t links(64, 46);
+
+            set_queens(links, 8);
+
+            return links.parallel_search(all_k);
+        }));
+    }
+
+    for (std::future<std::size_t>& e : searches) {
+        BOOST_REQUIRE(e.wait_for(std::chrono::seconds(60)) == std::future_status::ready);
+        BOOST_CHECK_EQUAL(e.get(), queens_count_k[8]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(exact_cover_selection) {
+    BOOST_CHECK(adobe::exact_cover_t(100, 94).uses_bitset());
+    BOOST_CHECK(!adobe::exact_cover_t(729, 324).uses_bitset());
+    BOOST_CHECK(!adobe::exact_cover_t(100, 1000).uses_bitset());
+}
+
+/**************************************************************************************************/
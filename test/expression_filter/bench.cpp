@@ -0,0 +1,118 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <adobe/implementation/expression_filter.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t string_count_k = 50000;
+constexpr std::size_t repeat_count_k = 5;
+
+/*
+    Generates the string values of an exported document: mostly plain labels and sentences, some
+    with quotes, markup characters or control characters that need escaping.
+*/
+
+std::vector<std::string> synthetic_strings() {
+    const char* const samples[] = {
+        "Save changes to the document before closing?",
+        "Width",
+        "Use \"smart\" quotes & dashes",
+        "The value must be < 100 and > 0.",
+        "Don't show this message again",
+        "Line one\nLine two\tindented",
+        "A longer description of the option that explains what it does, when it applies, and "
+        "why someone might want to change it from the default value.",
+    };
+
+    std::vector<std::string> result;
+
+    for (std::size_t n(0); n != string_count_k; ++n)
+        result.push_back(std::string(samples[n % std::size(samples)]) + ' ' + std::to_string(n));
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+void report(const char* label, double milliseconds, std::size_t bytes) {
+    std::cout << "    " << label << ": " << milliseconds << " ms, "
+              << bytes / 1024.0 / 1024.0 / (milliseconds / 1000) << " MB/s\n";
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main() try {
+    const std::vector<std::string> strings(synthetic_strings());
+    std::vector<std::string> escaped;
+    std::size_t bytes(0);
+    std::size_t escaped_bytes(0);
+
+    for (const auto& e : strings) {
+        escaped.push_back(adobe::entity_escape(e));
+        bytes += e.size();
+        escaped_bytes += escaped.back().size();
+    }
+
+    std::cout << "Entity filters over " << string_count_k << " strings (" << bytes / 1024
+              << " KB), best of " << repeat_count_k << " runs:\n";
+
+    adobe::timer_t timer;
+    std::size_t count(0);
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        for (const auto& e : strings)
+            count += adobe::needs_entity_escape(e);
+        timer.accrue();
+    }
+    report("needs_entity_escape", timer.accrued_min(), bytes);
+
+    timer.reset_accumulator();
+    timer.reset();
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        for (const auto& e : strings)
+            count += adobe::entity_escape(e).size();
+        timer.accrue();
+    }
+    report("entity_escape", timer.accrued_min(), bytes);
+
+    timer.reset_accumulator();
+    timer.reset();
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        for (std::size_t i(0); i != escaped.size(); ++i) {
+            if (adobe::entity_unescape(escaped[i]) != strings[i])
+                throw std::runtime_error("entity_unescape did not round trip");
+        }
+        timer.accrue();
+    }
+    report("entity_unescape", timer.accrued_min(), escaped_bytes);
+
+    return count == 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+} catch (...) {
+    std::cerr << "Exception: unknown\n";
+    return 1;
+}
@@ -0,0 +1,145 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#define BOOST_TEST_MAIN
+
+// File being tested is included first
+#include <adobe/implementation/expression_filter.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+/// The escaped form of c, byte by byte as the documentation describes it.
+std::string escaped(unsigned char c) {
+    const bool delimiter(c < 0x20 || 0x7F <= c || c == '"' || c == '&' || c == '\'' || c == '<' ||
+                         c == '>');
+
+    if (!delimiter)
+        return std::string(1, char(c));
+
+    try {
+        return '&' + adobe::entity_map_find(std::uint32_t(c)) + ';';
+    } catch (const std::range_error&) {
+        const char* digits("0123456789ABCDEF");
+        return std::string("&#x") + digits[c >> 4] + digits[c & 0x0F] + ';';
+    }
+}
+
+/// The UTF-8 encoding of a code point below 0x800.
+std::string utf8(std::uint32_t code_point) {
+    if (code_point < 0x80)
+        return std::string(1, char(code_point));
+
+    return {char(0xC0 | code_point >> 6), char(0x80 | (code_point & 0x3F))};
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(expression_filter_every_byte) {
+    // A byte is unescaped to the UTF-8 of the Latin-1 code point; the null character is dropped.
+
+    for (std::size_t c(0); c != 256; ++c) {
+        const std::string value(1, char(c));
+        const std::string escape(adobe::entity_escape(value));
+
+        BOOST_CHECK_EQUAL(escape, escaped(static_cast<unsigned char>(c)));
+        BOOST_CHECK_EQUAL(adobe::needs_entity_escape(value), escape != value);
+        BOOST_CHECK_EQUAL(adobe::entity_unescape(escape), c ? utf8(std::uint32_t(c)) : "");
+    }
+
+    std::string all;
+
+    for (std::size_t c(1); c != 0x80; ++c)
+        all += char(c);
+
+    BOOST_CHECK_EQUAL(adobe::entity_unescape(adobe::entity_escape(all)), all);
+}
+
+BOOST_AUTO_TEST_CASE(expression_filter_entities) {
+    BOOST_CHECK_EQUAL(adobe::entity_escape("<a href=\"x\">Tom & Jerry's</a>"),
+                      "&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&apos;s&lt;/a&gt;");
+    BOOST_CHECK_EQUAL(adobe::entity_escape("tab\t\x01 caf\xE9"), "tab&tab;&#x01; caf&eacute;");
+
+    BOOST_CHECK_EQUAL(adobe::entity_unescape("&lt;&amp;&gt; caf&eacute; &euro;5"),
+                      "<&> caf\xC3\xA9 \xE2\x82\xAC" "5");
+    BOOST_CHECK_EQUAL(adobe::entity_unescape("&#x41;&#x3b1;&#65;&#946;"), "A\xCE\xB1" "A\xCE\xB2");
+    BOOST_CHECK_EQUAL(adobe::entity_unescape("no entities"), "no entities");
+
+    BOOST_CHECK_EQUAL(adobe::entity_map_find("amp"), 0x26u);
+    BOOST_CHECK_EQUAL(adobe::entity_map_find("Yuml"), 0x178u);
+    BOOST_CHECK_EQUAL(adobe::entity_map_find("#x20AC"), 0x20ACu);
+    BOOST_CHECK_EQUAL(adobe::entity_map_find("#8364"), 8364u);
+    BOOST_CHECK_EQUAL(adobe::entity_map_find(0xE9), "eacute");
+
+    BOOST_CHECK_THROW(adobe::entity_map_find("nosuchentity"), std::range_error);
+    BOOST_CHECK_THROW(adobe::entity_map_find(std::uint32_t('a')), std::range_error);
+    BOOST_CHECK_THROW(adobe::entity_unescape("a &nosuchentity; b"), std::range_error);
+}
+
+BOOST_AUTO_TEST_CASE(expression_filter_unterminated) {
+    // Everything from an '&' without a following ';' is dropped.
+
+    BOOST_CHECK_EQUAL(adobe::entity_unescape("fish & chips"), "fish ");
+    BOOST_CHECK_EQUAL(adobe::entity_unescape("&amp;&"), "&");
+    BOOST_CHECK_EQUAL(adobe::entity_unescape("&"), "");
+
+    BOOST_CHECK(!adobe::needs_entity_unescape("fish & chips"));
+    BOOST_CHECK(!adobe::needs_entity_unescape("a; then &"));
+    BOOST_CHECK(adobe::needs_entity_unescape("&amp;"));
+}
+
+BOOST_AUTO_TEST_CASE(expression_filter_block_boundaries) {
+    /*
+        Strings are scanned 16 bytes at a time where SSE2 is available; place each delimiter, and
+        each entity, on either side of the block boundaries and across them.
+    */
+
+    const unsigned char delimiters[] = {'"', '&', '\'', '<', '>', '\t', 0x7F, 0x80, 0xE9, 0xFF};
+
+    for (std::size_t size(1); size != 50; ++size) {
+        const std::string plain(size, 'a');
+
+        BOOST_CHECK(!adobe::needs_entity_escape(plain));
+        BOOST_CHECK_EQUAL(adobe::entity_escape(plain), plain);
+
+        for (std::size_t i(0); i != size; ++i) {
+            for (unsigned char c : delimiters) {
+                std::string value(plain);
+                value[i] = char(c);
+
+                const std::string expected(plain.substr(0, i) + escaped(c) +
+                                           plain.substr(i + 1));
+
+                BOOST_CHECK(adobe::needs_entity_escape(value));
+                BOOST_CHECK_EQUAL(adobe::entity_escape(value), expected);
+            }
+
+            std::string value(plain);
+            value.insert(i, "&amp;");
+
+            BOOST_CHECK(adobe::needs_entity_unescape(value));
+            BOOST_CHECK_EQUAL(adobe::entity_unescape(value),
+                              plain.substr(0, i) + '&' + plain.substr(i));
+        }
+    }
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,231 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <adobe/string_hash.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t repeat_count_k = 5;
+constexpr std::size_t corpus_size_k = 16 * 1024 * 1024;
+
+std::uint64_t next_random(std::uint64_t& state) {
+    state += 0x9e3779b97f4a7c15ULL;
+    std::uint64_t z(state);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+std::string random_bytes(std::size_t n, std::uint64_t& state) {
+    std::string result(n, '\0');
+
+    for (auto& c : result)
+        c = static_cast<char>(next_random(state));
+
+    return result;
+}
+
+/*
+    Returns the fastest of repeat_count_k runs of f in milliseconds.
+*/
+
+template <typename F>
+double time(F f) {
+    adobe::timer_t timer;
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        f();
+        timer.accrue();
+    }
+
+    return timer.accrued_min();
+}
+
+/**************************************************************************************************/
+
+/*
+    Hashes corpus_size_k bytes as keys of the given length and reports the throughput in MB/s and
+    the time per key in ns.
+*/
+
+template <typename Hasher>
+void throughput(const char* label, std::size_t length) {
+    std::uint64_t state(length);
+    const std::string corpus(random_bytes(corpus_size_k, state));
+    const std::size_t count(corpus_size_k / length);
+    std::size_t sink(0);
+
+    const double milliseconds(time([&] {
+        for (std::size_t i(0); i != count; ++i)
+            sink += Hasher::hash(corpus.data() + i * length, length);
+    }));
+
+    std::cout << "    " << label << " " << length << " byte keys: "
+              << corpus_size_k / 1024.0 / 1024.0 / (milliseconds / 1000) << " MB/s, "
+              << milliseconds * 1e6 / count << " ns/key" << (sink == 42 ? " " : "") << '\n';
+}
+
+/**************************************************************************************************/
+
+/*
+    Strict avalanche: flipping any one input bit should flip each output bit half of the time.
+    Returns the largest deviation from one half over all input and output bit pairs, for random
+    keys of the given length.
+*/
+
+template <typename Hasher>
+double avalanche_bias(std::size_t length) {
+    constexpr std::size_t sample_count_k = 4000;
+    constexpr std::size_t output_bits_k = sizeof(std::size_t) * 8;
+
+    std::vector<std::size_t> flips(length * 8 * output_bits_k, 0);
+    std::uint64_t state(0x5eed);
+
+    for (std::size_t n(0); n != sample_count_k; ++n) {
+        std::string key(random_bytes(length, state));
+        const std::size_t hash(Hasher::hash(key.data(), key.size()));
+
+        for (std::size_t bit(0); bit != length * 8; ++bit) {
+            key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+            const std::size_t diff(hash ^ Hasher::hash(key.data(), key.size()));
+            key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+
+            for (std::size_t out(0); out != output_bits_k; ++out)
+                flips[bit * output_bits_k + out] += (diff >> out) & 1;
+        }
+    }
+
+    double result(0);
+
+    for (std::size_t e : flips)
+        result = std::max(result, std::abs(double(e) / sample_count_k - 0.5));
+
+    return result;
+}
+
+/*
+    Hashes closely related keys, as identifiers tend to be, into buckets selected by the low bits
+    of the hash, as a power of two table would, and by the hash modulo a prime, as closed_hash
+    does. Returns the larger of the two chi-squared statistics divided by its expected value, about
+    1 for a uniform hash.
+*/
+
+template <typename Hasher>
+double bucket_chi_squared() {
+    constexpr std::size_t bucket_count_k = 4096;
+    constexpr std::size_t prime_k = 4093;
+    constexpr std::size_t key_count_k = 64 * bucket_count_k;
+
+    std::vector<std::size_t> masked(bucket_count_k, 0);
+    std::vector<std::size_t> modulo(prime_k, 0);
+
+    for (std::size_t i(0); i != key_count_k; ++i) {
+        const std::string key("name_" + std::to_string(i));
+        const std::size_t hash(Hasher::hash(key.data(), key.size()));
+
+        ++masked[hash & (bucket_count_k - 1)];
+        ++modulo[hash % prime_k];
+    }
+
+    auto chi_squared = [](const std::vector<std::size_t>& buckets) {
+        const double expected(double(key_count_k) / buckets.size());
+        double sum(0);
+
+        for (std::size_t e : buckets)
+            sum += (e - expected) * (e - expected) / expected;
+
+        return sum / (buckets.size() - 1);
+    };
+
+    return std::max(chi_squared(masked), chi_squared(modulo));
+}
+
+/*
+    Counts the collisions of the hashes truncated to 32 bits over a million related keys; about
+    116 are expected of a uniform hash.
+*/
+
+template <typename Hasher>
+std::size_t collisions_32() {
+    constexpr std::size_t key_count_k = 1024 * 1024;
+
+    std::vector<std::uint32_t> hashes;
+    hashes.reserve(key_count_k);
+
+    for (std::size_t i(0); i != key_count_k; ++i) {
+        const std::string key("/path/to/resource/" + std::to_string(i * 7919) + ".png");
+        hashes.push_back(static_cast<std::uint32_t>(Hasher::hash(key.data(), key.size())));
+    }
+
+    std::sort(hashes.begin(), hashes.end());
+
+    return hashes.size() - static_cast<std::size_t>(std::unique(hashes.begin(), hashes.end()) -
+                                                    hashes.begin());
+}
+
+/**************************************************************************************************/
+
+/*
+    Reports the speed and distribution of a hasher. If check is set, a hash which fails a
+    distribution check it is expected to pass throws.
+*/
+
+template <typename Hasher>
+void report(const char* label, bool check) {
+    std::cout << label << ":\n";
+
+    for (std::size_t length : {4, 8, 16, 32, 64, 256, 4096})
+        throughput<Hasher>(label, length);
+
+    const double avalanche_8(avalanche_bias<Hasher>(8));
+    const double avalanche_24(avalanche_bias<Hasher>(24));
+    const double chi_squared(bucket_chi_squared<Hasher>());
+    const std::size_t collisions(collisions_32<Hasher>());
+
+    std::cout << "    worst avalanche bias, 8 byte keys: " << avalanche_8
+              << ", 24 byte keys: " << avalanche_24 << '\n'
+              << "    bucket chi-squared / expected: " << chi_squared << '\n'
+              << "    32 bit collisions in 2^20 keys: " << collisions << '\n';
+
+    if (check && (avalanche_8 > 0.05 || avalanche_24 > 0.05 || chi_squared > 1.2 ||
+                  collisions > 250))
+        throw std::runtime_error(std::string(label) + " failed a distribution check");
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main() try {
+    // FNV-1a is known not to avalanche its last byte, so it is only reported.
+    report<adobe::fnv1a_hasher_t>("fnv1a", false);
+    report<adobe::fnv1a_words_hasher_t>("fnv1a_words", true);
+    report<adobe::wyhash_hasher_t>("wyhash", true);
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+}
+
+/**************************************************************************************************/
@@ -8,6 +8,9 @@
 
 // stdc++
 #include <iostream>
+#include <set>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #define BOOST_TEST_MAIN
@@ -16,7 +19,14 @@
 #include <boost/test/unit_test.hpp>
 
 // asl
+#include <adobe/closed_hash.hpp>
 #include <adobe/fnv.hpp>
+#include <adobe/functional.hpp>
+#include <adobe/implementation/string_pool.hpp>
+#include <adobe/name.hpp>
+#include <adobe/string_hash.hpp>
+#include <adobe/table_index.hpp>
+#include <adobe/wyhash.hpp>
 
 /******************************************************************************/
 
@@ -225,3 +235,102 @@ BOOST_AUTO_TEST_CASE(fnv_smoke) {
 }
 
 /******************************************************************************/
+
+// The word at a time and wyhash hashes fold at compile time.
+static_assert(adobe::fnv1a_words<64>("hello, world", 12) !=
+              adobe::fnv1a_words<64>("hello, world", 11));
+static_assert(adobe::wyhash("hello, world") != adobe::wyhash("hello, world", 1));
+static_assert(adobe::fnv1a_hasher_t()("") == adobe::detail::name_hash(""));
+
+/******************************************************************************/
+
+template <typename Hasher>
+void string_hash_test() {
+    std::string text;
+    std::set<std::size_t> hashes;
+
+    // Every length across the word, tail and block boundaries hashes differently, and the runtime
+    // hash matches the constexpr one.
+    for (std::size_t n(0); n != 200; ++n) {
+        const std::size_t hash(Hasher::hash(text.data(), text.size()));
+
+        BOOST_CHECK(hashes.insert(hash).second);
+        BOOST_CHECK_EQUAL(hash, Hasher()(text));
+
+        text += static_cast<char>('a' + n * 7 % 26);
+    }
+
+    // Flipping the high bit of two bytes a word apart must not cancel out.
+    std::string flipped(text.substr(0, 32));
+    const std::size_t hash(Hasher()(flipped));
+
+    flipped[7] ^= '\x80';
+    flipped[15] ^= '\x80';
+    BOOST_CHECK_NE(hash, Hasher()(flipped));
+}
+
+BOOST_AUTO_TEST_CASE(fnv_string_hashers) {
+    constexpr std::string_view key("a longer key, spanning several words, for the hashers");
+
+    static_assert(adobe::fnv1a_hasher_t()(key) == adobe::fnv1a<sizeof(std::size_t) * 8>(key));
+    static_assert(adobe::fnv1a_words_hasher_t()(key) ==
+                  adobe::fnv1a_words<sizeof(std::size_t) * 8>(key.data(), key.size()));
+    static_assert(adobe::wyhash_hasher_t()(key) == static_cast<std::size_t>(adobe::wyhash(key)));
+
+    string_hash_test<adobe::fnv1a_hasher_t>();
+    string_hash_test<adobe::fnv1a_words_hasher_t>();
+    string_hash_test<adobe::wyhash_hasher_t>();
+
+    constexpr std::uint32_t hello(adobe::fnv1a_words<32>("hello", 5));
+
+    BOOST_CHECK_EQUAL(hello, adobe::fnv1a_words<32>(std::string("hello").data(), 5));
+    BOOST_CHECK_NE(adobe::wyhash(key, 0), adobe::wyhash(key, 1));
+}
+
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(fnv_hasher_policies) {
+    // The policies hash the keys of the hash containers.
+    adobe::closed_hash_set<std::string, adobe::identity<const std::string>, adobe::wyhash_hasher_t>
+        set;
+
+    for (int i(0); i != 1000; ++i)
+        set.insert("key_" + std::to_string(i));
+
+    BOOST_CHECK_EQUAL(set.size(), 1000u);
+    BOOST_CHECK(set.find("key_999") != set.end());
+    BOOST_CHECK(set.find("key_1000") == set.end());
+
+    adobe::closed_hash_map<std::string, int, adobe::fnv1a_words_hasher_t> map;
+
+    map["one"] = 1;
+    map["two"] = 2;
+    BOOST_CHECK_EQUAL(map["two"], 2);
+
+    struct cell_t {
+        std::string name_m;
+        int value_m;
+    };
+
+    std::vector<cell_t> cells{{"alpha", 1}, {"beta", 2}, {"gamma", 3}};
+    adobe::hash_index<cell_t, adobe::wyhash_hasher_t, std::equal_to<std::string>,
+                      adobe::mem_data_t<cell_t, const std::string>>
+        index(adobe::wyhash_hasher_t(), std::equal_to<std::string>(), &cell_t::name_m);
+
+    for (auto& e : cells)
+        index.insert(e);
+
+    BOOST_CHECK_EQUAL(index.find("beta")->value_m, 2);
+
+    // A string pool indexed with a policy's hash gives one string for equal strings.
+    adobe::unique_string_pool_t pool(&adobe::wyhash_hasher_t::hash);
+    const std::string name("pooled name");
+    const void* pooled(pool.add(name.c_str()));
+
+    BOOST_CHECK_EQUAL(pooled, static_cast<const void*>(pool.add(std::string(name).c_str())));
+    BOOST_CHECK_EQUAL(pooled, static_cast<const void*>(pool.add(
+                                  name.c_str(), adobe::wyhash_hasher_t()(name), false)));
+    BOOST_CHECK_NE(pooled, static_cast<const void*>(name.c_str()));
+}
+
+/******************************************************************************/
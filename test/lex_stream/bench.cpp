@@ -0,0 +1,152 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <adobe/adam_parser.hpp>
+#include <adobe/implementation/lex_shared_fwd.hpp>
+#include <adobe/implementation/lex_stream.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+/*
+    Generates a property model source of roughly `size` bytes by repeating a sheet that exercises
+    every token class: comments, strings, hex and decimal numbers, operators, and identifiers.
+*/
+
+std::string synthetic_adam_source(std::size_t size) {
+    std::string result;
+    result.reserve(size + 1024);
+
+    for (std::size_t n(0); result.size() < size; ++n) {
+        const std::string i(std::to_string(n));
+
+        result += "/*\n    Sheet " + i + " - a synthetic benchmark sheet.\n*/\n";
+        result += "sheet bench_" + i + "\n{\n";
+        result += "interface:\n";
+        result += "    unlink width_" + i + " : 0x1F0 <== height_" + i + " * ratio_" + i +
+                  "; // trailing comment\n";
+        result += "    height_" + i + " : 240.5;\n";
+        result += "input:\n";
+        result += "    label_" + i + " : \"a string value\" 'concatenated';\n";
+        result += "    ratio_" + i + " : 1.333;\n";
+        result += "logic:\n";
+        result += "    when (width_" + i + " >= 10 && height_" + i + " != 0) relate {\n";
+        result += "        width_" + i + " <== height_" + i + " * ratio_" + i + ";\n";
+        result += "        height_" + i + " <== width_" + i + " / ratio_" + i + ";\n";
+        result += "    }\n";
+        result += "output:\n";
+        result += "    result_" + i + " <== { width: width_" + i + ", height: height_" + i +
+                  ", tags: [@alpha, @beta, empty, true] };\n";
+        result += "invariant:\n";
+        result += "    valid_" + i + " <== width_" + i + " <= 4096 || !(height_" + i +
+                  " < 0) ? true : false;\n";
+        result += "}\n\n";
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+template <typename Lex>
+std::size_t count_tokens(Lex& lex) {
+    std::size_t result(0);
+
+    while (lex.get().first != adobe::eof_k)
+        ++result;
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+void report(const char* label, double milliseconds, std::size_t bytes, std::size_t count) {
+    const double megabytes(static_cast<double>(bytes) / (1024 * 1024));
+
+    std::cout << label << ": " << milliseconds << " ms, " << megabytes / (milliseconds / 1e3)
+              << " MB/s (" << count << ")\n";
+}
+
+/**************************************************************************************************/
+
+adobe::adam_callback_suite_t counting_callbacks(std::size_t& count) {
+    adobe::adam_callback_suite_t result;
+
+    result.add_cell_proc_m = [&](auto&&...) { ++count; };
+    result.add_relation_proc_m = [&](auto&&...) { ++count; };
+    result.add_interface_proc_m = [&](auto&&...) { ++count; };
+    result.add_external_proc_m = [&](auto&&...) { ++count; };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main() try {
+    const std::string source(synthetic_adam_source(10 * 1024 * 1024));
+    const adobe::line_position_t position("synthetic");
+
+    std::cout << "Lexing " << source.size() << " bytes:\n";
+
+    {
+        std::istringstream stream(source);
+        adobe::lex_stream_t lex(stream, position);
+        adobe::timer_t timer;
+        std::size_t count(count_tokens(lex));
+        report("    stream tokens", timer.split(), source.size(), count);
+    }
+
+    {
+        adobe::lex_stream_t lex(std::string_view(source), position);
+        adobe::timer_t timer;
+        std::size_t count(count_tokens(lex));
+        report("    buffer tokens", timer.split(), source.size(), count);
+    }
+
+    std::cout << "Parsing:\n";
+
+    {
+        std::size_t count(0);
+        std::istringstream stream(source);
+        adobe::timer_t timer;
+        adobe::parse(stream, position, counting_callbacks(count));
+        report("    stream cells", timer.split(), source.size(), count);
+    }
+
+    {
+        std::size_t count(0);
+        adobe::timer_t timer;
+        adobe::parse(std::string_view(source), position, counting_callbacks(count));
+        report("    buffer cells", timer.split(), source.size(), count);
+    }
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Error: " << error.what() << '\n';
+
+    return 1;
+} catch (...) {
+    std::cerr << "Error: unknown\n";
+
+    return 1;
+}
+
+/**************************************************************************************************/
@@ -20,10 +20,8 @@ using namespace std;
 
 /**************************************************************************************************/
 
-void exception_test(const char* const expression, const adobe::line_position_t& expression_position,
-                    int expected_line_number, std::streampos expected_character_position) {
-    istringstream expression_stream(expression);
-    lex_stream_t lex(expression_stream, expression_position);
+void exception_test(lex_stream_t& lex, int expected_line_number,
+                    std::streampos expected_character_position) {
     bool caught(false);
     try {
         auto token = lex.get();
@@ -40,6 +38,16 @@ void exception_test(const char* const expression, const adobe::line_position_t&
     BOOST_REQUIRE(caught);
 }
 
+void exception_test(const char* const expression, const adobe::line_position_t& expression_position,
+                    int expected_line_number, std::streampos expected_character_position) {
+    istringstream expression_stream(expression);
+    lex_stream_t stream_lex(expression_stream, expression_position);
+    exception_test(stream_lex, expected_line_number, expected_character_position);
+
+    lex_stream_t buffer_lex(std::string_view(expression), expression_position);
+    exception_test(buffer_lex, expected_line_number, expected_character_position);
+}
+
 /**************************************************************************************************/
 
 BOOST_AUTO_TEST_CASE(lex_stream_eof_in_string) {
@@ -74,3 +82,36 @@ BOOST_AUTO_TEST_CASE(lex_stream_unexpected_character) {
 }
 
 /**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(lex_stream_buffer_matches_stream) {
+    const line_position_t expression_position{__FILE__, __LINE__ + 1};
+    constexpr const char* expression = R"(
+        /* lead
+           comment */
+        sheet my_sheet { // trail comment
+            x : 0x1F + 12.5 * .5 <== [ "one" 'two', @name, true ] ;
+            y <== x >= 3 && x <= 4 || x != 5 ? x << 2 : x >> 1 ;
+        }
+        1.2.3 _id2 )";
+
+    istringstream expression_stream(expression);
+    lex_stream_t stream_lex(expression_stream, expression_position);
+    lex_stream_t buffer_lex(std::string_view(expression), expression_position);
+
+    while (true) {
+        const stream_lex_token_t expected = stream_lex.get();
+        const line_position_t expected_position = stream_lex.next_position();
+        const stream_lex_token_t actual = buffer_lex.get();
+        const line_position_t actual_position = buffer_lex.next_position();
+
+        BOOST_REQUIRE_EQUAL(expected.first, actual.first);
+        BOOST_REQUIRE(expected.second == actual.second);
+        BOOST_REQUIRE_EQUAL(expected_position.line_number_m, actual_position.line_number_m);
+        BOOST_REQUIRE_EQUAL(expected_position.position_m, actual_position.position_m);
+
+        if (expected.first == eof_k)
+            break;
+    }
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,111 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/md5.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+std::string to_string(const adobe::md5_t::digest_t& digest) {
+    std::ostringstream result;
+
+    for (auto e : digest)
+        result << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(e);
+
+    return result.str();
+}
+
+std::string md5(const std::string& x) { return to_string(adobe::md5(x.data(), x.size())); }
+
+std::string content(std::size_t size, std::uint32_t seed) {
+    std::string result(size, '\0');
+
+    for (auto& c : result) {
+        seed = seed * 1664525 + 1013904223;
+        c = static_cast<char>(seed >> 24);
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(md5_rfc1321) {
+    BOOST_CHECK_EQUAL(md5(""), "d41d8cd98f00b204e9800998ecf8427e");
+    BOOST_CHECK_EQUAL(md5("a"), "0cc175b9c0f1b6a831c399e269772661");
+    BOOST_CHECK_EQUAL(md5("abc"), "900150983cd24fb0d6963f7d28e17f72");
+    BOOST_CHECK_EQUAL(md5("message digest"), "f96b697d7cb7938d525a2f31aaf161d0");
+    BOOST_CHECK_EQUAL(md5("abcdefghijklmnopqrstuvwxyz"), "c3fcd3d76192e4007dfb496cca67e13b");
+    BOOST_CHECK_EQUAL(md5("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"),
+                      "d174ab98d277d9f5a5611c2c9f419d9f");
+    BOOST_CHECK_EQUAL(md5("1234567890123456789012345678901234567890123456789012345678901234567890"
+                          "1234567890"),
+                      "57edf4a22be3c955ac49da2e2107b67a");
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(md5_update) {
+    const std::string text(content(1000, 1));
+    const std::string expected(md5(text));
+
+    // Splitting the input anywhere gives the same digest.
+    for (std::size_t step : {1, 7, 63, 64, 65, 200, 999}) {
+        adobe::md5_t m;
+
+        for (std::size_t i(0); i < text.size(); i += step)
+            m.update(text.data() + i, std::min(step, text.size() - i));
+
+        BOOST_CHECK_EQUAL(to_string(m.final()), expected);
+    }
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(md5_digest_each) {
+    // Messages of every length around the padding boundaries, in batches of every size.
+    std::vector<std::string> messages;
+
+    for (std::size_t size(0); size != 200; ++size)
+        messages.push_back(content(size, static_cast<std::uint32_t>(size)));
+    messages.push_back(content(5000, 7));
+
+    for (std::size_t count : {0, 1, 2, 9, 64, 65, 201}) {
+        const std::vector<std::string_view> views(messages.begin(), messages.begin() + count);
+        std::vector<adobe::md5_t::digest_t> digests;
+
+        adobe::md5_t::digest_each(views.begin(), views.end(), std::back_inserter(digests));
+
+        BOOST_REQUIRE_EQUAL(digests.size(), count);
+
+        for (std::size_t i(0); i != count; ++i)
+            BOOST_CHECK_EQUAL(to_string(digests[i]), md5(messages[i]));
+    }
+}
+
+/**************************************************************************************************/
@@ -11,6 +11,8 @@
 
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <type_traits>
 
 /**************************************************************************************************/
 
@@ -18,14 +20,20 @@ namespace {
 
 /**************************************************************************************************/
 
-std::size_t dancing_queens(std::size_t N) {
+/// The number of solutions to the N-queens problem, for N up to 12 (OEIS A000170).
+const std::size_t solution_count_k[] = {1, 1, 0, 0, 2, 10, 4, 40, 92, 352, 724, 2680, 14200};
+
+enum search_t { serial_search_k, parallel_search_k };
+
+template <typename DancingLinks>
+std::size_t dancing_queens(std::size_t N, search_t search) {
     const std::size_t diag_count = N * 2 - 1;
     const std::size_t cols_k = N * 2 + diag_count * 2;
     const std::size_t rows_k = N * N;
     const std::size_t file_base = N;
     const std::size_t diagonals_base = file_base + N;
     const std::size_t rdiagonals_base = diagonals_base + diag_count;
-    adobe::dancing_links_t links(rows_k, cols_k);
+    DancingLinks links(rows_k, cols_k);
     std::size_t row_index(0);
 
     // std::cout << "total rows: " << rows_k << ", cols: " << cols_k << std::endl;
@@ -58,18 +66,30 @@ std::size_t dancing_queens(std::size_t N) {
         }
     }
 
+    if constexpr (std::is_copy_constructible<typename DancingLinks::toroid_t>::value) {
+        if (search == parallel_search_k)
+            return links.parallel_search(std::numeric_limits<std::size_t>::max());
+    }
+
     return links.search(std::numeric_limits<std::size_t>::max());
 }
 
 /**************************************************************************************************/
 
-void dancing_queen_iteration(std::size_t N) {
+template <typename DancingLinks>
+double dancing_queen_iteration(const char* name, std::size_t N, search_t search) {
     adobe::timer_t timer;
-    std::size_t solutions(dancing_queens(N));
+    std::size_t solutions(dancing_queens<DancingLinks>(N, search));
     double time(timer.split());
 
-    std::cout << "Found " << solutions << " solutions to the " << N << "-queens problem in " << time
-              << " miliseconds (" << (time / 1e3) << " seconds )\n";
+    std::cout << name << ": found " << solutions << " solutions to the " << N
+              << "-queens problem in " << time << " miliseconds (" << (time / 1e3)
+              << " seconds )\n";
+
+    if (solutions != solution_count_k[N])
+        throw std::runtime_error("wrong number of solutions");
+
+    return time;
 }
 
 /**************************************************************************************************/
@@ -79,8 +99,17 @@ void dancing_queen_iteration(std::size_t N) {
 /**************************************************************************************************/
 
 int main() try {
-    for (std::size_t i(1); i <= 10; ++i)
-        dancing_queen_iteration(i);
+    for (std::size_t i(1); i <= 12; ++i) {
+        const double byte(dancing_queen_iteration<adobe::dancing_links_t>("byte toroid", i,
+                                                                        serial_search_k));
+        const double compact(dancing_queen_iteration<adobe::compact_dancing_links_t>(
+            "compact toroid", i, serial_search_k));
+        const double parallel(dancing_queen_iteration<adobe::compact_dancing_links_t>(
+            "compact toroid, parallel", i, parallel_search_k));
+
+        std::cout << "speedup over byte toroid: compact " << byte / compact << ", parallel "
+                  << byte / parallel << "\n\n";
+    }
 
     return 0;
 } catch (std::exception& error) {
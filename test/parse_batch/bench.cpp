@@ -0,0 +1,231 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <any>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adobe/adam.hpp>
+#include <adobe/adam_evaluate.hpp>
+#include <adobe/adam_parser.hpp>
+#include <adobe/eve_parser.hpp>
+#include <adobe/parse_batch.hpp>
+#include <adobe/parse_cache.hpp>
+#include <adobe/timer.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t file_count_k = 400;
+
+/*
+    Generates the property model for one dialog. Each file has its own cell names, as an
+    application's dialogs would.
+*/
+
+std::string synthetic_adam_file(std::size_t file) {
+    const std::string f(std::to_string(file));
+    std::string result("sheet dialog_" + f + "\n{\n");
+
+    result += "interface:\n";
+    for (std::size_t n(0); n != 20; ++n) {
+        const std::string i(f + "_" + std::to_string(n));
+        result += "    width_" + i + " : " + std::to_string(n * 10) + "; // width\n";
+        result += "    height_" + i + " : 240.5;\n";
+    }
+
+    result += "logic:\n";
+    for (std::size_t n(0); n != 20; ++n) {
+        const std::string i(f + "_" + std::to_string(n));
+        result += "    relate {\n";
+        result += "        width_" + i + " <== height_" + i + " * 1.5;\n";
+        result += "        height_" + i + " <== width_" + i + " / 1.5;\n";
+        result += "    }\n";
+    }
+
+    result += "output:\n";
+    for (std::size_t n(0); n != 20; ++n) {
+        const std::string i(f + "_" + std::to_string(n));
+        result += "    result_" + i + " <== { width: width_" + i + ", height: height_" + i +
+                  ", tags: [@alpha, @beta, empty, true] };\n";
+    }
+
+    result += "}\n";
+
+    return result;
+}
+
+/*
+    Generates the layout for one dialog, a few levels of nested containers of buttons.
+*/
+
+std::string synthetic_eve_file(std::size_t file) {
+    std::string result("layout dialog_" + std::to_string(file) + "\n{\n");
+
+    result += "    view dialog(name: \"Dialog\", placement: place_column)\n    {\n";
+    for (std::size_t n(0); n != 10; ++n) {
+        result += "        row(spacing: 5, horizontal: align_fill)\n        {\n";
+        for (std::size_t m(0); m != 4; ++m) {
+            result += "            button(name: \"Button " + std::to_string(m) +
+                      "\", action: @ok, bind: @value_" + std::to_string(n) + ");\n";
+        }
+        result += "            edit_number(name: \"Value\", digits: 8, bind: @value_" +
+                  std::to_string(n) + ");\n";
+        result += "        }\n";
+    }
+    result += "    }\n}\n";
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+adobe::eve_callback_suite_t counting_callbacks(std::size_t& count) {
+    adobe::eve_callback_suite_t result;
+
+    result.add_view_proc_m = [&](const std::any& parent, auto&&...) {
+        ++count;
+        return parent;
+    };
+    result.add_cell_proc_m = [&](auto&&...) { ++count; };
+    result.add_relation_proc_m = [&](auto&&...) { ++count; };
+    result.add_interface_proc_m = [&](auto&&...) { ++count; };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+void report(const char* label, double milliseconds, double baseline) {
+    std::cout << "    " << label << ": " << milliseconds << " ms";
+    if (baseline != 0)
+        std::cout << " (" << baseline / milliseconds << "x)";
+    std::cout << '\n';
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main() try {
+    std::vector<std::string> adam_text;
+    std::vector<std::string> eve_text;
+    std::vector<adobe::parse_source_t> adam_sources;
+    std::vector<adobe::parse_source_t> eve_sources;
+    std::size_t bytes(0);
+
+    for (std::size_t n(0); n != file_count_k; ++n) {
+        adam_text.push_back(synthetic_adam_file(n));
+        eve_text.push_back(synthetic_eve_file(n));
+        bytes += adam_text.back().size() + eve_text.back().size();
+    }
+
+    for (std::size_t n(0); n != file_count_k; ++n) {
+        adam_sources.push_back({adam_text[n], adobe::line_position_t("dialog.adm")});
+        eve_sources.push_back({eve_text[n], adobe::line_position_t("dialog.eve")});
+    }
+
+    std::cout << "Startup parse of " << file_count_k << " Adam and " << file_count_k
+              << " Eve sources (" << bytes / 1024 << " KB) on "
+              << std::thread::hardware_concurrency() << " threads:\n";
+
+    double sequential(0);
+
+    {
+        std::size_t count(0);
+        adobe::timer_t timer;
+
+        for (const auto& source : adam_sources) {
+            adobe::sheet_t sheet;
+            adobe::parse(source.text_m, source.position_m, adobe::bind_to_sheet(sheet));
+        }
+        for (const auto& source : eve_sources)
+            adobe::parse(source.text_m, source.position_m, std::any(), counting_callbacks(count));
+
+        sequential = timer.split();
+        report("sequential", sequential, 0);
+    }
+
+    {
+        std::size_t count(0);
+        adobe::timer_t timer;
+
+        auto adam_records(adobe::parse_adam_batch(adam_sources));
+        auto eve_records(adobe::parse_eve_batch(eve_sources));
+        double parsed(timer.split());
+        timer.reset();
+
+        for (const auto& record : adam_records) {
+            adobe::sheet_t sheet;
+            record.replay(adobe::bind_to_sheet(sheet));
+        }
+        for (const auto& record : eve_records)
+            record.replay(std::any(), counting_callbacks(count));
+
+        double replayed(timer.split());
+        report("batch parse", parsed, 0);
+        report("replay", replayed, 0);
+        report("batch total", parsed + replayed, sequential);
+    }
+
+    {
+        namespace fs = std::filesystem;
+
+        const fs::path directory(fs::temp_directory_path() / "asl_parse_batch_benchmark");
+        const fs::path cache(directory / "cache");
+        std::vector<fs::path> adam_paths;
+        std::vector<fs::path> eve_paths;
+
+        fs::remove_all(directory);
+        fs::create_directories(directory);
+
+        for (std::size_t n(0); n != file_count_k; ++n) {
+            adam_paths.push_back(directory / ("dialog_" + std::to_string(n) + ".adm"));
+            eve_paths.push_back(directory / ("dialog_" + std::to_string(n) + ".eve"));
+            std::ofstream(adam_paths.back(), std::ios::binary) << adam_text[n];
+            std::ofstream(eve_paths.back(), std::ios::binary) << eve_text[n];
+        }
+
+        adobe::timer_t timer;
+
+        auto adam_records(adobe::parse_adam_batch(adam_paths, cache));
+        auto eve_records(adobe::parse_eve_batch(eve_paths, cache));
+        double cold(timer.split());
+        timer.reset();
+
+        adam_records = adobe::parse_adam_batch(adam_paths, cache);
+        eve_records = adobe::parse_eve_batch(eve_paths, cache);
+        double warm(timer.split());
+
+        report("cached batch, cold", cold, sequential);
+        report("cached batch, warm", warm, sequential);
+
+        fs::remove_all(directory);
+    }
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Error: " << error.what() << '\n';
+
+    return 1;
+} catch (...) {
+    std::cerr << "Error: unknown\n";
+
+    return 1;
+}
+
+/**************************************************************************************************/
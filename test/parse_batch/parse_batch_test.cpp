@@ -0,0 +1,290 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <any>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/adam_parser.hpp>
+#include <adobe/eve_parser.hpp>
+#include <adobe/iomanip_asl_cel.hpp>
+#include <adobe/parse_batch.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+const char* adam_sources_k[] = {
+    R"(sheet velocity
+{
+interface:
+    meters  : 1.0;
+    unlink seconds : 1.0 <== meters / rate;
+input:
+    rate    : 1.0; // the rate
+external:
+    clock;
+logic:
+    relate
+    {
+        meters  <== rate * seconds;
+        rate    <== meters / seconds;
+    }
+output:
+    result  <== [ rate, seconds, meters ];
+invariant:
+    positive <== rate > 0;
+}
+)",
+    "sheet empty { }",
+    "sheet broken { input: a : 1; b : ; }",
+    R"(sheet other { constant: k : @name; logic: l <== k; })",
+};
+
+const char* eve_sources_k[] = {
+    R"(layout eve_smoke
+{
+    interface:
+        value : 5;
+        other : 1;
+    constant:
+        text : "label";
+    logic:
+        relate {
+            value <== other * 2;
+            other <== value / 2;
+        }
+
+    view dialog(name: "Dialog")
+    {
+        row()
+        {
+            button(name: "Hello");
+            button(name: "There");
+        }
+        column()
+        {
+            button(name: "world!");
+        }
+    }
+}
+)",
+    "layout broken { view dialog() { row( } }",
+    "layout single { view dialog(); }",
+};
+
+/**************************************************************************************************/
+
+template <typename T>
+std::string to_string(const T& x) {
+    std::ostringstream result;
+    result << adobe::begin_asl_cel << x << adobe::end_asl_cel;
+    return result.str();
+}
+
+std::string to_string(const adobe::line_position_t& x) {
+    return std::to_string(x.line_number_m) + ":" + std::to_string(x.line_start_m);
+}
+
+/**************************************************************************************************/
+
+adobe::adam_callback_suite_t adam_logging_callbacks(std::string& log) {
+    adobe::adam_callback_suite_t result;
+
+    result.add_cell_proc_m = [&](auto type, adobe::name_t name, const auto& position,
+                                 const auto& expression, const auto& brief, const auto& detailed) {
+        log += "cell " + std::to_string(type) + ' ' + name.c_str() + ' ' + to_string(position) +
+               ' ' + to_string(expression) + " '" + brief + "' '" + detailed + "'\n";
+    };
+    result.add_relation_proc_m = [&](const auto& position, const auto& conditional, auto first,
+                                     auto last, const auto&, const auto&) {
+        log += "relation " + to_string(position) + ' ' + to_string(conditional) + '\n';
+        for (; first != last; ++first)
+            log += "    " + to_string(first->expression_m) + '\n';
+    };
+    result.add_interface_proc_m = [&](adobe::name_t name, bool linked, const auto& position1,
+                                      const auto& initializer, const auto& position2,
+                                      const auto& expression, const auto&, const auto&) {
+        log += "interface " + std::string(name.c_str()) + ' ' + std::to_string(linked) + ' ' +
+               to_string(position1) + ' ' + to_string(initializer) + ' ' + to_string(position2) +
+               ' ' + to_string(expression) + '\n';
+    };
+    result.add_external_proc_m = [&](adobe::name_t name, const auto& position, const auto&,
+                                     const auto&) {
+        log += "external " + std::string(name.c_str()) + ' ' + to_string(position) + '\n';
+    };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+/*
+    Views are numbered in the order they are added, the root is numbered 0. Each view is logged
+    with the number of its parent so the shape of the tree is part of the log.
+*/
+adobe::eve_callback_suite_t eve_logging_callbacks(std::string& log, int& views) {
+    adobe::eve_callback_suite_t result;
+
+    result.add_view_proc_m = [&](const std::any& parent, const auto& position, adobe::name_t name,
+                                 const auto& parameters, const auto&, const auto&) {
+        log += "view " + std::to_string(++views) + " in " +
+               std::to_string(std::any_cast<int>(parent)) + ' ' + name.c_str() + ' ' +
+               to_string(position) + ' ' + to_string(parameters) + '\n';
+        return std::any(views);
+    };
+    result.add_cell_proc_m = [&](auto type, adobe::name_t name, const auto& position,
+                                 const auto& initializer, const auto&, const auto&) {
+        log += "cell " + std::to_string(type) + ' ' + name.c_str() + ' ' + to_string(position) +
+               ' ' + to_string(initializer) + '\n';
+    };
+    result.add_relation_proc_m = [&](const auto& position, const auto&, auto first, auto last,
+                                     const auto&, const auto&) {
+        log += "relation " + to_string(position) + ' ' + std::to_string(last - first) + '\n';
+    };
+    result.add_interface_proc_m = [&](adobe::name_t name, bool linked, const auto&,
+                                      const auto& initializer, const auto&, const auto&,
+                                      const auto&, const auto&) {
+        log += "interface " + std::string(name.c_str()) + ' ' + std::to_string(linked) + ' ' +
+               to_string(initializer) + '\n';
+    };
+    result.finalize_sheet_proc_m = [&] { log += "finalize\n"; };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+std::vector<adobe::parse_source_t> make_sources(const char* const* first, const char* const* last) {
+    std::vector<adobe::parse_source_t> result;
+
+    for (; first != last; ++first)
+        result.push_back({*first, adobe::line_position_t("source")});
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_adam_batch_replays_sequential_parse) {
+    const auto sources(make_sources(std::begin(adam_sources_k), std::end(adam_sources_k)));
+
+    std::string expected;
+    std::string actual;
+
+    for (const auto& source : sources) {
+        try {
+            adobe::parse(source.text_m, source.position_m, adam_logging_callbacks(expected));
+        } catch (const adobe::stream_error_t& error) {
+            expected += std::string("error ") + error.what() + '\n';
+        }
+    }
+
+    const auto records(adobe::parse_adam_batch(sources));
+    BOOST_REQUIRE_EQUAL(records.size(), sources.size());
+    BOOST_CHECK(records[2].failed());
+
+    for (const auto& record : records) {
+        try {
+            record.replay(adam_logging_callbacks(actual));
+        } catch (const adobe::stream_error_t& error) {
+            actual += std::string("error ") + error.what() + '\n';
+        }
+    }
+
+    BOOST_CHECK_NE(expected.find("relation"), std::string::npos);
+    BOOST_CHECK_NE(expected.find("external clock"), std::string::npos);
+    BOOST_CHECK_EQUAL(expected, actual);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_eve_batch_replays_sequential_parse) {
+    const auto sources(make_sources(std::begin(eve_sources_k), std::end(eve_sources_k)));
+
+    std::string expected;
+    std::string actual;
+    int expected_views(0);
+    int actual_views(0);
+
+    for (const auto& source : sources) {
+        try {
+            adobe::line_position_t end(adobe::parse(source.text_m, source.position_m, std::any(0),
+                                                    eve_logging_callbacks(expected,
+                                                                          expected_views)));
+            expected += "end " + to_string(end) + '\n';
+        } catch (const adobe::stream_error_t& error) {
+            expected += std::string("error ") + error.what() + '\n';
+        }
+    }
+
+    const auto records(adobe::parse_eve_batch(sources));
+    BOOST_REQUIRE_EQUAL(records.size(), sources.size());
+    BOOST_CHECK(records[1].failed());
+
+    for (const auto& record : records) {
+        try {
+            adobe::line_position_t end(
+                record.replay(std::any(0), eve_logging_callbacks(actual, actual_views)));
+            actual += "end " + to_string(end) + '\n';
+        } catch (const adobe::stream_error_t& error) {
+            actual += std::string("error ") + error.what() + '\n';
+        }
+    }
+
+    BOOST_CHECK_NE(expected.find("view 6 in 5 button"), std::string::npos);
+    BOOST_CHECK_EQUAL(expected, actual);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_batch_replay_reports_callback_errors) {
+    // Both replays report an exception thrown by a callback as a stream_error_t.
+
+    const auto adam(adobe::parse_adam_batch(make_sources(adam_sources_k, adam_sources_k + 1)));
+    const auto eve(adobe::parse_eve_batch(make_sources(eve_sources_k, eve_sources_k + 1)));
+    std::string log;
+    int views(0);
+
+    adobe::adam_callback_suite_t adam_callbacks(adam_logging_callbacks(log));
+    adam_callbacks.add_cell_proc_m = [](auto&&...) { throw std::runtime_error("cell"); };
+
+    adobe::eve_callback_suite_t eve_callbacks(eve_logging_callbacks(log, views));
+    eve_callbacks.add_cell_proc_m = [](auto&&...) { throw std::runtime_error("cell"); };
+
+    BOOST_REQUIRE(!adam.front().failed() && !eve.front().failed());
+    BOOST_CHECK_THROW(adam.front().replay(adam_callbacks), adobe::stream_error_t);
+    BOOST_CHECK_THROW(eve.front().replay(std::any(0), eve_callbacks), adobe::stream_error_t);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_batch_missing_file) {
+    const std::vector<std::filesystem::path> paths{"parse_batch_no_such_file.adm"};
+
+    const auto records(adobe::parse_adam_batch(paths));
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+    BOOST_CHECK(records.front().failed());
+
+    std::string log;
+    BOOST_CHECK_THROW(records.front().replay(adam_logging_callbacks(log)), std::system_error);
+    BOOST_CHECK(log.empty());
+}
@@ -0,0 +1,311 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <any>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/adam_parser.hpp>
+#include <adobe/eve_parser.hpp>
+#include <adobe/iomanip_asl_cel.hpp>
+#include <adobe/parse_cache.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+const char adam_source_k[] = R"(sheet velocity
+{
+interface:
+    meters  : 1.0;
+    unlink seconds : 1.0 <== meters / rate;
+input:
+    rate    : 1.0; // the rate
+external:
+    clock;
+constant:
+    text    : "label";
+    flags   : { a: true, b: false, c: empty, d: @name };
+logic:
+    relate
+    {
+        meters  <== rate * seconds;
+        rate    <== meters / seconds;
+    }
+output:
+    result  <== [ rate, seconds, meters ];
+invariant:
+    positive <== rate > 0;
+}
+)";
+
+const char eve_source_k[] = R"(layout eve_smoke
+{
+    interface:
+        value : 5;
+        other : 1;
+    constant:
+        text : "label";
+    logic:
+        relate {
+            value <== other * 2;
+            other <== value / 2;
+        }
+
+    view dialog(name: "Dialog")
+    {
+        row()
+        {
+            button(name: "Hello", bind: @value);
+            button(name: "There");
+        }
+        column()
+        {
+            button(name: "world!");
+        }
+    }
+}
+)";
+
+/**************************************************************************************************/
+
+template <typename T>
+std::string to_string(const T& x) {
+    std::ostringstream result;
+    result << adobe::begin_asl_cel << x << adobe::end_asl_cel;
+    return result.str();
+}
+
+std::string to_string(const adobe::line_position_t& x) {
+    return std::string(x.stream_name()) + ':' + std::to_string(x.line_number_m) + ':' +
+           std::to_string(x.line_start_m) + ':' + std::to_string(x.position_m);
+}
+
+/**************************************************************************************************/
+
+adobe::adam_callback_suite_t adam_logging_callbacks(std::string& log) {
+    adobe::adam_callback_suite_t result;
+
+    result.add_cell_proc_m = [&](auto type, adobe::name_t name, const auto& position,
+                                 const auto& expression, const auto& brief, const auto& detailed) {
+        log += "cell " + std::to_string(type) + ' ' + name.c_str() + ' ' + to_string(position) +
+               ' ' + to_string(expression) + " '" + brief + "' '" + detailed + "'\n";
+    };
+    result.add_relation_proc_m = [&](const auto& position, const auto& conditional, auto first,
+                                     auto last, const auto& brief, const auto& detailed) {
+        log += "relation " + to_string(position) + ' ' + to_string(conditional) + " '" + brief +
+               "' '" + detailed + "'\n";
+        for (; first != last; ++first) {
+            log += "   ";
+            for (adobe::name_t name : first->name_set_m)
+                log += std::string(" ") + name.c_str();
+            log += ' ' + to_string(first->position_m) + ' ' + to_string(first->expression_m) +
+                   '\n';
+        }
+    };
+    result.add_interface_proc_m = [&](adobe::name_t name, bool linked, const auto& position1,
+                                      const auto& initializer, const auto& position2,
+                                      const auto& expression, const auto&, const auto&) {
+        log += "interface " + std::string(name.c_str()) + ' ' + std::to_string(linked) + ' ' +
+               to_string(position1) + ' ' + to_string(initializer) + ' ' + to_string(position2) +
+               ' ' + to_string(expression) + '\n';
+    };
+    result.add_external_proc_m = [&](adobe::name_t name, const auto& position, const auto&,
+                                     const auto&) {
+        log += "external " + std::string(name.c_str()) + ' ' + to_string(position) + '\n';
+    };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+adobe::eve_callback_suite_t eve_logging_callbacks(std::string& log, int& views) {
+    adobe::eve_callback_suite_t result;
+
+    result.add_view_proc_m = [&](const std::any& parent, const auto& position, adobe::name_t name,
+                                 const auto& parameters, const auto&, const auto&) {
+        log += "view " + std::to_string(++views) + " in " +
+               std::to_string(std::any_cast<int>(parent)) + ' ' + name.c_str() + ' ' +
+               to_string(position) + ' ' + to_string(parameters) + '\n';
+        return std::any(views);
+    };
+    result.add_cell_proc_m = [&](auto type, adobe::name_t name, const auto& position,
+                                 const auto& initializer, const auto&, const auto&) {
+        log += "cell " + std::to_string(type) + ' ' + name.c_str() + ' ' + to_string(position) +
+               ' ' + to_string(initializer) + '\n';
+    };
+    result.add_relation_proc_m = [&](const auto& position, const auto&, auto first, auto last,
+                                     const auto&, const auto&) {
+        log += "relation " + to_string(position) + ' ' + std::to_string(last - first) + '\n';
+    };
+    result.add_interface_proc_m = [&](adobe::name_t name, bool linked, const auto&,
+                                      const auto& initializer, const auto&, const auto&,
+                                      const auto&, const auto&) {
+        log += "interface " + std::string(name.c_str()) + ' ' + std::to_string(linked) + ' ' +
+               to_string(initializer) + '\n';
+    };
+    result.finalize_sheet_proc_m = [&] { log += "finalize\n"; };
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+std::string replay_log(const adobe::adam_parse_record_t& record) {
+    std::string result;
+    record.replay(adam_logging_callbacks(result));
+    return result;
+}
+
+std::string replay_log(const adobe::eve_parse_record_t& record) {
+    std::string result;
+    int views(0);
+    adobe::line_position_t end(record.replay(std::any(0), eve_logging_callbacks(result, views)));
+    return result + "end " + to_string(end) + '\n';
+}
+
+/**************************************************************************************************/
+
+struct temp_directory_t {
+    temp_directory_t() : path_m(std::filesystem::temp_directory_path() / "asl_parse_cache_test") {
+        std::filesystem::remove_all(path_m);
+        std::filesystem::create_directories(path_m);
+    }
+    ~temp_directory_t() { std::filesystem::remove_all(path_m); }
+
+    std::size_t image_count() const {
+        std::size_t result(0);
+        for (const auto& e : std::filesystem::directory_iterator(path_m / "cache")) {
+            (void)e;
+            ++result;
+        }
+        return result;
+    }
+
+    std::filesystem::path path_m;
+};
+
+void write_file(const std::filesystem::path& path, const std::string& text) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_image_round_trip) {
+    const adobe::parse_cache_key_t key(adobe::parse_cache_key("source", adam_source_k));
+
+    const auto adam(adobe::parse_adam_record({adam_source_k, adobe::line_position_t("source")}));
+    BOOST_REQUIRE(!adam.failed());
+
+    adobe::adam_parse_record_t adam_loaded;
+    BOOST_REQUIRE(adobe::read_parse_image(adobe::make_parse_image(adam, key), key, adam_loaded));
+    BOOST_CHECK_NE(replay_log(adam).find("relation"), std::string::npos);
+    BOOST_CHECK_EQUAL(replay_log(adam), replay_log(adam_loaded));
+
+    const auto eve(adobe::parse_eve_record({eve_source_k, adobe::line_position_t("source")}));
+    BOOST_REQUIRE(!eve.failed());
+
+    adobe::eve_parse_record_t eve_loaded;
+    BOOST_REQUIRE(adobe::read_parse_image(adobe::make_parse_image(eve, key), key, eve_loaded));
+    BOOST_CHECK_NE(replay_log(eve).find("view 6 in 5 button"), std::string::npos);
+    BOOST_CHECK_EQUAL(replay_log(eve), replay_log(eve_loaded));
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_image_rejects_mismatch) {
+    const adobe::parse_cache_key_t key(adobe::parse_cache_key("source", adam_source_k));
+    const adobe::parse_cache_key_t other(adobe::parse_cache_key("other", adam_source_k));
+    BOOST_CHECK(key != other);
+
+    const auto record(adobe::parse_adam_record({adam_source_k, adobe::line_position_t("source")}));
+    const std::string image(adobe::make_parse_image(record, key));
+
+    adobe::adam_parse_record_t adam;
+    adobe::eve_parse_record_t eve;
+
+    BOOST_CHECK(!adobe::read_parse_image(image, other, adam));
+    BOOST_CHECK(!adobe::read_parse_image(image, key, eve));
+    BOOST_CHECK(!adobe::read_parse_image(std::string_view(), key, adam));
+
+    // Every truncation of the image must be rejected without reading past its end.
+    for (std::size_t n = 0; n != image.size(); ++n)
+        BOOST_CHECK(!adobe::read_parse_image(std::string_view(image).substr(0, n), key, adam));
+
+    BOOST_CHECK(!adobe::read_parse_image(image + '\0', key, adam));
+
+    const auto failed(adobe::parse_adam_record({"sheet broken { input: a : ; }",
+                                                adobe::line_position_t("source")}));
+    BOOST_CHECK(failed.failed());
+    BOOST_CHECK_THROW(adobe::make_parse_image(failed, key), std::invalid_argument);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(parse_cached_matches_parse_file) {
+    temp_directory_t temp;
+    const std::filesystem::path cache(temp.path_m / "cache");
+    const std::filesystem::path adam_path(temp.path_m / "sheet.adm");
+    const std::filesystem::path eve_path(temp.path_m / "layout.eve");
+
+    write_file(adam_path, adam_source_k);
+    write_file(eve_path, eve_source_k);
+
+    std::string expected;
+    adobe::parse_file(adam_path, adam_logging_callbacks(expected));
+
+    // The first load parses the text and writes an image, the second loads the image.
+    BOOST_CHECK_EQUAL(replay_log(adobe::parse_adam_cached(adam_path, cache)), expected);
+    BOOST_CHECK_EQUAL(temp.image_count(), 1u);
+    BOOST_CHECK_EQUAL(replay_log(adobe::parse_adam_cached(adam_path, cache)), expected);
+    BOOST_CHECK_EQUAL(temp.image_count(), 1u);
+
+    // An edited source gets a new image.
+    write_file(adam_path, std::string(adam_source_k) + "\n");
+    BOOST_CHECK_EQUAL(replay_log(adobe::parse_adam_cached(adam_path, cache)), expected);
+    BOOST_CHECK_EQUAL(temp.image_count(), 2u);
+
+    // A corrupt image is ignored and replaced.
+    for (const auto& e : std::filesystem::directory_iterator(cache))
+        write_file(e.path(), "garbage");
+    BOOST_CHECK_EQUAL(replay_log(adobe::parse_adam_cached(adam_path, cache)), expected);
+
+    const auto eve_records(adobe::parse_eve_batch({eve_path, eve_path}, cache));
+    BOOST_REQUIRE_EQUAL(eve_records.size(), 2u);
+
+    std::string eve_expected;
+    int views(0);
+    adobe::line_position_t end(
+        adobe::parse_file(eve_path, std::any(0), eve_logging_callbacks(eve_expected, views)));
+    eve_expected += "end " + to_string(end) + '\n';
+
+    BOOST_CHECK_EQUAL(replay_log(eve_records[0]), eve_expected);
+    BOOST_CHECK_EQUAL(replay_log(eve_records[1]), eve_expected);
+    BOOST_CHECK_EQUAL(replay_log(adobe::parse_eve_cached(eve_path, cache)), eve_expected);
+
+    // Failed parses are returned but never cached.
+    write_file(adam_path, "sheet broken { input: a : ; }");
+    const std::size_t images(temp.image_count());
+    BOOST_CHECK(adobe::parse_adam_cached(adam_path, cache).failed());
+    BOOST_CHECK_EQUAL(temp.image_count(), images);
+}
@@ -12,6 +12,9 @@
 // stdc++
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #ifndef USING_OPENSSL
 #define USING_OPENSSL 0
@@ -388,6 +391,121 @@ void validate(const std::vector<std::string>& x, const std::vector<std::string>&
     }
 }
 
+/**************************************************************************************************/
+#if 0
+#pragma mark -
+#endif
+/**************************************************************************************************/
+
+constexpr std::size_t throughput_size_k = 16 * 1024 * 1024;
+constexpr std::size_t message_size_k = 256;
+constexpr std::size_t repeat_count_k = 5;
+
+/*
+    Returns the fastest of repeat_count_k runs of f in milliseconds.
+*/
+
+template <typename F>
+double best_time(F f) {
+    adobe::timer_t timer;
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        f();
+        timer.accrue();
+    }
+
+    return timer.accrued_min();
+}
+
+void report_throughput(const char* label, std::size_t bytes, double milliseconds) {
+    std::cout << "    " << std::left;
+    std::cout.width(28);
+    std::cout << label << bytes / 1e9 / (milliseconds / 1000) << " GB/s\n" << std::right;
+}
+
+/*
+    Reports the throughput of each kernel of Hash over one long message, and of digesting many
+    short messages one at a time against digest_each.
+*/
+
+template <typename Hash>
+void throughput(const char* name) {
+    typedef Hash hash_type;
+    typedef typename hash_type::traits_type traits_type;
+    typedef typename hash_type::digest_type digest_type;
+    typedef typename traits_type::state_digest_type state_digest_type;
+
+    constexpr std::size_t block_size_k = traits_type::message_blocksize_k / 8;
+
+    const std::string buffer(throughput_size_k, 'a');
+    const auto* first(reinterpret_cast<const std::uint8_t*>(buffer.data()));
+    const std::size_t blocks(buffer.size() / block_size_k);
+    state_digest_type state(traits_type::initial_state());
+
+    std::cout << name << ":\n";
+
+    report_throughput("byte source", buffer.size(), best_time([&] {
+                          adobe::implementation::byte_source_iterators<const char*> source(
+                              buffer.data(), buffer.data() + buffer.size());
+                          std::uint64_t message_size(0);
+                          std::uint16_t stuffed_size(0);
+                          typename traits_type::message_block_type block = {{0}};
+
+                          adobe::implementation::block_and_digest<traits_type>(
+                              block, stuffed_size, message_size, state, source);
+                      }));
+
+    report_throughput("portable blocks", buffer.size(), best_time([&] {
+                          adobe::implementation::digest_blocks_portable<traits_type>(state, first,
+                                                                                     blocks);
+                      }));
+
+    report_throughput("update(const void*, size_t)", buffer.size(), best_time([&] {
+                          hash_type hash;
+                          hash.update(static_cast<const void*>(buffer.data()), buffer.size());
+                          state[0] += hash.finalize()[0];
+                      }));
+
+    std::vector<std::string> messages(throughput_size_k / message_size_k);
+    for (std::size_t i(0); i != messages.size(); ++i)
+        messages[i].assign(message_size_k, static_cast<char>(i));
+
+    std::vector<digest_type> expected(messages.size());
+    std::vector<digest_type> digests(messages.size());
+
+    report_throughput("one message at a time", buffer.size(), best_time([&] {
+                          for (std::size_t i(0); i != messages.size(); ++i)
+                              expected[i] = hash_type::digest(messages[i].begin(),
+                                                              messages[i].end());
+                      }));
+
+    report_throughput("digest_each", buffer.size(), best_time([&] {
+                          hash_type::digest_each(messages.begin(), messages.end(),
+                                                 digests.begin());
+                      }));
+
+    if (digests != expected)
+        throw std::runtime_error("digest_each mismatch");
+
+#if ADOBE_SHA_X86
+    if constexpr (traits_type::lane_count_k > 1) {
+        if (adobe::implementation::sha_x86_features().avx2_m) {
+            report_throughput("digest_each, avx2 lanes", buffer.size(), best_time([&] {
+                                  adobe::implementation::digest_lanes<traits_type>(
+                                      messages.begin(), messages.end(), digests.begin());
+                              }));
+
+            if (digests != expected)
+                throw std::runtime_error("digest_lanes mismatch");
+        }
+    }
+#endif
+
+    // Keep the result of the kernels alive.
+    if (state[0] == 0)
+        std::cout << '\n';
+}
+
 /**************************************************************************************************/
 
 } // namespace
@@ -496,6 +614,13 @@ int main() try {
     validate(asl_result_512, boostcrypto_bench_512(corpus));
 #endif // USING_BOOSTCRYPTO
 
+    std::cout << "\nThroughput over " << throughput_size_k / 1024 / 1024 << " MB, best of "
+              << repeat_count_k << " runs:\n";
+
+    throughput<adobe::sha1_t>("SHA-1");
+    throughput<adobe::sha256_t>("SHA-256");
+    throughput<adobe::sha512_t>("SHA-512");
+
     return 0;
 } catch (const std::exception& error) {
     std::cerr << "Error: " << error.what() << '\n';
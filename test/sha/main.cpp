@@ -6,6 +6,7 @@
 /**************************************************************************************************/
 
 #include <iostream>
+#include <list>
 #include <sstream>
 
 #define BOOST_TEST_MAIN
@@ -266,6 +267,84 @@ void test_hash(const C& container) {
 
 /**************************************************************************************************/
 
+/*
+    Checks the contiguous fast paths, which digest whole blocks straight from the buffer (and with
+    the SHA extensions where they are available), and digest_each, which may digest several
+    messages at once, against the byte-at-a-time path taken for non-contiguous iterators.
+*/
+template <typename HashT>
+void test_fast_paths() {
+    typedef HashT hash_type;
+    typedef typename hash_type::digest_type digest_type;
+
+    std::vector<std::string> messages;
+    std::vector<digest_type> expected;
+    std::uint32_t seed(0x9e3779b9);
+
+    for (std::size_t size(0); size < 1200; size += size < 300 ? 1 : 97) {
+        std::string message(size, '\0');
+
+        for (auto& c : message) {
+            seed = seed * 1664525 + 1013904223;
+            c = static_cast<char>(seed >> 24);
+        }
+
+        const std::list<char> bytes(message.begin(), message.end());
+
+        messages.push_back(message);
+        expected.push_back(hash_type::digest(bytes.begin(), bytes.end()));
+
+        BOOST_CHECK(hash_type::digest(message.begin(), message.end()) == expected.back());
+        BOOST_CHECK(hash_type::digest(message.data(), std::uint64_t(size) * 8) == expected.back());
+
+        // Uneven pieces, so the running message block is partly stuffed at every call.
+        hash_type hash;
+        std::size_t offset(0);
+
+        for (std::size_t piece(1); offset != size; piece = piece * 3 % 131) {
+            const std::size_t n(std::min(piece, size - offset));
+
+            hash.update(static_cast<const void*>(message.data() + offset), n);
+            offset += n;
+        }
+
+        BOOST_CHECK(hash.finalize() == expected.back());
+    }
+
+    std::vector<digest_type> digests;
+
+    hash_type::digest_each(messages.begin(), messages.end(), std::back_inserter(digests));
+
+    BOOST_CHECK(digests == expected);
+
+#if ADOBE_SHA_X86
+    // digest_each may prefer the SHA extensions, check the lanes as well.
+    if constexpr (hash_type::traits_type::lane_count_k > 1) {
+        if (adobe::implementation::sha_x86_features().avx2_m) {
+            digests.clear();
+            adobe::implementation::digest_lanes<typename hash_type::traits_type>(
+                messages.begin(), messages.end(), std::back_inserter(digests));
+
+            BOOST_CHECK(digests == expected);
+        }
+    }
+#endif
+
+    // Fewer messages than lanes, and a long message amongst short ones.
+    std::rotate(messages.begin(), messages.end() - 3, messages.end());
+    std::rotate(expected.begin(), expected.end() - 3, expected.end());
+
+    for (std::size_t n(0); n != 10; ++n) {
+        digests.clear();
+        hash_type::digest_each(messages.begin(), messages.begin() + n, std::back_inserter(digests));
+
+        BOOST_CHECK(std::equal(digests.begin(), digests.end(), expected.begin(),
+                               expected.begin() + n));
+    }
+}
+
+/**************************************************************************************************/
+
 } // namespace
 
 /**************************************************************************************************/
@@ -414,3 +493,13 @@ BOOST_AUTO_TEST_CASE(sha) {
 }
 
 /**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(sha_fast_paths) {
+    test_fast_paths<adobe::sha1_t>();
+    test_fast_paths<adobe::sha224_t>();
+    test_fast_paths<adobe::sha256_t>();
+    test_fast_paths<adobe::sha384_t>();
+    test_fast_paths<adobe::sha512_t>();
+}
+
+/**************************************************************************************************/
@@ -0,0 +1,192 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/mapped_file.hpp>
+#include <adobe/sha256_tree.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+using digest_type = adobe::sha256_tree_t::digest_type;
+
+std::string content(std::size_t size) {
+    std::string result(size, '\0');
+    std::uint32_t seed(0x2545f491);
+
+    for (auto& c : result) {
+        seed = seed * 1664525 + 1013904223;
+        c = static_cast<char>(seed >> 24);
+    }
+
+    return result;
+}
+
+std::string bytes(const digest_type& digest) {
+    std::string result;
+
+    for (auto e : digest) {
+        for (int shift(24); shift >= 0; shift -= 8)
+            result += static_cast<char>(e >> shift);
+    }
+
+    return result;
+}
+
+digest_type sha256(const std::string& x) {
+    return adobe::sha256_t::digest(x.begin(), x.end());
+}
+
+std::string big_endian(std::uint64_t x) {
+    std::string result(8, '\0');
+
+    for (std::size_t i(8); i != 0; x >>= 8)
+        result[--i] = static_cast<char>(x);
+
+    return result;
+}
+
+/*
+    The tree digest computed directly from its definition, for reference.
+*/
+digest_type reference_digest(const std::string& text, std::size_t leaf_size) {
+    std::vector<digest_type> level;
+
+    for (std::size_t offset(0); offset == 0 || offset < text.size(); offset += leaf_size)
+        level.push_back(sha256(std::string(1, '\x00') + text.substr(offset, leaf_size)));
+
+    while (level.size() != 1) {
+        std::vector<digest_type> above;
+
+        for (std::size_t i(0); i < level.size(); i += 2) {
+            above.push_back(i + 1 == level.size()
+                                ? level[i]
+                                : sha256(std::string(1, '\x01') + bytes(level[i]) +
+                                         bytes(level[i + 1])));
+        }
+
+        level.swap(above);
+    }
+
+    return sha256(std::string(1, '\x02') + big_endian(text.size()) + big_endian(leaf_size) +
+                  bytes(level.front()));
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(sha256_tree_digest) {
+    constexpr std::size_t leaf_size_k = 64;
+
+    for (std::size_t size : {0, 1, 63, 64, 65, 128, 129, 200, 257, 320, 700, 1000}) {
+        const std::string text(content(size));
+        adobe::sha256_tree_t tree(leaf_size_k);
+
+        tree.assign(text.data(), text.size());
+
+        BOOST_CHECK_EQUAL(tree.size(), size);
+        BOOST_CHECK_EQUAL(tree.leaf_count(),
+                          size == 0 ? 1 : (size + leaf_size_k - 1) / leaf_size_k);
+        BOOST_CHECK(tree.digest() == reference_digest(text, leaf_size_k));
+    }
+
+    // The leaf size is part of the digest.
+    const std::string text(content(256));
+    adobe::sha256_tree_t small(64);
+    adobe::sha256_tree_t large(128);
+
+    small.assign(text.data(), text.size());
+    large.assign(text.data(), text.size());
+
+    BOOST_CHECK(small.digest() != large.digest());
+    BOOST_CHECK(adobe::sha256_tree_t(64).digest() == reference_digest(std::string(), 64));
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(sha256_tree_leaves) {
+    constexpr std::size_t leaf_size_k = 100;
+
+    std::string text(content(1050));
+    adobe::sha256_tree_t tree(leaf_size_k);
+
+    tree.assign(text.data(), text.size());
+
+    for (std::size_t i(0); i != tree.leaf_count(); ++i) {
+        const std::string leaf(text.substr(i * leaf_size_k, leaf_size_k));
+
+        BOOST_CHECK(tree.verify_leaf(i, leaf.data(), leaf.size()));
+        BOOST_CHECK(!tree.verify_leaf(i, leaf.data(), leaf.size() - 1));
+
+        const std::vector<digest_type> proof(tree.proof(i));
+        const digest_type digest(adobe::sha256_tree_t::leaf_digest(leaf.data(), leaf.size()));
+
+        BOOST_CHECK(adobe::sha256_tree_t::verify_proof(tree.digest(), tree.size(), leaf_size_k, i,
+                                                       digest, proof));
+        BOOST_CHECK(!adobe::sha256_tree_t::verify_proof(tree.digest(), tree.size(), leaf_size_k,
+                                                        i ^ 1, digest, proof));
+        BOOST_CHECK(!adobe::sha256_tree_t::verify_proof(tree.digest(), tree.size() + 1,
+                                                        leaf_size_k, i, digest, proof));
+    }
+
+    // Updating a leaf gives the digest of the updated content, the last leaf may change size.
+    for (std::size_t i : {3, 0, 10, 7}) {
+        const std::size_t size(i == 10 ? 20 : leaf_size_k);
+        const std::string leaf(content(size + i).substr(i));
+
+        text.replace(i * leaf_size_k, leaf_size_k, leaf);
+        tree.update_leaf(i, leaf.data(), leaf.size());
+
+        BOOST_CHECK_EQUAL(tree.size(), text.size());
+        BOOST_CHECK(tree.digest() == reference_digest(text, leaf_size_k));
+    }
+
+    const std::string leaf(leaf_size_k, 'x');
+
+    BOOST_CHECK_THROW(tree.update_leaf(11, leaf.data(), leaf.size()), std::out_of_range);
+    BOOST_CHECK_THROW(tree.update_leaf(2, leaf.data(), leaf.size() - 1), std::invalid_argument);
+    BOOST_CHECK_THROW(tree.update_leaf(10, leaf.data(), 0), std::invalid_argument);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(sha256_tree_mapped_file) {
+    const std::string text(content(3 * 4096 + 17));
+    const std::filesystem::path path(std::filesystem::temp_directory_path() /
+                                     "asl_sha256_tree_test.bin");
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+
+    {
+        const adobe::mapped_file_t file(path);
+        adobe::sha256_tree_t tree(4096);
+
+        tree.assign(file);
+
+        BOOST_CHECK(tree.digest() == reference_digest(text, 4096));
+    }
+
+    std::filesystem::remove(path);
+}
+
+/**************************************************************************************************/
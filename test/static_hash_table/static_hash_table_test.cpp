@@ -0,0 +1,107 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/name.hpp>
+#include <adobe/static_hash_table.hpp>
+
+/**************************************************************************************************/
+
+using namespace adobe::literals;
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr auto keywords_k =
+    adobe::make_static_hash_set({"empty"_name, "true"_name, "false"_name, "when"_name});
+
+static_assert(keywords_k.contains("true"_name));
+static_assert(keywords_k.contains(std::string_view("when")));
+static_assert(!keywords_k.contains(std::string_view("whe")));
+static_assert(keywords_k.find("false"_name) == 2);
+static_assert(keywords_k.find("unlink"_name) == keywords_k.npos);
+
+static_assert(adobe::detail::name_hash(std::string_view("static")) == "static"_name.hash());
+
+/**************************************************************************************************/
+
+int one() { return 1; }
+int two() { return 2; }
+int three() { return 3; }
+
+constexpr auto table_k = adobe::make_static_hash_table<int (*)()>({
+    {"one"_name, &one},
+    {"two"_name, &two},
+    {"three"_name, &three},
+});
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(static_hash_set_lookup) {
+    BOOST_CHECK(keywords_k.contains(adobe::name_t("empty")));
+    BOOST_CHECK(keywords_k.contains(std::string_view("false")));
+    BOOST_CHECK(!keywords_k.contains(adobe::name_t("falsey")));
+    BOOST_CHECK(!keywords_k.contains(std::string_view("")));
+
+    // Every key is found at its own index through each lookup path.
+    for (std::size_t i = 0; i != keywords_k.size(); ++i) {
+        std::string key(keywords_k.key(i));
+        BOOST_CHECK_EQUAL(keywords_k.find(key), i);
+        BOOST_CHECK_EQUAL(keywords_k.find(adobe::name_t(key.c_str())), i);
+    }
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(static_hash_table_lookup) {
+    BOOST_CHECK_EQUAL(table_k("one"_name)(), 1);
+    BOOST_CHECK_EQUAL(table_k(adobe::name_t("two"))(), 2);
+    BOOST_CHECK_EQUAL(table_k(std::string_view("three"))(), 3);
+
+    int (*result)() = nullptr;
+    BOOST_CHECK(table_k("three"_name, result) && result == &three);
+    BOOST_CHECK(!table_k("four"_name, result));
+    BOOST_CHECK(table_k.find(std::string_view("four")) == nullptr);
+    BOOST_CHECK_THROW(table_k("four"_name), std::logic_error);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(static_hash_set_hash_collision) {
+    // Two names with the same 64-bit hash, only the first a member of the set.
+
+    if constexpr (sizeof(std::size_t) == 8) {
+        constexpr auto set = adobe::make_static_hash_set({"bf13eaba83dea434"_name});
+
+        static_assert(sizeof(std::size_t) != 8 ||
+                      "bf13eaba83dea434"_name.hash() == "b3b828bb3655e2a7"_name.hash());
+
+        BOOST_CHECK(set.contains("bf13eaba83dea434"_name));
+        BOOST_CHECK(!set.contains("b3b828bb3655e2a7"_name));
+        BOOST_CHECK(!set.contains(std::string_view("b3b828bb3655e2a7")));
+    }
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(static_hash_set_duplicate_key) {
+    BOOST_CHECK_THROW(adobe::make_static_hash_set({"a"_name, "b"_name, "a"_name}),
+                      std::logic_error);
+}
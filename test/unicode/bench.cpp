@@ -0,0 +1,157 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <adobe/timer.hpp>
+#include <adobe/unicode.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t corpus_size_k = 4 * 1024 * 1024;
+constexpr std::size_t repeat_count_k = 5;
+
+const char english_k[] = "The quick brown fox jumps over the lazy dog, again and again. ";
+const char french_k[] = "Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter en canoë. ";
+const char russian_k[] = "Съешь же ещё этих мягких французских булок, да выпей чаю. ";
+const char greek_k[] = "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία. ";
+const char japanese_k[] = "いろはにほへと ちりぬるを わかよたれそ つねならむ。";
+const char chinese_k[] = "我能吞下玻璃而不伤身体。";
+const char emoji_k[] = "Launch 🚀 party 🎉 smile 😀 ";
+
+/*
+    Repeats the samples, in turn, until the corpus is at least corpus_size_k bytes.
+*/
+
+std::string corpus(const std::vector<const char*>& samples) {
+    std::string result;
+
+    while (result.size() < corpus_size_k) {
+        for (const char* e : samples)
+            result += e;
+    }
+
+    return result;
+}
+
+/**************************************************************************************************/
+
+double megabytes_per_second(std::size_t bytes, double milliseconds) {
+    return bytes / 1024.0 / 1024.0 / (milliseconds / 1000);
+}
+
+/*
+    Returns the fastest of repeat_count_k runs of f in milliseconds.
+*/
+
+template <typename F>
+double time(F f) {
+    adobe::timer_t timer;
+
+    for (std::size_t n(0); n != repeat_count_k; ++n) {
+        f();
+        timer.accrue();
+    }
+
+    return timer.accrued_min();
+}
+
+/**************************************************************************************************/
+
+/*
+    Times copy_utf() into a reserved string against the two pass utf_length() and
+    transcode_utf(), and reports the throughput over the source text in MB/s.
+*/
+
+template <typename T, typename U>
+void report(const char* label, const std::basic_string<U>& source) {
+    const U* first(source.data());
+    const U* last(source.data() + source.size());
+    const std::size_t bytes(source.size() * sizeof(U));
+
+    std::basic_string<T> expected;
+    std::basic_string<T> result;
+
+    const double copy(time([&] {
+        expected.clear();
+        expected.reserve(source.size() * adobe::expand_utf<U, T>::value);
+        adobe::copy_utf<T>(first, last, std::back_inserter(expected));
+    }));
+
+    const double transcode(time([&] {
+        result.resize(*adobe::utf_length<T>(first, last));
+        adobe::transcode_utf<T>(first, last, result.data());
+    }));
+
+    if (result != expected)
+        throw std::runtime_error("transcoded text mismatch");
+
+    std::cout << "        " << label << ": copy_utf " << megabytes_per_second(bytes, copy)
+              << " MB/s, transcode_utf " << megabytes_per_second(bytes, transcode) << " MB/s ("
+              << copy / transcode << "x)\n";
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main() try {
+    const std::vector<std::pair<const char*, std::string>> corpora = {
+        {"ascii", corpus({english_k})},
+        {"latin", corpus({french_k})},
+        {"cyrillic and greek", corpus({russian_k, greek_k})},
+        {"cjk", corpus({japanese_k, chinese_k})},
+        {"emoji", corpus({emoji_k})},
+        {"mixed", corpus({english_k, french_k, russian_k, greek_k, japanese_k, chinese_k,
+                          emoji_k})}};
+
+    std::cout << "Transcoding " << corpus_size_k / 1024 << " KB corpora, best of " << repeat_count_k
+              << " runs:\n";
+
+    for (const auto& e : corpora) {
+        const std::string& utf8(e.second);
+        const char* first(utf8.data());
+        const char* last(utf8.data() + utf8.size());
+
+        std::u16string utf16(*adobe::utf_length<char16_t>(first, last), u'\0');
+        adobe::transcode_utf<char16_t>(first, last, utf16.data());
+
+        const double validate(time([&] {
+            if (adobe::find_invalid_utf(first, last) != last)
+                throw std::runtime_error("corpus is not valid UTF-8");
+        }));
+
+        std::cout << "    " << e.first << ":\n";
+        std::cout << "        validate utf8: " << megabytes_per_second(utf8.size(), validate)
+                  << " MB/s\n";
+
+        report<char16_t>("utf8 -> utf16", utf8);
+        report<char32_t>("utf8 -> utf32", utf8);
+        report<char>("utf16 -> utf8", utf16);
+    }
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+} catch (...) {
+    std::cerr << "Exception: unknown\n";
+    return 1;
+}
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <iostream>
 #include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -147,6 +148,87 @@ void bug_test_from_07_27_2008() {
     std::cout << std::dec;
 }
 
+
+/**************************************************************************************************/
+
+template <typename T, typename U>
+void check_transcode(const std::vector<U>& source, const std::vector<T>& expected,
+                     const char* what) {
+    const std::optional<std::size_t> length(
+        adobe::utf_length<T>(source.data(), source.data() + source.size()));
+
+    if (!length || *length != expected.size())
+        throw std::runtime_error(std::string("In ") + what + ": length mismatch");
+
+    std::vector<T> result(*length);
+    T* last(adobe::transcode_utf<T>(source.data(), source.data() + source.size(), result.data()));
+
+    if (last != result.data() + result.size() || result != expected)
+        throw std::runtime_error(std::string("In ") + what + ": transcoded text mismatch");
+}
+
+template <typename U>
+void check_invalid(const std::vector<U>& source, std::size_t position, const char* what) {
+    const U* f(source.data());
+    const U* l(source.data() + source.size());
+
+    if (adobe::find_invalid_utf(f, l) != f + position || adobe::utf_length<std::uint8_t>(f, l) ||
+        adobe::utf_length<std::uint16_t>(f, l) || adobe::utf_length<std::uint32_t>(f, l))
+        throw std::runtime_error(std::string("In ") + what + ": invalid text was accepted");
+}
+
+/**************************************************************************************************/
+
+void bulk_transcode_test() {
+    std::cout << std::endl << "Bulk transcoding test..." << std::endl;
+
+    // Code points from every plane, separated by runs of ASCII long enough for the block paths.
+    utf32_buffer_t utf32;
+
+    for (std::uint32_t code_point(0), n(0); code_point < 0x110000; code_point += 61, ++n) {
+        if (!valid_code_point(code_point))
+            continue;
+        utf32.push_back(code_point);
+        for (std::uint32_t i(0); i != n % 37; ++i)
+            utf32.push_back('a' + i % 26);
+    }
+
+    utf16_buffer_t utf16;
+    utf8_buffer_t utf8;
+
+    adobe::copy_utf<std::uint16_t>(utf32.begin(), utf32.end(), std::back_inserter(utf16));
+    adobe::copy_utf<std::uint8_t>(utf32.begin(), utf32.end(), std::back_inserter(utf8));
+
+    check_transcode(utf8, utf8, "utf8 -> utf8");
+    check_transcode(utf8, utf16, "utf8 -> utf16");
+    check_transcode(utf8, utf32, "utf8 -> utf32");
+    check_transcode(utf16, utf8, "utf16 -> utf8");
+    check_transcode(utf16, utf16, "utf16 -> utf16");
+    check_transcode(utf16, utf32, "utf16 -> utf32");
+    check_transcode(utf32, utf8, "utf32 -> utf8");
+    check_transcode(utf32, utf16, "utf32 -> utf16");
+    check_transcode(utf32, utf32, "utf32 -> utf32");
+
+    const std::string prefix(20, 'x');
+    auto utf8_text = [&](const char* x) {
+        std::string text(prefix + x + prefix);
+        return utf8_buffer_t(text.begin(), text.end());
+    };
+
+    check_invalid(utf8_text("\xC0\xAF"), 20, "overlong utf8");
+    check_invalid(utf8_text("\xE0\x80\xAF"), 20, "overlong utf8");
+    check_invalid(utf8_text("\xED\xA0\x80"), 20, "utf8 surrogate");
+    check_invalid(utf8_text("\xF4\x90\x80\x80"), 20, "utf8 out of range");
+    check_invalid(utf8_text("\x80"), 20, "utf8 continuation");
+    check_invalid(utf8_text("\xE2\x82"), 20, "truncated utf8");
+    check_invalid(utf8_buffer_t{'a', 0xE2, 0x82}, 1, "truncated utf8");
+    check_invalid(utf16_buffer_t{'a', 0xD800, 'b'}, 1, "utf16 lead surrogate");
+    check_invalid(utf16_buffer_t{'a', 'b', 0xDC00}, 2, "utf16 trail surrogate");
+    check_invalid(utf32_buffer_t{'a', 0x110000}, 1, "utf32 out of range");
+    check_invalid(utf32_buffer_t{0xDFFF}, 0, "utf32 surrogate");
+
+    std::cout << "passed!" << std::endl;
+}
 /**************************************************************************************************/
 
 } // namespace
@@ -171,6 +253,8 @@ int main(int argc, char* argv[]) try {
 
     bug_test_from_07_27_2008();
 
+    bulk_transcode_test();
+
     return 0;
 } catch (const std::exception& error) {
     std::cerr << "Exception: " << error.what() << "\n";
@@ -0,0 +1,136 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <adobe/iterator.hpp>
+#include <adobe/timer.hpp>
+#include <adobe/xml_event_parser.hpp>
+#include <adobe/xml_parser.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+constexpr std::size_t record_count_k = 40000;
+constexpr std::size_t repeat_count_k = 5;
+
+/*
+    Generates a document of records with attributes, nested elements, entity and character
+    references and a comment now and then, much like an xstring glossary or a resource file.
+*/
+
+std::string synthetic_document() {
+    std::string result("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<records>\n");
+
+    for (std::size_t n(0); n != record_count_k; ++n) {
+        const std::string i(std::to_string(n));
+
+        if (n % 100 == 0)
+            result += "    <!-- block " + i + " -->\n";
+
+        result += "    <record id=\"record_" + i + "\" lang=\"en-us\" platform=\"macintosh\">\n";
+        result += "        <title>Record " + i + " &amp; its &quot;title&quot;</title>\n";
+        result += "        <body>The quick brown fox jumps over the lazy dog; record " + i +
+                  " is longer than most, it has enough text to span several scans &#x263A;."
+                  "</body>\n";
+        result += "        <empty flag='true'/>\n";
+        result += "    </record>\n";
+    }
+
+    return result += "</records>\n";
+}
+
+/**************************************************************************************************/
+
+struct counting_handler_t : adobe::xml_event_handler_t {
+    void start_element(std::string_view) { ++elements_m; }
+    void text(std::string_view x) { bytes_m += x.size(); }
+
+    std::size_t elements_m{0};
+    std::size_t bytes_m{0};
+};
+
+/**************************************************************************************************/
+
+void report(const char* label, double milliseconds, std::size_t bytes, double baseline) {
+    std::cout << "    " << label << ": " << milliseconds << " ms, "
+              << bytes / 1024.0 / 1024.0 / (milliseconds / 1000) << " MB/s";
+    if (baseline != 0)
+        std::cout << " (" << baseline / milliseconds << "x)";
+    std::cout << '\n';
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+int main() try {
+    const std::string document(synthetic_document());
+    const std::size_t bytes(document.size() * repeat_count_k);
+
+    std::cout << "Parse of a " << document.size() / 1024 << " KB document, " << repeat_count_k
+              << " times:\n";
+
+    double baseline(0);
+
+    {
+        auto callback = [](const adobe::token_range_t&, const adobe::token_range_t&,
+                           const adobe::attribute_set_t&, const adobe::token_range_t&) {
+            return adobe::token_range_t();
+        };
+
+        const auto first(reinterpret_cast<adobe::uchar_ptr_t>(document.data()));
+        adobe::timer_t timer;
+
+        for (std::size_t n(0); n != repeat_count_k; ++n) {
+            adobe::make_xml_parser(first, first + document.size(),
+                                   adobe::line_position_t("benchmark"),
+                                   adobe::xml_parser_t<adobe::null_output_iterator_t>::
+                                       preorder_predicate_t(),
+                                   callback, adobe::null_output_iterator_t())
+                .parse_document();
+        }
+
+        baseline = timer.split();
+        report("xml_parser_t", baseline, bytes, 0);
+    }
+
+    {
+        counting_handler_t handler;
+        adobe::timer_t timer;
+
+        for (std::size_t n(0); n != repeat_count_k; ++n)
+            adobe::parse_xml_events(document, adobe::line_position_t("benchmark"), handler);
+
+        report("parse_xml_events", timer.split(), bytes, baseline);
+
+        // Four elements per record and the root.
+        const std::size_t expected((record_count_k * 4 + 1) * repeat_count_k);
+
+        if (handler.elements_m != expected) {
+            std::cerr << "Element count mismatch: " << handler.elements_m << " != " << expected
+                      << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+} catch (const std::exception& error) {
+    std::cerr << "Exception: " << error.what() << '\n';
+    return 1;
+} catch (...) {
+    std::cerr << "Exception: unknown\n";
+    return 1;
+}
@@ -0,0 +1,120 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/xml_event_parser.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+struct logging_handler_t {
+    void start_element(std::string_view name) { log_m += "<" + std::string(name); }
+    void attribute(std::string_view name, std::string_view value) {
+        log_m += " " + std::string(name) + "='" + std::string(value) + "'";
+    }
+    void text(std::string_view text) { log_m += "[" + std::string(text) + "]"; }
+    void end_element(std::string_view name) { log_m += "</" + std::string(name) + ">"; }
+
+    std::string log_m;
+};
+
+std::string parse_document(std::string_view text) {
+    logging_handler_t handler;
+    adobe::parse_xml_events(text, adobe::line_position_t("test"), handler);
+    return handler.log_m;
+}
+
+std::string parse_content(std::string_view text) {
+    logging_handler_t handler;
+    adobe::xml_event_parser_t<logging_handler_t>(text, adobe::line_position_t("test"), handler)
+        .parse_content();
+    return handler.log_m;
+}
+
+/*
+    Returns the line of the error reported for text, or zero if it parsed.
+*/
+int error_line(std::string_view text) {
+    try {
+        parse_document(text);
+    } catch (const adobe::stream_error_t& error) {
+        return error.line_position_set().back().line_number_m;
+    }
+    return 0;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xml_event_parser_events) {
+    BOOST_CHECK_EQUAL(
+        parse_document("\xEF\xBB\xBF<?xml version=\"1.0\"?>\n"
+                       "<!DOCTYPE doc [ <!ENTITY x \"y\"> ]>\n"
+                       "<!-- comment -->\n"
+                       "<doc a=\"1\" b = 'two words'>"
+                       "text &lt;&#65;&#x42;&amp;&eacute;"
+                       "<empty/><inner c=\"&quot;\">in<![CDATA[<raw>]]></inner>"
+                       "<?pi ignored?><!-- ignored -->"
+                       "</doc>\n<!-- trailing -->\n"),
+        "<doc a='1' b='two words'[text ][<][A][B][&][\xC3\xA9]<empty</empty>"
+        "<inner c='&quot;'[in][<raw>]</inner></doc>");
+
+    BOOST_CHECK_EQUAL(parse_content("a<b>c</b>d<e/>"), "[a]<b[c]</b>[d]<e</e>");
+    BOOST_CHECK_EQUAL(parse_content(""), "");
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xml_event_parser_long_text) {
+    // Long runs exercise the vectorized scans, including delimiters at every block offset.
+    for (std::size_t n = 0; n != 40; ++n) {
+        const std::string run(n, 'x');
+        BOOST_CHECK_EQUAL(parse_document("<a v=\"" + run + "\">" + run + "&amp;" + run + "</a>"),
+                          "<a v='" + run + "'" + (n ? "[" + run + "]" : "") + "[&]" +
+                              (n ? "[" + run + "]" : "") + "</a>");
+    }
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xml_event_parser_errors) {
+    BOOST_CHECK_EQUAL(error_line("<a></a>"), 0);
+    BOOST_CHECK_EQUAL(error_line("<a>\n\n</b>"), 3);
+    BOOST_CHECK_EQUAL(error_line("<a>\n<b></a>"), 2);
+    BOOST_CHECK_EQUAL(error_line("<a x=\"1></a>"), 1);
+    BOOST_CHECK_EQUAL(error_line("<a x=1></a>"), 1);
+    BOOST_CHECK_EQUAL(error_line("<a>&bogus;</a>"), 1);
+    BOOST_CHECK_EQUAL(error_line("<a>&amp</a>"), 1);
+    BOOST_CHECK_EQUAL(error_line("<a></a>\ntext"), 2);
+    BOOST_CHECK_EQUAL(error_line("<a></a><b/>"), 1);
+    BOOST_CHECK_EQUAL(error_line("<a>\n<!-- open"), 2);
+    BOOST_CHECK_EQUAL(error_line("<a x=\"1\"y=\"2\"/>"), 1);
+    BOOST_CHECK_EQUAL(error_line("text"), 1);
+    BOOST_CHECK_EQUAL(error_line("<a>"), 1);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xml_event_parser_decode_references) {
+    std::string result;
+    adobe::decode_xml_references("a&lt;b&#x20AC;c&unknown;d&e", std::back_inserter(result));
+    BOOST_CHECK_EQUAL(result, "a<b\xE2\x82\xAC" "c&unknown;d&e");
+}
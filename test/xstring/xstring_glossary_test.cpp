@@ -0,0 +1,203 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/xstring.hpp>
+#include <adobe/xstring_glossary.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+const char glossary_k[] = R"(<xstr id="hello" lang="en-us">Hello</xstr>
+<xstr id="hello" lang="fr">Bonjour</xstr>
+<xstr id="hello" lang="en-us">Ignored duplicate</xstr>
+<xstr id="bye">Goodbye</xstr>
+<xstr id="either" lang="en-us">One</xstr>
+<xstr id="either" platform="linux">Other</xstr>
+<xstr id="nested">&lt;<xstr id="bye">bye</xstr>&gt;</xstr>
+)";
+
+/**************************************************************************************************/
+
+std::string to_string(const adobe::token_range_t* x) {
+    return x ? std::string(x->first, x->second) : std::string("<none>");
+}
+
+adobe::attribute_set_t attributes(const char* lang) {
+    adobe::attribute_set_t result;
+    result.insert(adobe::attribute_set_t::value_type(adobe::static_token_range("lang"),
+                                                     adobe::static_token_range(lang)));
+    return result;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xstring_glossary_find) {
+    const auto glossary(adobe::xstring_glossary_t::compile(glossary_k));
+
+    BOOST_CHECK_EQUAL(glossary.size(), 6u);
+
+    const adobe::name_t hello("hello");
+
+    BOOST_CHECK_EQUAL(to_string(glossary.find(hello, attributes("en-us"))), "Hello");
+    BOOST_CHECK_EQUAL(to_string(glossary.find(hello, attributes("fr"))), "Bonjour");
+    BOOST_CHECK_EQUAL(to_string(glossary.find(hello, attributes("de"))), "<none>");
+    BOOST_CHECK_EQUAL(to_string(glossary.find(adobe::name_t("bye"), attributes("fr"))),
+                      "Goodbye");
+    BOOST_CHECK_EQUAL(to_string(glossary.find(adobe::name_t("missing"), attributes("fr"))),
+                      "<none>");
+
+    BOOST_CHECK_NE(glossary.attribute_set_id(attributes("fr")),
+                   adobe::xstring_glossary_t::npos);
+    BOOST_CHECK_EQUAL(glossary.attribute_set_id(attributes("de")),
+                      adobe::xstring_glossary_t::npos);
+
+    // Both entries agree with one attribute, neither is closer.
+    adobe::attribute_set_t both(attributes("en-us"));
+    both.insert(adobe::attribute_set_t::value_type(adobe::static_token_range("platform"),
+                                                   adobe::static_token_range("linux")));
+    BOOST_CHECK_THROW(glossary.find(adobe::name_t("either"), both), std::runtime_error);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xstring_glossary_image) {
+    const auto glossary(adobe::xstring_glossary_t::compile(glossary_k));
+    const std::string image(glossary.image());
+
+    const auto loaded(adobe::xstring_glossary_t::load(image));
+    BOOST_CHECK_EQUAL(loaded.size(), glossary.size());
+    BOOST_CHECK_EQUAL(loaded.image(), image);
+    BOOST_CHECK_EQUAL(to_string(loaded.find(adobe::name_t("hello"), attributes("fr"))),
+                      "Bonjour");
+
+    const std::filesystem::path path(std::filesystem::temp_directory_path() /
+                                     "asl_xstring_glossary_test.bin");
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << image;
+
+    {
+        const auto mapped(adobe::xstring_glossary_t::load_file(path));
+        BOOST_CHECK_EQUAL(to_string(mapped.find(adobe::name_t("hello"), attributes("en-us"))),
+                          "Hello");
+    }
+
+    std::filesystem::remove(path);
+
+    for (std::size_t n = 0; n != image.size(); ++n)
+        BOOST_CHECK_THROW(adobe::xstring_glossary_t::load(image.substr(0, n)), std::runtime_error);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xstring_with_compiled_glossary) {
+    auto glossary(std::make_shared<const adobe::xstring_glossary_t>(
+        adobe::xstring_glossary_t::compile(glossary_k)));
+
+    // Without the glossary the default value is returned.
+    BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\">default</xstr>"), "default");
+
+    {
+        adobe::xstring_context_t context(glossary);
+
+        BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\">default</xstr>"), "Hello");
+        BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\">default</xstr>"), "Hello");
+        BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\" lang=\"fr\">default</xstr>"),
+                          "Bonjour");
+        BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"nested\">default</xstr>"), "<Goodbye>");
+
+        const adobe::attribute_set_t::value_type french(adobe::static_token_range("lang"),
+                                                        adobe::static_token_range("fr"));
+        {
+            adobe::xstring_context_t inner(&french, &french + 1);
+            BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\">default</xstr>"), "Bonjour");
+        }
+
+        // The inner context's results do not outlive it.
+        BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\">default</xstr>"), "Hello");
+    }
+
+    BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"hello\">default</xstr>"), "default");
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(xstring_with_shared_glossary) {
+    const char* const hello_k = "<xstr id=\"hello\">default</xstr>";
+
+    BOOST_CHECK(!adobe::xstring_shared_glossary());
+
+    adobe::xstring_set_shared_glossary(std::make_shared<const adobe::xstring_glossary_t>(
+        adobe::xstring_glossary_t::compile(glossary_k)));
+
+    BOOST_CHECK_EQUAL(adobe::xstring(hello_k), "Hello");
+
+    // Every thread sees the snapshot and starts with the default attributes.
+    std::vector<std::string> results(4);
+    {
+        std::vector<std::thread> threads;
+        for (auto& e : results)
+            threads.emplace_back([&e, hello_k] {
+                for (int n = 0; n != 100; ++n)
+                    e = adobe::xstring(hello_k);
+            });
+        for (auto& e : threads)
+            e.join();
+    }
+    for (const auto& e : results)
+        BOOST_CHECK_EQUAL(e, "Hello");
+
+    // A context glossary takes precedence over the shared glossary.
+    {
+        adobe::xstring_context_t context(std::make_shared<const adobe::xstring_glossary_t>(
+            adobe::xstring_glossary_t::compile("<xstr id=\"hello\">Hi</xstr>")));
+        BOOST_CHECK_EQUAL(adobe::xstring(hello_k), "Hi");
+        BOOST_CHECK_EQUAL(adobe::xstring("<xstr id=\"bye\">default</xstr>"), "Goodbye");
+    }
+
+    // Replacing the snapshot invalidates memoized results.
+    adobe::xstring_set_shared_glossary(std::make_shared<const adobe::xstring_glossary_t>(
+        adobe::xstring_glossary_t::compile("<xstr id=\"hello\">Howdy</xstr>")));
+    BOOST_CHECK_EQUAL(adobe::xstring(hello_k), "Howdy");
+
+    // The shared glossary is consulted before a glossary parsed by a context.
+    {
+        const adobe::attribute_set_t::value_type english(adobe::static_token_range("lang"),
+                                                         adobe::static_token_range("en-us"));
+        const std::string parsed_k("<xstr id=\"hello\">Parsed</xstr>");
+
+        // The context's frame takes the text, and deletes it.
+        auto* parsed(new unsigned char[parsed_k.size()]);
+        std::copy(parsed_k.begin(), parsed_k.end(), parsed);
+
+        adobe::xstring_context_t context(&english, &english + 1, parsed,
+                                         parsed + parsed_k.size());
+        BOOST_CHECK_EQUAL(adobe::xstring(hello_k), "Howdy");
+    }
+
+    adobe::xstring_set_shared_glossary(nullptr);
+    BOOST_CHECK_EQUAL(adobe::xstring(hello_k), "default");
+}
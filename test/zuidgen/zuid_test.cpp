@@ -0,0 +1,176 @@
+/*
+    Copyright 2026 Adobe
+    Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+/**************************************************************************************************/
+
+#include <adobe/config.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <adobe/zuid.hpp>
+
+/**************************************************************************************************/
+
+namespace {
+
+/**************************************************************************************************/
+
+/// The version of x, or -1 if its variant is not the RFC 9562 one.
+int version(const adobe::zuid_t& x) {
+    const std::string s(x.str());
+    return std::strchr("89ab", s[19]) ? s[14] - '0' : -1;
+}
+
+/**************************************************************************************************/
+
+} // namespace
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(zuid_chars) {
+    const char text[] = "baadf00d-cafe-1337-d00d-feeddeadbeef";
+    adobe::zuid_t x;
+
+    auto parsed(adobe::from_chars(text, text + sizeof(text) - 1, x));
+
+    BOOST_CHECK(parsed.ec == std::errc());
+    BOOST_CHECK_EQUAL(static_cast<const void*>(parsed.ptr),
+                      static_cast<const void*>(text + adobe::zuid_t::string_size_k));
+    BOOST_CHECK(x == adobe::zuid_t(text));
+    BOOST_CHECK_EQUAL(x.str(), text);
+    BOOST_CHECK_EQUAL(std::string(x.c_str()), text);
+
+    char buffer[adobe::zuid_t::string_size_k + 4];
+    auto written(adobe::to_chars(buffer, buffer + sizeof(buffer), x));
+
+    BOOST_CHECK(written.ec == std::errc());
+    BOOST_CHECK_EQUAL(std::string(buffer, written.ptr), text);
+
+    written = adobe::to_chars(buffer, buffer + adobe::zuid_t::string_size_k - 1, x);
+
+    BOOST_CHECK(written.ec == std::errc::value_too_large);
+
+    // Upper case parses and trailing text is left.
+    const std::string upper("BAADF00D-CAFE-1337-D00D-FEEDDEADBEEF}");
+    adobe::zuid_t y;
+
+    parsed = adobe::from_chars(upper.data(), upper.data() + upper.size(), y);
+
+    BOOST_CHECK(parsed.ec == std::errc());
+    BOOST_CHECK_EQUAL(*parsed.ptr, '}');
+    BOOST_CHECK(y == x);
+
+    // Malformed text fails and leaves the value unchanged.
+    for (const char* bad :
+         {"", "baadf00d", "baadf00d-cafe-1337-d00d-feeddeadbee",
+          "baadf00d-cafe-1337-d00dfeeddeadbeef", "baadf00d-cafe-1337-d00d-feeddeadbeeg",
+          "baadf0d-cafe-1337-d00d-feeddeadbeef0"}) {
+        adobe::zuid_t z(adobe::zuid_t::null);
+
+        parsed = adobe::from_chars(bad, bad + std::strlen(bad), z);
+
+        BOOST_CHECK(parsed.ec == std::errc::invalid_argument);
+        BOOST_CHECK_EQUAL(static_cast<const void*>(parsed.ptr), static_cast<const void*>(bad));
+        BOOST_CHECK(z == adobe::zuid_t::null);
+    }
+
+    // The string constructors keep reading what fields they can.
+    BOOST_CHECK_EQUAL(adobe::zuid_t("bad-f00d").str(), "00000bad-f00d-0000-0000-000000000000");
+    BOOST_CHECK(adobe::zuid_t(std::string("")) == adobe::zuid_t::null);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(zuid_random) {
+    std::set<adobe::zuid_t> seen;
+
+    for (int n(0); n != 1000; ++n) {
+        const adobe::zuid_t x(adobe::zuid_t::random());
+
+        BOOST_CHECK_EQUAL(version(x), 4);
+        BOOST_CHECK(seen.insert(x).second);
+    }
+
+    std::vector<adobe::zuid_t> batch;
+    adobe::zuid_t::generate_n(std::back_inserter(batch), 1000);
+
+    BOOST_CHECK_EQUAL(batch.size(), 1000u);
+
+    for (const auto& e : batch) {
+        BOOST_CHECK_EQUAL(version(e), 4);
+        BOOST_CHECK(seen.insert(e).second);
+    }
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(zuid_time_ordered) {
+    std::vector<adobe::zuid_t> ids;
+
+    for (int n(0); n != 1000; ++n)
+        ids.push_back(adobe::zuid_t::time_ordered());
+
+    adobe::zuid_t::generate_n(std::back_inserter(ids), 1000, adobe::zuid_t::time_ordered_k);
+
+    // Strictly increasing in the order generated.
+    BOOST_CHECK(std::adjacent_find(ids.begin(), ids.end(),
+                                   [](const auto& a, const auto& b) { return !(a < b); }) ==
+                ids.end());
+
+    for (const auto& e : ids)
+        BOOST_CHECK_EQUAL(version(e), 7);
+
+    // The leading 48 bits are the Unix time in milliseconds.
+    const std::string s(ids.back().str());
+    const long long ms(std::stoll(s.substr(0, 8) + s.substr(9, 4), nullptr, 16));
+    const long long now(std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count());
+
+    BOOST_CHECK(now - 60000 < ms && ms <= now + 1000);
+}
+
+/**************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(zuid_threads) {
+    constexpr std::size_t per_thread_k = 20000;
+
+    std::vector<std::vector<adobe::zuid_t>> results(4);
+    std::vector<std::thread> threads;
+
+    for (auto& e : results) {
+        threads.emplace_back([&e, n = &e - results.data()] {
+            e.resize(per_thread_k, adobe::zuid_t::null);
+            adobe::zuid_t::generate_n(e.begin(), per_thread_k,
+                                      n % 2 ? adobe::zuid_t::random_k
+                                            : adobe::zuid_t::time_ordered_k);
+        });
+    }
+
+    for (auto& e : threads)
+        e.join();
+
+    std::vector<adobe::zuid_t> all;
+
+    for (const auto& e : results)
+        all.insert(all.end(), e.begin(), e.end());
+
+    std::sort(all.begin(), all.end());
+
+    BOOST_CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+/**************************************************************************************************/